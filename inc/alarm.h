@@ -0,0 +1,55 @@
+#ifndef ALARM_H
+#define ALARM_H
+
+#include <time.h>
+
+///////////////////////////////////
+/*  Alarms                       */
+///////////////////////////////////
+// Alarms are kept in a min-heap on their next fire time, so the check
+// done every frame only looks at the top, and a fired alarm is moved to
+// its next time in O(log n). Next times are local times through
+// mktime(), so they follow DST changes. When the clock is set by hand
+// all of them are computed again.
+
+#define ALARM_MAX       256
+#define ALARM_NONE      -1
+#define ALARM_ONCE      0       // days of a one shot alarm
+#define ALARM_LATE_MAX  900     // s, older alarms are missed, not rung
+
+struct alarm_entry
+{
+  int hour;
+  int min;
+  int days;           // bit 0=sunday .. bit 6=saturday, ALARM_ONCE
+  int enabled;
+  int snooze;         // minutes, 0=no snooze
+  // schedule
+  time_t next;        // next fire time, 0 if not scheduled
+  int snoozed;
+};
+
+int alarm_count();
+const alarm_entry* alarm_get(int i);
+// index of the new alarm, ALARM_NONE if there is no room
+int alarm_add(const alarm_entry* a, time_t now);
+// settings of a (not schedule) to alarm i, scheduled again
+void alarm_set(int i, const alarm_entry* a, time_t now);
+void alarm_enable(int i, int enabled, time_t now);
+// later alarms move one index down
+void alarm_remove(int i);
+
+// alarm ringing at now, ALARM_NONE if none (call every frame), changed
+// set TRUE when a one shot alarm was disabled and has to be saved
+int alarm_check(time_t now, int* changed);
+void alarm_snooze(int i, time_t now);
+// clock was set, schedule all again from now
+void alarm_time_changed(time_t now);
+// first fire time of all alarms, 0 if none
+time_t alarm_next();
+
+// alarms.ini, FALSE if it can't be read or written
+int alarm_load(const char* path, time_t now);
+int alarm_save(const char* path);
+
+#endif
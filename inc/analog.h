@@ -0,0 +1,39 @@
+#ifndef ANALOG_H
+#define ANALOG_H
+
+#include <time.h>
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Analog clock face            */
+///////////////////////////////////
+// Hands come from a sin table built by the compiler (Q14 fixed point,
+// half a degree a step, no libm at run time) and are recorded as line
+// operations of the renderer, so a frame only redraws the boxes of the
+// hands that moved over the dial, baked once in a layer.
+
+#define ANALOG_STEPS    720     // table entries, a whole turn
+#define ANALOG_ONE      16384   // 1.0 in the table
+#define ANALOG_SIZE     121     // dial surface, w and h
+#define ANALOG_RADIUS   60
+
+struct analog_colours
+{
+  Uint32 hour;
+  Uint32 min;
+  Uint32 sec;
+  Uint32 cap;
+};
+
+// dial centered in a ANALOG_SIZE square, key fills the corners
+void analog_bake_dial(SDL_Surface* dst, Uint32 key, Uint32 face, Uint32 rim, Uint32 ticks);
+// hands around cx,cy, ms: milliseconds of the second (sweep)
+void analog_draw_hands(int cx, int cy, const tm* t, int ms, const analog_colours* c);
+// ms until the second hand takes its next step
+Uint32 analog_to_next_step(int ms);
+
+// sin and cos of step, ANALOG_ONE is 1.0
+int analog_sin(int step);
+int analog_cos(int step);
+
+#endif
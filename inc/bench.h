@@ -0,0 +1,29 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#ifdef BENCHMARK
+
+///////////////////////////////////
+/*  Frame time benchmark         */
+///////////////////////////////////
+// Only in the benchmark build (make bench). Every case renders a number
+// of frames, each frame split in sections by bench_mark(). Results are
+// printed to stdout as JSON, times in microseconds.
+
+#define BENCH_UPDATE    0     // update_menu + update_mode_*
+#define BENCH_MENU      1     // draw_menu
+#define BENCH_MODE      2     // draw_mode_*
+#define BENCH_RENDER    3     // render_end
+#define BENCH_SECTIONS  4
+
+void bench_start();
+void bench_case(const char* name, int full_redraw);
+void bench_frame_begin();
+// time since previous mark (or frame begin) goes to section
+void bench_mark(int section);
+void bench_frame_end();
+void bench_finish();
+
+#endif
+
+#endif
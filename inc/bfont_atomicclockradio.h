@@ -0,0 +1,1463 @@
+#ifndef BFONT_ATOMICCLOCKRADIO_H
+#define BFONT_ATOMICCLOCKRADIO_H
+
+// generated by tools/bakefont from media/AtomicClockRadio.ttf at 28 pt, don't edit
+
+#include "bitmap_font.h"
+
+static const Uint8 bfont_atomicclockradio_bits[]=
+{
+  0x05, 0x61, 0x27, 0x40, 0x5f, 0xfa, 0xcf, 0xf3, 0x6f, 0xfc, 0xdf, 0xf5, 0x1a, 0xb4, 0x5c, 0x90,
+  0x1b, 0xc4, 0x5c, 0xa0, 0x5f, 0xfb, 0xcf, 0xf4, 0x3f, 0xf8, 0xaf, 0xe2, 0x04, 0x60, 0x17, 0x30,
+  0x2f, 0xf7, 0x9f, 0xe1, 0x4f, 0xf9, 0xbf, 0xf2, 0x08, 0xa2, 0x3a, 0x70, 0x07, 0x92, 0x00, 0x00,
+  0x3f, 0xf8, 0x00, 0x00, 0x1e, 0xf5, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x16, 0x30, 0x0f, 0xf5, 0x7f, 0xd0,
+  0x0c, 0xf3, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70, 0x0e, 0xf4, 0x6f, 0xc0,
+  0x04, 0x70, 0x17, 0x30, 0x2d, 0xe6, 0x00, 0x02, 0xde, 0x70, 0x6f, 0xfc, 0x00, 0x06, 0xff, 0xd0,
+  0x2d, 0xe6, 0x00, 0x02, 0xde, 0x70, 0x2d, 0xe6, 0x00, 0x01, 0xce, 0x60, 0x5f, 0xfb, 0x00, 0x04,
+  0xff, 0xb0, 0x2d, 0xe6, 0x00, 0x01, 0xce, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe5,
+  0x00, 0x01, 0xce, 0x50, 0x4f, 0xf9, 0x00, 0x03, 0xff, 0xa0, 0x1d, 0xe5, 0x00, 0x01, 0xce, 0x50,
+  0x00, 0x00, 0x56, 0x10, 0x00, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xa0, 0x00, 0x4f, 0xfb,
+  0x00, 0x00, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x6f, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00,
+  0x1a, 0xc5, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40, 0x00, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0xb0, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x03,
+  0x10, 0x46, 0x00, 0x31, 0x03, 0x70, 0x03, 0x20, 0xaf, 0xe3, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x8f,
+  0xf1, 0xcf, 0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0xaf, 0xf3, 0x4a, 0x70, 0x8a, 0x23, 0xa7, 0x08,
+  0xa3, 0x3a, 0x80, 0x00, 0x00, 0x79, 0x20, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80,
+  0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xef, 0x50, 0x00, 0x1e, 0xf6, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0,
+  0x9f, 0xe1, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f, 0xf1, 0x28, 0x50, 0x68, 0x12, 0x85, 0x05, 0x81,
+  0x18, 0x50, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x10, 0x00, 0x08, 0xb2, 0x00, 0x00, 0x00,
+  0x00, 0xef, 0x40, 0x00, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x04, 0x71, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x45, 0xca, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05,
+  0xff, 0xbc, 0xff, 0x8f, 0xfb, 0x00, 0x00, 0x00, 0x03, 0xff, 0x8a, 0xfe, 0x4f, 0xf9, 0x00, 0x00,
+  0x03, 0x10, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0x00, 0x03, 0xff,
+  0x8a, 0xff, 0x3f, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x50, 0x00, 0x00, 0x35, 0x01, 0x63, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x57,
+  0xfd, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x35, 0xfb, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x56, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x05, 0xca, 0x00, 0x00, 0x5c, 0xa1, 0xdf,
+  0xf3, 0x00, 0x0c, 0xff, 0x40, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x0a, 0xfe, 0x20, 0x00, 0x9f,
+  0xf2, 0x03, 0x10, 0x23, 0x00, 0x31, 0x02, 0x30, 0x03, 0x20, 0x00, 0x02, 0xff, 0x70, 0x00, 0x2f,
+  0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x90, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x20,
+  0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x40, 0x00, 0x0c, 0xf4,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0x70, 0x00, 0x1f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x68, 0x10, 0x00,
+  0x05, 0x81, 0x00, 0x00, 0x16, 0x20, 0x00, 0x01, 0x63, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00,
+  0x07, 0xfd, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xab, 0x45, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x1a, 0xc5, 0x00, 0x00,
+  0xdf, 0xf3, 0x00, 0x00, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x2f, 0xf9,
+  0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00,
+  0x2f, 0xf8, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x00,
+  0x00, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x45, 0xfb, 0x00,
+  0x00, 0x4f, 0xc0, 0x00, 0x01, 0xff, 0x78, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00, 0x68, 0x12,
+  0x85, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x8f, 0xc0,
+  0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x00, 0x00,
+  0x2b, 0x70, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x00, 0x00, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73,
+  0x00, 0x00, 0x17, 0x40, 0x8e, 0xc1, 0xef, 0xf5, 0x8e, 0xc1, 0x7e, 0xc1, 0xcf, 0xf4, 0x7e, 0xc1,
+  0x00, 0x00, 0x6e, 0xc0, 0xbf, 0xf2, 0x6e, 0xc0, 0x00, 0x02, 0xde, 0x70, 0x00, 0x06, 0xff, 0xd0,
+  0x00, 0x02, 0xde, 0x70, 0x7e, 0xc1, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00,
+  0x5e, 0xb0, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x5e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0xa0, 0x00, 0x00, 0x9f, 0xf0, 0x00, 0x00, 0x5e, 0xa0, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00,
+  0x8f, 0xe0, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x20,
+  0x00, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x9e, 0x20, 0x2d, 0xe6, 0x00, 0x00, 0x6f, 0xfc, 0x00, 0x00,
+  0x2d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x7e, 0xc1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x6e, 0xc0,
+  0x00, 0x00, 0x5e, 0xb0, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x5e, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x9f, 0xf0, 0x00, 0x00, 0x5e, 0xa0, 0x00, 0x00, 0x4e, 0x90,
+  0x00, 0x00, 0x8f, 0xe0, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe2, 0x00, 0x00,
+  0x0e, 0xf4, 0x00, 0x00, 0x0a, 0xe2, 0x00, 0x00, 0x1c, 0xe5, 0x00, 0x01, 0xce, 0x50, 0x4f, 0xf9,
+  0x00, 0x03, 0xff, 0xa0, 0x1d, 0xe5, 0x00, 0x01, 0xce, 0x50, 0x00, 0x00, 0x5e, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0xe3, 0x00, 0x00, 0xbe, 0x40, 0x2f, 0xf7, 0x00, 0x01, 0xff, 0x80, 0x0c, 0xe3,
+  0x00, 0x00, 0xbe, 0x40, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x1c, 0xe4, 0x5e, 0xb0, 0xce, 0x50, 0x3f, 0xf8, 0xaf, 0xf3,
+  0xff, 0x90, 0x1c, 0xe4, 0x5e, 0xb0, 0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xa0, 0x00, 0x00,
+  0x0b, 0xe2, 0x4e, 0x90, 0x0f, 0xf6, 0x8f, 0xe0, 0x0b, 0xe2, 0x4e, 0x90, 0x0a, 0xe2, 0x3e, 0x80,
+  0x0e, 0xf4, 0x6f, 0xc0, 0x0a, 0xe2, 0x3e, 0x80, 0x00, 0x00, 0x2e, 0x70, 0x00, 0x00, 0x5f, 0xb0,
+  0x00, 0x00, 0x2e, 0x70, 0x1c, 0xe4, 0x5e, 0xb0, 0xce, 0x50, 0x3f, 0xf8, 0xaf, 0xf3, 0xff, 0x90,
+  0x1c, 0xe4, 0x5e, 0xb0, 0xce, 0x50, 0x0b, 0xe2, 0x4e, 0x90, 0x0f, 0xf6, 0x8f, 0xe0, 0x0b, 0xe2,
+  0x4e, 0x90, 0x0a, 0xe2, 0x3e, 0x80, 0x0e, 0xf4, 0x6f, 0xc0, 0x0a, 0xe2, 0x3e, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xce, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00,
+  0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd,
+  0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x02, 0x30, 0x07, 0x30, 0xaf,
+  0xe0, 0x00, 0x00, 0x00, 0x2f, 0xf8, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x3f, 0xfa, 0xaf,
+  0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x08, 0xa3, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x02, 0x96, 0x00,
+  0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07,
+  0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0,
+  0xce, 0x40, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe1, 0xff, 0x70, 0x00, 0x00, 0x00, 0x7f, 0xf1,
+  0x28, 0x50, 0x68, 0x10, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b,
+  0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00,
+  0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x90, 0x00, 0x00,
+  0x1b, 0xc4, 0x5c, 0xa0, 0x00, 0x00, 0x5f, 0xfb, 0xcf, 0xf4, 0x00, 0x00, 0x3f, 0xf8, 0xaf, 0xe2,
+  0x00, 0x00, 0x02, 0x30, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70,
+  0x8b, 0x20, 0x0e, 0xf4, 0x6f, 0xc0, 0xdf, 0x50, 0x04, 0x70, 0x17, 0x30, 0x47, 0x10, 0x00, 0x00,
+  0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00,
+  0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5,
+  0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x03, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a,
+  0x80, 0x00, 0x00, 0x00, 0x02, 0x96, 0x06, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x3f,
+  0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0xce, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0xef,
+  0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00,
+  0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00,
+  0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a,
+  0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x03, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x96, 0x06, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff,
+  0x3f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x7f, 0xfb,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9,
+  0x1a, 0xc5, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40, 0x00, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0xb0, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x03,
+  0x10, 0x23, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x2f, 0xf8, 0x00,
+  0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x08,
+  0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00,
+  0x00, 0x2f, 0xf9, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0,
+  0x9f, 0xe1, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f, 0xf1, 0x28, 0x50, 0x68, 0x12, 0x85, 0x05, 0x81,
+  0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x00,
+  0x00, 0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f,
+  0xfb, 0x00, 0x00, 0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x6c, 0x91, 0xab, 0x45,
+  0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf3, 0xff,
+  0x8a, 0xff, 0x3f, 0xf9, 0x00, 0x00, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x02,
+  0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff,
+  0x7f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x10, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf3,
+  0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x00, 0x00, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00,
+  0x02, 0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04,
+  0x71, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72, 0x27, 0x50, 0xdf, 0xf7, 0xff, 0xac,
+  0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0xdf, 0xf5, 0x6c, 0x91,
+  0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1,
+  0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf2, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00,
+  0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+  0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x00, 0x00, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xef, 0x57, 0xfd, 0x1e, 0xf6,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08,
+  0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01,
+  0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05,
+  0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00,
+  0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x00, 0x00, 0x79, 0x22, 0x96, 0x06, 0x92, 0x29,
+  0x60, 0x00, 0x03, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x9f, 0xf2, 0x00, 0x01, 0xef, 0x57, 0xfd, 0x1e,
+  0xf6, 0x6f, 0xe1, 0x00, 0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc2, 0xce, 0x60, 0xcf, 0xf8, 0xff, 0xb0, 0x7e, 0xc2,
+  0xce, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc1, 0xce, 0x50, 0xbf, 0xf6, 0xff, 0xa0, 0x6e, 0xc1,
+  0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4e, 0xa0, 0xbe, 0x40, 0x9f, 0xf1, 0xff, 0x80, 0x5e, 0xa0, 0xbe, 0x40, 0x4e, 0x90,
+  0xae, 0x30, 0x8f, 0xe0, 0xff, 0x70, 0x4e, 0x90, 0xae, 0x30, 0x5c, 0xa1, 0xac, 0x50, 0xcf, 0xf8,
+  0xff, 0xb0, 0xaf, 0xe4, 0xff, 0x90, 0x17, 0x30, 0x37, 0x00, 0x9f, 0xe2, 0xff, 0x80, 0xbf, 0xf5,
+  0xff, 0xa0, 0x3a, 0x70, 0x8a, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0xcf, 0x40, 0x8f, 0xf1, 0xff, 0x70, 0x28, 0x50,
+  0x58, 0x10, 0x16, 0x30, 0x35, 0x00, 0x7f, 0xd0, 0xef, 0x60, 0x5f, 0xb0, 0xcf, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8b, 0x20, 0x00, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00,
+  0x00, 0x01, 0xce, 0x60, 0x00, 0x00, 0x00, 0x04, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xce, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x1c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x30, 0x00, 0x00, 0x00, 0x00, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xae, 0x30, 0x1c, 0xe5, 0x6e, 0xc1, 0xce, 0x50, 0x4f, 0xf9, 0xbf, 0xf6, 0xff, 0xa0,
+  0x1d, 0xe5, 0x6e, 0xc1, 0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe3,
+  0x4e, 0xa0, 0xbe, 0x40, 0x2f, 0xf7, 0x9f, 0xf1, 0xff, 0x80, 0x0c, 0xe3, 0x5e, 0xa0, 0xbe, 0x40,
+  0x2d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xe6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x50,
+  0x00, 0x00, 0x00, 0x02, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0xce, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x5e, 0xa0, 0x00, 0x00, 0x0b, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf6, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00,
+  0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xf2, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x00, 0x00, 0x00, 0x02, 0x96, 0x06, 0x92,
+  0x29, 0x60, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x3f, 0xf9, 0x9f, 0xf2, 0x00, 0x00, 0x00, 0x07, 0xfd,
+  0x1e, 0xf6, 0x6f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x20, 0x02, 0x10, 0x00, 0x00, 0x00,
+  0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72, 0x27, 0x50,
+  0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd,
+  0xdf, 0xf5, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x31, 0x00, 0x00, 0x07, 0x30, 0xaf,
+  0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x0b, 0xff, 0x20, 0x00, 0xaf,
+  0xf3, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x02, 0x96, 0x00,
+  0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07,
+  0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0,
+  0x00, 0x05, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x08, 0xff, 0x1f, 0xf7, 0x7f, 0xf1,
+  0x28, 0x50, 0x00, 0x02, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b,
+  0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x17,
+  0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40,
+  0x00, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0x80, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x03, 0x10, 0x23, 0x00, 0x00, 0x02, 0x30, 0x03, 0x20,
+  0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f,
+  0xa0, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x9f, 0xe1, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f,
+  0xf1, 0x28, 0x50, 0x68, 0x12, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0,
+  0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72,
+  0x00, 0x00, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0xef, 0xfa, 0xff, 0xcd, 0xff,
+  0xaf, 0xfd, 0x00, 0x00, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf,
+  0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x79, 0x22,
+  0x96, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x00, 0x00, 0x8f, 0xc1,
+  0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x00, 0x00,
+  0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00,
+  0x00, 0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05,
+  0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd,
+  0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4,
+  0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12, 0x74,
+  0x05, 0x72, 0x00, 0x00, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0xef, 0xfa, 0xff,
+  0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2,
+  0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d,
+  0xf5, 0x00, 0x00, 0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12,
+  0x74, 0x05, 0x72, 0x27, 0x50, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0xef, 0xfa,
+  0xff, 0xcd, 0xff, 0xaf, 0xfd, 0xdf, 0xf5, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1,
+  0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+  0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x9f,
+  0xf2, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x11, 0x00, 0x20, 0x01,
+  0x20, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0xef, 0x46, 0xfc,
+  0x0d, 0xf5, 0x5f, 0xd0, 0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x27, 0x40, 0x56,
+  0x12, 0x74, 0x05, 0x72, 0x27, 0x50, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0xef,
+  0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0xdf, 0xf5, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c,
+  0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x39, 0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f, 0xf9,
+  0x9f, 0xf2, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x11, 0x00, 0x20,
+  0x01, 0x20, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00,
+  0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5,
+  0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0x50, 0x00, 0x02, 0x96, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x3f,
+  0xf9, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x01, 0x20, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50,
+  0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef,
+  0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x27,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1,
+  0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3a, 0x80, 0x39, 0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf3, 0xff, 0x8a, 0xff,
+  0x3f, 0xf9, 0x9f, 0xf2, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x11,
+  0x00, 0x20, 0x01, 0x20, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40,
+  0x05, 0x61, 0x27, 0x40, 0x57, 0x20, 0x5f, 0xfa, 0xcf, 0xf7, 0xff, 0xb0, 0x6f, 0xfc, 0xdf, 0xfa,
+  0xff, 0xd0, 0x1a, 0xb4, 0x5c, 0x91, 0xac, 0x50, 0x00, 0x00, 0x5c, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70, 0x8b, 0x20, 0x0e, 0xf4, 0x6f, 0xc0, 0xdf, 0x50,
+  0x04, 0x70, 0x17, 0x30, 0x47, 0x10, 0x00, 0x00, 0x00, 0x02, 0x74, 0x05, 0x72, 0x27, 0x50, 0x00,
+  0x00, 0x00, 0x0c, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xaf, 0xfd, 0xdf,
+  0xf5, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12,
+  0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50,
+  0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0xf5, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00,
+  0x1a, 0xc5, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0xbf, 0xe1, 0x00,
+  0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf,
+  0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x0b, 0xff, 0x20, 0x00, 0x00,
+  0x00, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x79, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf3, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc1, 0xef, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xa0,
+  0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x03, 0x50,
+  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00,
+  0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60,
+  0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0,
+  0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa1, 0xbc,
+  0x40, 0x00, 0x1a, 0xc5, 0x5c, 0xa1, 0xdf, 0xf8, 0xff, 0xb0, 0x00, 0x4f, 0xfb, 0xbf, 0xf4, 0xbf,
+  0xe4, 0xff, 0x80, 0x00, 0x2f, 0xf9, 0x9f, 0xf2, 0x17, 0x30, 0x23, 0x00, 0x31, 0x02, 0x30, 0x07,
+  0x30, 0xaf, 0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x0b, 0xff, 0x20,
+  0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10,
+  0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f,
+  0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa1,
+  0xbc, 0x40, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf8, 0xff, 0xb0, 0x00, 0x00, 0x00, 0xbf, 0xf4,
+  0xbf, 0xe4, 0xff, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x23, 0x00, 0x31, 0x00, 0x00,
+  0x07, 0x30, 0xaf, 0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x0b, 0xff,
+  0x20, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00,
+  0x00, 0x00, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x2f, 0xf9, 0x9f, 0xf2, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02,
+  0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x56, 0x12, 0x74,
+  0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff,
+  0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2,
+  0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d,
+  0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12,
+  0x74, 0x05, 0x72, 0x00, 0x00, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0xef, 0xfa,
+  0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00,
+  0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39,
+  0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x00,
+  0x00, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00, 0x20, 0x01,
+  0x20, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+  0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00,
+  0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00,
+  0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80,
+  0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00,
+  0x08, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x18, 0x50, 0x16,
+  0x20, 0x00, 0x00, 0x00, 0x03, 0x50, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x6f,
+  0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef, 0x46,
+  0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x27, 0x40,
+  0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00,
+  0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5,
+  0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a,
+  0x80, 0x39, 0x50, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f,
+  0xf9, 0x00, 0x00, 0x8f, 0xc1, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00,
+  0x20, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0,
+  0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x20, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x0e, 0xf6,
+  0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00,
+  0x00, 0x56, 0x12, 0x74, 0x05, 0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00,
+  0x00, 0x00, 0x06, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a,
+  0xc5, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0x22, 0x96, 0x06, 0x92, 0x00, 0x00, 0x00, 0x03, 0xff, 0x8a, 0xff,
+  0x3f, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x00, 0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00,
+  0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72, 0x27, 0x50, 0xdf, 0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb,
+  0xbf, 0xf4, 0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0xdf, 0xf5, 0x6c, 0x91, 0xab, 0x45, 0xc9,
+  0x1a, 0xc5, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x05, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00,
+  0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2,
+  0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71,
+  0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf,
+  0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f,
+  0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x50, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x50, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x00,
+  0x00, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1,
+  0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00,
+  0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x08, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02,
+  0x85, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x35, 0x00, 0x00, 0x03, 0x50, 0x05, 0x30, 0x8f, 0xc0,
+  0xff, 0x50, 0x00, 0x0e, 0xf6, 0x6f, 0xe0, 0x5f, 0xa0, 0xcf, 0x30, 0x00, 0x0c, 0xf4, 0x4f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x6c,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+  0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf2, 0x03, 0x10, 0x23, 0x00, 0x00, 0x02, 0x30, 0x03, 0x20, 0x00, 0x02, 0xff, 0x70,
+  0x00, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x90, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x8a, 0x20, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x40, 0x00,
+  0x0c, 0xf4, 0x00, 0x00, 0x00, 0x01, 0xff, 0x70, 0x00, 0x1f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x68,
+  0x10, 0x00, 0x05, 0x81, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0xdf, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5,
+  0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0xf2, 0x03, 0x10, 0x23, 0x00, 0x00, 0x02, 0x30, 0x03, 0x20, 0x00, 0x02, 0xff,
+  0x70, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x90, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x8a, 0x20, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x27, 0x40, 0x56, 0x12, 0x74, 0x05, 0x72, 0x27, 0x50, 0xdf,
+  0xf7, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0xef, 0xfa, 0xff, 0xcd, 0xff, 0xaf, 0xfd, 0xdf,
+  0xf5, 0x6c, 0x91, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0xbf, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xf2, 0x03, 0x10, 0x00, 0x00, 0x00, 0x02, 0x30, 0x03, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfa, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12,
+  0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x17, 0x30,
+  0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x27, 0x40, 0x57, 0x20, 0xcf, 0xf7, 0xff, 0xb0, 0xdf,
+  0xfa, 0xff, 0xd0, 0x5c, 0x91, 0xac, 0x50, 0x5c, 0xa0, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0xaf,
+  0xe2, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x9f, 0xe1, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x3a,
+  0x70, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x16,
+  0x30, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+  0x70, 0x8b, 0x20, 0x6f, 0xc0, 0xdf, 0x50, 0x17, 0x30, 0x47, 0x10, 0x8e, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xde, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xeb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0b, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3e, 0xa0, 0x05, 0x61, 0x27, 0x40, 0x5f, 0xfa, 0xcf, 0xf3, 0x6f, 0xfc, 0xdf, 0xf5,
+  0x1a, 0xb4, 0x5c, 0x90, 0x00, 0x00, 0x5c, 0xa0, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0xaf, 0xe2,
+  0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x9f, 0xe1, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x3a, 0x70,
+  0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x16, 0x30,
+  0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70,
+  0x0e, 0xf4, 0x6f, 0xc0, 0x04, 0x70, 0x17, 0x30, 0x00, 0x00, 0x8e, 0xc1, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xc1, 0x00, 0x00, 0x2d, 0xe6, 0x00, 0x01, 0xce, 0x60,
+  0x5f, 0xfb, 0x00, 0x04, 0xff, 0xb0, 0x2d, 0xe6, 0x00, 0x01, 0xce, 0x60, 0x4e, 0x70, 0xae, 0x23,
+  0xe8, 0x09, 0xe2, 0x2e, 0x90, 0x7f, 0xc0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x4e, 0x70,
+  0xae, 0x23, 0xe8, 0x09, 0xe2, 0x2e, 0x90, 0x2d, 0xe6, 0x00, 0x00, 0x6f, 0xfc, 0x00, 0x00, 0x2d,
+  0xe6, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x7e, 0xc1, 0x00,
+  0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00,
+  0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08,
+  0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0,
+  0x00, 0x01, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f, 0xf1, 0x00, 0x00, 0x68, 0x12, 0x85, 0x05, 0x81,
+  0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00,
+  0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17,
+  0x40, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x30, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe3, 0xff, 0x79, 0xfe, 0x2f, 0xf8,
+  0x00, 0x00, 0xcf, 0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x8a, 0x23, 0xa7,
+  0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00,
+  0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x17, 0x30, 0x47, 0x01, 0x73, 0x04, 0x71,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe,
+  0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a,
+  0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73,
+  0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+  0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf2, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x07, 0x30, 0x00, 0x02, 0xff, 0x79,
+  0xfe, 0x2f, 0xf8, 0x8f, 0xf1, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0xaf, 0xf3, 0x00, 0x00,
+  0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60,
+  0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08,
+  0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01,
+  0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02,
+  0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00,
+  0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0xce,
+  0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x9f, 0xe1, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f, 0xf1, 0x28,
+  0x50, 0x68, 0x12, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12,
+  0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x06, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x01, 0xac, 0x50, 0x00,
+  0x00, 0x5c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe2, 0x00,
+  0x00, 0x02, 0x30, 0x17, 0x30, 0x23, 0x00, 0x2f, 0xf7, 0x9f, 0xe2, 0xff, 0x80, 0x4f, 0xf9, 0xbf,
+  0xf5, 0xff, 0xa0, 0x08, 0xa2, 0x3a, 0x70, 0x8a, 0x30, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x28,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70, 0x8b,
+  0x20, 0x0e, 0xf4, 0x6f, 0xc0, 0xdf, 0x50, 0x04, 0x70, 0x17, 0x30, 0x47, 0x10, 0x00, 0x00, 0x23,
+  0x00, 0x31, 0x02, 0x30, 0x03, 0x20, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x8f, 0xf1, 0x00,
+  0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0xaf, 0xf3, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x3a,
+  0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50,
+  0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef,
+  0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x73, 0x04, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x13,
+  0xf9, 0x0a, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x52, 0x02, 0x50, 0x00, 0x00, 0x27, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x23,
+  0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe3, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0xcf,
+  0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00,
+  0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50,
+  0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00,
+  0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0x00,
+  0x00, 0x00, 0x00, 0x5c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x03, 0x10, 0x00, 0x00, 0x2f,
+  0xf7, 0x9f, 0xe1, 0x00, 0x00, 0x4f, 0xf9, 0xbf, 0xf2, 0x00, 0x00, 0x08, 0xa2, 0x3a, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x7f,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70, 0x8b, 0x20, 0x0e, 0xf4, 0x6f, 0xc0, 0xdf, 0x50, 0x04,
+  0x70, 0x17, 0x30, 0x47, 0x10, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0xcf, 0xf3, 0x00, 0x00, 0xdf,
+  0xf5, 0x00, 0x00, 0x5c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x30, 0x03, 0x10, 0x2f, 0xf7, 0x9f, 0xe1, 0x4f, 0xf9, 0xbf, 0xf2, 0x08, 0xa2, 0x3a,
+  0x70, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0xaf, 0xf1, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x16,
+  0x30, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+  0x70, 0x00, 0x00, 0x6f, 0xc0, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x4f,
+  0xa0, 0x00, 0x00, 0x3d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x0b, 0xf1, 0x00,
+  0x00, 0x03, 0x50, 0x00, 0x00, 0x27, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xe1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x06, 0x92, 0x00,
+  0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x1e,
+  0xf6, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x6f, 0xa0, 0xce, 0x45,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe1, 0xff, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50,
+  0x68, 0x12, 0x85, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00,
+  0x8f, 0xc0, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x0c, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x05, 0x61, 0x27, 0x40, 0x00, 0x00, 0x5f, 0xfa, 0xcf, 0xf3,
+  0x00, 0x00, 0x6f, 0xfc, 0xdf, 0xf5, 0x00, 0x00, 0x1a, 0xb4, 0x5c, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x5c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe2, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb1, 0x2b, 0x70, 0x8b, 0x20,
+  0x0e, 0xf4, 0x6f, 0xc0, 0xdf, 0x50, 0x04, 0x70, 0x17, 0x30, 0x47, 0x10, 0x03, 0x10, 0x23, 0x00,
+  0x00, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe3, 0xff, 0x70, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0xcf, 0xf5,
+  0xff, 0x90, 0x00, 0x3f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x8a, 0x20, 0x00, 0x08, 0xa3, 0x00, 0x00,
+  0x39, 0x50, 0x00, 0x02, 0x96, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00,
+  0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00,
+  0x08, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x18, 0x50, 0x16,
+  0x20, 0x00, 0x01, 0x63, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x6f,
+  0xe0, 0x5f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x06,
+  0xfc, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x01, 0x73, 0x00, 0x00, 0x17, 0x40, 0x03, 0x10,
+  0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe3, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00,
+  0xcf, 0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x4a, 0x70, 0x8a, 0x23, 0xa7, 0x08, 0xa3,
+  0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40,
+  0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8,
+  0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7,
+  0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe,
+  0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a,
+  0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2,
+  0x00, 0x00, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x17, 0x30, 0x47, 0x01, 0x73,
+  0x04, 0x71, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79,
+  0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60,
+  0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08,
+  0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01,
+  0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x20, 0x03, 0x10, 0x00, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0xaf, 0xe0, 0x00,
+  0x09, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x0b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x4a,
+  0x70, 0x00, 0x03, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x79, 0x20, 0x00, 0x00, 0x00, 0x29,
+  0x60, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x00, 0x01, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x6f, 0xe1, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0xce, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x17, 0x30, 0x47,
+  0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00,
+  0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x01, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x12, 0x85, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b,
+  0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00,
+  0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x56, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x46, 0x00, 0x31, 0x02, 0x30, 0x03, 0x20,
+  0xaf, 0xe3, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x8f, 0xf1, 0xcf, 0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa,
+  0xaf, 0xf3, 0x4a, 0x70, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x3a, 0x80, 0x00, 0x00, 0x79, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xef,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xce, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x30, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00, 0xcf, 0x30,
+  0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x0d, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x80, 0x39,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f,
+  0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x50, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x0e, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00,
+  0x00, 0x31, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x8f, 0xf1, 0xcf,
+  0xf1, 0x00, 0x0b, 0xff, 0x20, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x3a,
+  0x80, 0x39, 0x50, 0x00, 0x02, 0x96, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10,
+  0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe0,
+  0x00, 0x08, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x18, 0x50,
+  0x16, 0x20, 0x00, 0x01, 0x63, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00,
+  0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x10, 0x00, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x40, 0x00, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x03,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3a, 0x80, 0x00, 0x00, 0x79, 0x20, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80,
+  0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x01, 0xef, 0x50, 0x00, 0x1e, 0xf6, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x40, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3a, 0x80, 0x39, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0xc0, 0x9f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b,
+  0x70, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04,
+  0x71, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x73, 0x04, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x13, 0xf9, 0x0a, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x52, 0x02, 0x50,
+  0x00, 0x00, 0x03, 0x10, 0x23, 0x00, 0x31, 0x02, 0x30, 0x03, 0x20, 0xaf, 0xe3, 0xff, 0x79, 0xfe,
+  0x2f, 0xf8, 0x8f, 0xf1, 0xcf, 0xf5, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0xaf, 0xf3, 0x4a, 0x70, 0x8a,
+  0x23, 0xa7, 0x08, 0xa3, 0x3a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x8b, 0x12, 0xb7, 0x08, 0xb2,
+  0x2b, 0x70, 0x7f, 0xb0, 0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x17, 0x30, 0x47, 0x01, 0x73,
+  0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x00, 0x02, 0xde, 0x70, 0x00, 0x00, 0x00, 0x06, 0xff, 0xd0,
+  0x00, 0x00, 0x00, 0x02, 0xde, 0x70, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00,
+  0x1c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x20, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x9e, 0x20, 0x8e, 0xc1, 0xef, 0xf5, 0x8e, 0xc1, 0x7e, 0xc1, 0xcf, 0xf4, 0x7e, 0xc1,
+  0x00, 0x00, 0x6e, 0xc0, 0xbf, 0xf2, 0x6e, 0xc0, 0x5e, 0xb0, 0xaf, 0xf1, 0x5e, 0xb0, 0x00, 0x00,
+  0x4e, 0xa0, 0x9f, 0xf0, 0x5e, 0xa0, 0x16, 0x30, 0x7f, 0xd0, 0x4e, 0xa0, 0x00, 0x00, 0x2b, 0x60,
+  0x6f, 0xc0, 0x3e, 0x90, 0x2d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x7e, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xce, 0x50, 0x00, 0x00, 0x00, 0x02, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe2,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00,
+  0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80,
+  0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4,
+  0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00,
+  0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80,
+  0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4,
+  0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xf4, 0x4f, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x40,
+  0x00, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0x80, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x31, 0x03, 0x70, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa,
+  0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x8f, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x6f,
+  0xa0, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x9f, 0xe1, 0xff, 0x78, 0xff, 0x1f, 0xf7, 0x7f,
+  0xf1, 0x28, 0x50, 0x68, 0x12, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd0,
+  0x17, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05, 0x72,
+  0x27, 0x50, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0xbf, 0xf4, 0x00, 0x06, 0xff, 0xcd, 0xff,
+  0xaf, 0xfd, 0xdf, 0xf5, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x5c, 0xa1, 0x6d, 0xa0, 0x00,
+  0x05, 0xca, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x0c, 0xff, 0x40, 0x00, 0x00, 0x00, 0xbf,
+  0xe1, 0x00, 0x0a, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x17, 0x30, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0xe0, 0x00, 0x09, 0xfe, 0x10, 0x00, 0x00, 0x00, 0xcf, 0xf1, 0x00, 0x0b, 0xff, 0x20,
+  0x00, 0x00, 0x00, 0x4a, 0x70, 0x00, 0x03, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x39, 0x50, 0x79, 0x22,
+  0x96, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf3, 0xff, 0x8a, 0xff, 0x3f, 0xf9, 0x9f, 0xf2, 0x8f, 0xc1,
+  0xef, 0x57, 0xfd, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x11, 0x00, 0x20, 0x01, 0x20, 0x02, 0x10,
+  0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x08, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x01, 0x63,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xa0, 0x00,
+  0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x60, 0x00, 0x02, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x7f, 0xb0, 0x00, 0x06, 0xfc, 0x0d, 0xf5, 0x5f,
+  0xd0, 0x17, 0x30, 0x00, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x56, 0x12, 0x74, 0x05,
+  0x72, 0x00, 0x00, 0x00, 0x05, 0xff, 0xac, 0xff, 0x7f, 0xfb, 0x00, 0x00, 0x00, 0x06, 0xff, 0xcd,
+  0xff, 0xaf, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xab, 0x45, 0xc9, 0x1a, 0xc5, 0x00, 0x00, 0x6d, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xa1, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4,
+  0xbf, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2, 0x17, 0x30, 0x00, 0x00, 0x00, 0x02, 0x30,
+  0x07, 0x30, 0xaf, 0xe0, 0x00, 0x00, 0x00, 0x2f, 0xf8, 0x8f, 0xf1, 0xcf, 0xf1, 0x00, 0x00, 0x00,
+  0x3f, 0xfa, 0xaf, 0xf3, 0x4a, 0x70, 0x00, 0x00, 0x00, 0x08, 0xa3, 0x3a, 0x80, 0x39, 0x50, 0x00,
+  0x02, 0x96, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00, 0x9f, 0xf2, 0x8f,
+  0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02,
+  0x10, 0x6f, 0xa0, 0xce, 0x40, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x9f, 0xe1, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x7f, 0xf1, 0x28, 0x50, 0x68, 0x10, 0x00, 0x00, 0x00, 0x18, 0x50, 0x16, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xbc, 0x40, 0x00, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0, 0x00, 0x4f, 0xfb, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x2f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x31, 0x03,
+  0x70, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x9b,
+  0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x10, 0x00, 0x00, 0xce, 0x45, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x00, 0x01, 0xff, 0x78, 0xff,
+  0x1f, 0xf7, 0x7f, 0xf1, 0x00, 0x00, 0x68, 0x12, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x5f,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef, 0x46, 0xfc, 0x0d,
+  0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00, 0x23, 0x00,
+  0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x04,
+  0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3, 0x00, 0x00,
+  0x39, 0x50, 0x00, 0x02, 0x96, 0x00, 0x00, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x0a, 0xff, 0x10, 0x00,
+  0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x6f, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x0c, 0xf4, 0x4f, 0xc0, 0x9f, 0xe0, 0x00,
+  0x08, 0xff, 0x1f, 0xf7, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02, 0x85, 0x05, 0x81, 0x18, 0x50, 0x16,
+  0x20, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00,
+  0x00, 0x5f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x2b, 0x70, 0x00, 0x00, 0xef, 0x46,
+  0xfc, 0x0d, 0xf5, 0x5f, 0xd0, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x17, 0x40, 0x00, 0x00,
+  0x23, 0x00, 0x31, 0x02, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff, 0x79, 0xfe, 0x2f, 0xf8, 0x00, 0x00,
+  0x00, 0x04, 0xff, 0x9b, 0xff, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x23, 0xa7, 0x08, 0xa3,
+  0x00, 0x00, 0x39, 0x50, 0x00, 0x00, 0x00, 0x06, 0x92, 0x29, 0x60, 0xbf, 0xf0, 0x00, 0x00, 0x00,
+  0x2f, 0xf9, 0x9f, 0xf2, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x6f, 0xe1, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x20, 0x02, 0x10, 0x6f, 0xa0, 0x00, 0x05, 0xfb, 0x00, 0x00, 0x4f, 0xc0, 0x9f,
+  0xe0, 0x00, 0x08, 0xff, 0x00, 0x00, 0x7f, 0xf1, 0x28, 0x50, 0x00, 0x02, 0x85, 0x00, 0x00, 0x18,
+  0x50, 0x16, 0x20, 0x35, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x8f, 0xc0, 0xff, 0x50, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x5f, 0xa0, 0xcf, 0x30, 0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x12, 0xb7, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x46, 0xfc, 0x0d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x73, 0x04, 0x71, 0x00, 0x00,
+};
+
+static const bfont_glyph bfont_atomicclockradio_glyphs[]=
+{
+  {0,0,0,0,20,1,0},    // minx, maxy, w, h, advance, provided, offset
+  {3,23,8,25,20,1,0},
+  {3,22,11,10,20,1,100},
+  {0,23,18,25,20,1,160},
+  {0,23,18,25,20,1,385},
+  {0,23,18,25,20,1,610},
+  {0,23,18,25,20,1,835},
+  {7,22,4,10,20,1,1060},
+  {7,22,7,24,20,1,1080},
+  {3,22,8,24,20,1,1176},
+  {3,15,11,10,20,1,1272},
+  {3,15,11,10,20,1,1332},
+  {3,4,7,9,20,1,1392},
+  {3,12,11,3,20,1,1428},
+  {3,4,7,6,20,1,1446},
+  {0,19,18,17,20,1,1470},
+  {0,23,18,25,20,1,1623},
+  {3,23,11,25,20,1,1848},
+  {0,23,18,25,20,1,1998},
+  {0,23,18,25,20,1,2223},
+  {0,23,18,25,20,1,2448},
+  {0,23,18,25,20,1,2673},
+  {0,23,18,25,20,1,2898},
+  {0,23,18,25,20,1,3123},
+  {0,23,18,25,20,1,3348},
+  {0,23,18,25,20,1,3573},
+  {7,19,7,17,20,1,3798},
+  {7,19,7,21,20,1,3866},
+  {3,19,11,17,20,1,3950},
+  {3,15,11,10,20,1,4052},
+  {3,19,11,17,20,1,4112},
+  {0,23,18,25,20,1,4214},
+  {0,23,18,25,20,1,4439},
+  {0,23,18,25,20,1,4664},
+  {0,23,18,25,20,1,4889},
+  {0,23,18,25,20,1,5114},
+  {0,23,18,25,20,1,5339},
+  {0,23,18,25,20,1,5564},
+  {0,23,18,25,20,1,5789},
+  {0,23,18,25,20,1,6014},
+  {0,23,18,25,20,1,6239},
+  {3,23,11,25,20,1,6464},
+  {0,23,18,25,20,1,6614},
+  {0,23,18,25,20,1,6839},
+  {0,23,17,25,20,1,7064},
+  {0,23,18,25,20,1,7289},
+  {0,23,18,25,20,1,7514},
+  {0,23,18,25,20,1,7739},
+  {0,23,18,25,20,1,7964},
+  {0,23,18,25,20,1,8189},
+  {0,23,18,25,20,1,8414},
+  {0,23,18,25,20,1,8639},
+  {0,23,18,25,20,1,8864},
+  {0,23,18,25,20,1,9089},
+  {0,23,18,25,20,1,9314},
+  {0,23,18,25,20,1,9539},
+  {0,23,18,25,20,1,9764},
+  {0,23,18,25,20,1,9989},
+  {0,23,18,25,20,1,10214},
+  {7,23,7,25,20,1,10439},
+  {0,19,17,17,20,1,10539},
+  {3,23,8,25,20,1,10692},
+  {3,22,11,6,20,1,10792},
+  {0,1,17,3,20,1,10828},
+  {3,22,8,6,20,1,10855},
+  {0,16,18,18,20,1,10879},
+  {0,23,18,25,20,1,11041},
+  {0,16,18,18,20,1,11266},
+  {0,23,18,25,20,1,11428},
+  {0,16,18,18,20,1,11653},
+  {3,23,11,25,20,1,11815},
+  {0,16,18,25,20,1,11965},
+  {0,23,18,25,20,1,12190},
+  {3,23,11,25,20,1,12415},
+  {3,23,8,32,20,1,12565},
+  {0,23,18,25,20,1,12693},
+  {3,23,11,25,20,1,12918},
+  {0,16,18,18,20,1,13068},
+  {0,16,18,18,20,1,13230},
+  {0,16,18,18,20,1,13392},
+  {0,16,18,25,20,1,13554},
+  {0,16,18,25,20,1,13779},
+  {0,16,18,18,20,1,14004},
+  {0,16,17,18,20,1,14166},
+  {0,23,18,25,20,1,14328},
+  {0,16,18,18,20,1,14553},
+  {0,16,18,18,20,1,14715},
+  {0,16,18,18,20,1,14877},
+  {0,16,18,18,20,1,15039},
+  {0,16,18,25,20,1,15201},
+  {0,16,18,18,20,1,15426},
+  {3,22,11,24,20,1,15588},
+  {7,22,4,24,20,1,15732},
+  {3,22,11,24,20,1,15780},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {0,23,18,25,20,1,16056},
+  {0,23,18,25,20,1,16281},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {0,23,18,25,20,1,16506},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {0,23,18,25,20,1,16731},
+  {0,16,18,18,20,1,16956},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {0,16,18,18,20,1,17118},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+  {1,22,12,22,14,0,15924},
+};
+
+static const bfont_kern bfont_atomicclockradio_kern[]=
+{
+  {0,0,0}
+};
+
+static const bfont bfont_atomicclockradio=
+{
+  28,23,-8,32,31,    // size, ascent, descent, height, lineskip
+  32,383,126,    // first, last, missing
+  bfont_atomicclockradio_glyphs,
+  bfont_atomicclockradio_bits,
+  bfont_atomicclockradio_kern,
+  0
+};
+
+#endif
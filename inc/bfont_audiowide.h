@@ -0,0 +1,3679 @@
+#ifndef BFONT_AUDIOWIDE_H
+#define BFONT_AUDIOWIDE_H
+
+// generated by tools/bakefont from media/Audiowide-Regular.ttf at 18 pt, don't edit
+
+#include "bitmap_font.h"
+
+static const Uint8 bfont_audiowide_bits[]=
+{
+  0x99, 0x60, 0xef, 0x90, 0xdf, 0x80, 0xcf, 0x70, 0xbf, 0x70, 0xaf, 0x60, 0xaf, 0x50, 0x9f, 0x40,
+  0x8f, 0x30, 0x6e, 0x20, 0x13, 0x00, 0xaf, 0x50, 0x7e, 0x30, 0x01, 0x10, 0x11, 0x00, 0x2f, 0xe1,
+  0xff, 0x00, 0x1f, 0xd0, 0xfe, 0x00, 0x0f, 0xc0, 0xdd, 0x00, 0x0d, 0xb0, 0xcc, 0x00, 0x05, 0x40,
+  0x44, 0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00, 0x7f, 0xa0, 0x2f, 0xf0, 0x00,
+  0x00, 0x00, 0xbf, 0x60, 0x6f, 0xc0, 0x00, 0x00, 0x23, 0xef, 0x53, 0xaf, 0xa3, 0x10, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0x04, 0xde, 0xfe, 0xdd, 0xff, 0xdd, 0x20, 0x00, 0x09, 0xf8, 0x04,
+  0xfd, 0x00, 0x00, 0x00, 0x0c, 0xf5, 0x07, 0xfa, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x01, 0x8f, 0xa1, 0x3f, 0xf1, 0x10, 0x00, 0x00,
+  0xaf, 0x70, 0x5f, 0xc0, 0x00, 0x00, 0x00, 0xef, 0x30, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x02, 0x97,
+  0x00, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x18, 0xfd, 0x66, 0x00, 0x04, 0xef, 0xff, 0xfd,
+  0x00, 0x0d, 0xfc, 0x99, 0x98, 0x00, 0x3f, 0xf5, 0x55, 0x55, 0x20, 0x5f, 0xff, 0xff, 0xff, 0xd0,
+  0x1a, 0xbb, 0xbb, 0xcf, 0xc0, 0x01, 0x44, 0x44, 0xbf, 0x90, 0x05, 0xff, 0xff, 0xfe, 0x20, 0x04,
+  0xcd, 0xfe, 0xa3, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x14,
+  0x20, 0x00, 0x01, 0x76, 0x00, 0x00, 0x05, 0xef, 0xfa, 0x00, 0x09, 0xf7, 0x00, 0x00, 0x1e, 0xe9,
+  0xdf, 0x60, 0x3f, 0xd0, 0x00, 0x00, 0x4f, 0x90, 0x4f, 0x90, 0xcf, 0x50, 0x00, 0x00, 0x2f, 0xd4,
+  0xaf, 0x75, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xff, 0xfd, 0x1d, 0xf3, 0x02, 0x10, 0x00, 0x00, 0x59,
+  0x71, 0x7f, 0x92, 0xcf, 0xfa, 0x10, 0x00, 0x00, 0x02, 0xee, 0x1b, 0xfc, 0xdf, 0x80, 0x00, 0x00,
+  0x0a, 0xf7, 0x0f, 0xd0, 0x1f, 0xc0, 0x00, 0x00, 0x3f, 0xd0, 0x0e, 0xe3, 0x5f, 0xb0, 0x00, 0x00,
+  0xcf, 0x50, 0x07, 0xff, 0xff, 0x40, 0x00, 0x04, 0xdb, 0x00, 0x00, 0x5a, 0xa4, 0x00, 0x00, 0x57,
+  0x77, 0x77, 0x20, 0x00, 0x2d, 0xff, 0xff, 0xff, 0x50, 0x00, 0xbf, 0xd9, 0x99, 0x99, 0x30, 0x00,
+  0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa5, 0x55, 0x10, 0x00, 0x00, 0x5f, 0xff, 0xff, 0x40,
+  0x00, 0x00, 0xaf, 0xeb, 0xbb, 0x30, 0x14, 0x20, 0xdf, 0x40, 0x00, 0x03, 0xef, 0x60, 0xef, 0x30,
+  0x00, 0x0a, 0xfd, 0x50, 0xcf, 0x83, 0x33, 0x4e, 0xf4, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xd0, 0x00,
+  0x05, 0xcd, 0xdd, 0xd9, 0x10, 0x00, 0x01, 0x10, 0x2f, 0xe0, 0x1f, 0xd0, 0x0f, 0xc0, 0x0d, 0xb0,
+  0x05, 0x40, 0x00, 0x00, 0x78, 0x82, 0x00, 0x06, 0xff, 0x80, 0x00, 0x2f, 0xfa, 0x00, 0x00, 0xbf,
+  0xd1, 0x00, 0x04, 0xff, 0x50, 0x00, 0x0a, 0xfc, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x3f, 0xf2,
+  0x00, 0x00, 0x4f, 0xf0, 0x00, 0x00, 0x4f, 0xf1, 0x00, 0x00, 0x1f, 0xf4, 0x00, 0x00, 0x0c, 0xfa,
+  0x00, 0x00, 0x06, 0xff, 0x20, 0x00, 0x01, 0xef, 0xa0, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x00, 0x0b,
+  0xfe, 0x30, 0x00, 0x01, 0xde, 0xd2, 0x58, 0x84, 0x00, 0x00, 0x1c, 0xfe, 0x20, 0x00, 0x02, 0xef,
+  0xc0, 0x00, 0x00, 0x4f, 0xf6, 0x00, 0x00, 0x0a, 0xfe, 0x00, 0x00, 0x02, 0xff, 0x50, 0x00, 0x00,
+  0xbf, 0xa0, 0x00, 0x00, 0x6f, 0xd0, 0x00, 0x00, 0x5f, 0xf0, 0x00, 0x00, 0x5f, 0xe0, 0x00, 0x00,
+  0x9f, 0xc0, 0x00, 0x01, 0xef, 0x70, 0x00, 0x07, 0xff, 0x20, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0xbf,
+  0xe2, 0x00, 0x08, 0xff, 0x60, 0x00, 0x6e, 0xe9, 0x00, 0x00, 0x00, 0x09, 0x70, 0x00, 0x05, 0x0f,
+  0xc0, 0x50, 0x8f, 0xaf, 0xdc, 0xf5, 0x3d, 0xff, 0xff, 0xa1, 0x02, 0xef, 0xfc, 0x00, 0x4d, 0xff,
+  0xff, 0xc2, 0x7f, 0x9f, 0xdb, 0xf4, 0x04, 0x0f, 0xc0, 0x40, 0x00, 0x08, 0x60, 0x00, 0x00, 0x01,
+  0x66, 0x00, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x15, 0x57, 0xfe,
+  0x55, 0x50, 0x4f, 0xff, 0xff, 0xff, 0xf0, 0x3b, 0xbc, 0xff, 0xbb, 0xa0, 0x00, 0x03, 0xfd, 0x00,
+  0x00, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x00, 0x00, 0x0a, 0xc3, 0x0f, 0xe0, 0x3f,
+  0xa0, 0x6f, 0x50, 0x59, 0x10, 0x55, 0x55, 0x55, 0x55, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0xbb,
+  0xbb, 0xbb, 0xbb, 0x30, 0x03, 0x10, 0x3f, 0xd0, 0x1d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x49, 0x90,
+  0x00, 0x00, 0x00, 0x01, 0xef, 0x70, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0xf3, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0x00, 0x00, 0x08, 0xfd, 0x10, 0x00, 0x00, 0x00,
+  0x3f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa0, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x10, 0x00, 0x00,
+  0x00, 0x2e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0x00, 0x00, 0x05, 0xff, 0x30, 0x00,
+  0x00, 0x00, 0x1d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x89, 0x99, 0x99, 0x72, 0x00, 0x00,
+  0x02, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1d, 0xff, 0xca, 0xaa, 0xab, 0xef, 0xf8, 0x00,
+  0x8f, 0xf5, 0x00, 0x00, 0x02, 0x7a, 0xff, 0x20, 0xdf, 0x80, 0x00, 0x00, 0x7e, 0xf8, 0xdf, 0x80,
+  0xff, 0x50, 0x00, 0x2c, 0xff, 0xd3, 0xaf, 0xa0, 0xff, 0x40, 0x07, 0xef, 0xf9, 0x10, 0x9f, 0xa0,
+  0xff, 0x42, 0xcf, 0xfd, 0x40, 0x00, 0x9f, 0xa0, 0xef, 0x7c, 0xff, 0x91, 0x00, 0x00, 0xcf, 0x80,
+  0xaf, 0xd8, 0xc4, 0x00, 0x00, 0x03, 0xff, 0x50, 0x3f, 0xfd, 0x64, 0x44, 0x45, 0x8e, 0xfd, 0x00,
+  0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x3a, 0xef, 0xff, 0xff, 0xd8, 0x10, 0x00,
+  0x39, 0x99, 0x90, 0x6f, 0xff, 0xf0, 0x4a, 0xcf, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00,
+  0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f,
+  0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x5f, 0xf0, 0x00, 0x99, 0x99, 0x99, 0x99, 0x50, 0x00, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xac, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x70, 0x00, 0x15, 0x77, 0x77, 0x78, 0xff,
+  0x60, 0x03, 0xef, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0c, 0xfe, 0xdd, 0xdd, 0xdc, 0x91, 0x00, 0x1f,
+  0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf7, 0x44,
+  0x44, 0x44, 0x44, 0x20, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x80, 0x89, 0x99, 0x99, 0x99, 0x61, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x9a, 0xaa,
+  0xaa, 0xab, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0,
+  0x67, 0x77, 0x77, 0x77, 0xcf, 0xb0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xad, 0xdd, 0xdd, 0xdd,
+  0xef, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb0, 0x34, 0x44,
+  0x44, 0x45, 0xdf, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff, 0xff, 0xff, 0xc5, 0x00,
+  0x09, 0x92, 0x00, 0x00, 0x00, 0x79, 0x50, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x1f, 0xf4,
+  0x00, 0x00, 0x00, 0xcf, 0x80, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x1f, 0xf4, 0x00, 0x00,
+  0x00, 0xcf, 0x80, 0x1f, 0xf9, 0x77, 0x77, 0x77, 0xdf, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0x09, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x89, 0x99, 0x99, 0x99, 0x99,
+  0x60, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xca, 0xaa, 0xaa, 0xaa, 0x70, 0xdf, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xd7, 0x77, 0x77, 0x64, 0x00, 0x4f,
+  0xff, 0xff, 0xff, 0xff, 0xa0, 0x04, 0xbd, 0xdd, 0xdd, 0xdf, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x44, 0x44, 0x44, 0x44, 0x5d, 0xf9, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xf3, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x00, 0x37, 0x99, 0x99, 0x99, 0x00, 0x08,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x5f, 0xfd, 0xaa, 0xaa, 0xaa, 0x00, 0xbf, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0xa7, 0x77, 0x77, 0x63, 0x00, 0xef, 0xff, 0xff,
+  0xff, 0xff, 0xa0, 0xef, 0xed, 0xdd, 0xdd, 0xef, 0xf6, 0xef, 0x50, 0x00, 0x00, 0x0b, 0xf9, 0xcf,
+  0x80, 0x00, 0x00, 0x0a, 0xfa, 0x9f, 0xf7, 0x44, 0x44, 0x5e, 0xf8, 0x1d, 0xff, 0xff, 0xff, 0xff,
+  0xf2, 0x01, 0x9e, 0xff, 0xff, 0xfc, 0x40, 0x49, 0x99, 0x99, 0x99, 0x99, 0x60, 0x6f, 0xff, 0xff,
+  0xff, 0xff, 0xf1, 0x4a, 0xaa, 0xaa, 0xab, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x07, 0xff, 0x30, 0x00,
+  0x00, 0x00, 0x2e, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe1, 0x00, 0x00, 0x00, 0x03, 0xff, 0x60,
+  0x00, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf4, 0x00, 0x00, 0x00, 0x01, 0xef,
+  0xa0, 0x00, 0x00, 0x00, 0x08, 0xff, 0x20, 0x00, 0x00, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x79, 0x99, 0x95, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff,
+  0xff, 0xa0, 0x00, 0x00, 0xdf, 0xea, 0xaa, 0xcf, 0xf4, 0x00, 0x00, 0xff, 0x50, 0x00, 0x0d, 0xf7,
+  0x00, 0x01, 0xff, 0x40, 0x00, 0x0d, 0xf7, 0x00, 0x00, 0xef, 0xc7, 0x77, 0x8f, 0xf5, 0x00, 0x03,
+  0xef, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x0c, 0xff, 0xdd, 0xdd, 0xde, 0xff, 0x40, 0x1f, 0xf5, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0xcf, 0x70, 0x0f, 0xfa, 0x44, 0x44, 0x45,
+  0xff, 0x60, 0x09, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x00, 0x8e, 0xff, 0xff, 0xff, 0xb3, 0x00,
+  0x00, 0x48, 0x99, 0x99, 0x85, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x1f, 0xfd,
+  0xaa, 0xaa, 0xcf, 0xfb, 0x00, 0x3f, 0xf1, 0x00, 0x00, 0x06, 0xff, 0x20, 0x4f, 0xf1, 0x00, 0x00,
+  0x00, 0xff, 0x40, 0x2f, 0xfa, 0x77, 0x77, 0x77, 0xff, 0x50, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x50, 0x00, 0x7c, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x34, 0x44, 0x44, 0x6d, 0xfe, 0x10, 0x00, 0x9f, 0xff,
+  0xff, 0xff, 0xf5, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xeb, 0x40, 0x00, 0x36, 0x00, 0xdf, 0x40, 0x7a,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xcf, 0x30, 0xad, 0x20, 0x02,
+  0x61, 0x0a, 0xf7, 0x05, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc4, 0x0d,
+  0xf2, 0x1f, 0xc0, 0x4f, 0x70, 0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xfd,
+  0x20, 0x00, 0x06, 0xff, 0xc1, 0x00, 0x00, 0x8f, 0xfb, 0x10, 0x00, 0x09, 0xff, 0x90, 0x00, 0x00,
+  0x5f, 0xfa, 0x00, 0x00, 0x00, 0x1d, 0xfe, 0x40, 0x00, 0x00, 0x01, 0xcf, 0xf6, 0x00, 0x00, 0x00,
+  0x1b, 0xff, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xfa, 0x00, 0x00, 0x00, 0x04, 0x44, 0x20, 0x56, 0x66,
+  0x66, 0x66, 0x30, 0xcf, 0xff, 0xff, 0xff, 0x70, 0x8a, 0xaa, 0xaa, 0xaa, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x44, 0x44, 0x44, 0x20, 0xcf, 0xff, 0xff, 0xff, 0x70, 0xac, 0xcc, 0xcc, 0xcc,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x6f, 0xfc, 0x10, 0x00,
+  0x00, 0x05, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x4e, 0xfd, 0x30, 0x00, 0x00, 0x03, 0xff, 0xb0, 0x00,
+  0x00, 0x1b, 0xff, 0x60, 0x00, 0x02, 0xcf, 0xf6, 0x00, 0x00, 0x3d, 0xfe, 0x40, 0x00, 0x04, 0xef,
+  0xd3, 0x00, 0x00, 0x04, 0x44, 0x10, 0x00, 0x00, 0x39, 0x99, 0x99, 0x99, 0x83, 0x00, 0x5f, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x3a, 0xaa, 0xaa, 0xaa, 0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0x00, 0x00, 0x57, 0x77, 0xaf, 0xf1, 0x00, 0x02, 0xff, 0xff,
+  0xff, 0x90, 0x00, 0x03, 0xff, 0xdd, 0xc7, 0x00, 0x00, 0x03, 0xff, 0x10, 0x00, 0x00, 0x00, 0x03,
+  0xee, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xdb, 0x00, 0x00, 0x00, 0x06, 0xcc, 0xcc, 0xcb, 0x60, 0x6f, 0xdc, 0xcc, 0xcd, 0xf7,
+  0xcd, 0x0b, 0xcc, 0xa3, 0xcd, 0xdb, 0x0b, 0xcc, 0xec, 0xae, 0xdb, 0x19, 0xb9, 0xbe, 0xae, 0xdb,
+  0xaf, 0xdb, 0xbe, 0xae, 0xdb, 0xbe, 0xaa, 0xef, 0xdd, 0xdc, 0x3d, 0xee, 0xee, 0xd5, 0x8f, 0xb9,
+  0x00, 0x00, 0x00, 0x09, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58,
+  0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06, 0xff, 0xfc, 0xaa, 0xaa,
+  0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x96,
+  0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xee, 0xee, 0xee,
+  0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x29, 0x99, 0x99, 0x99, 0x98, 0x30, 0x00, 0xaf,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0xaf, 0xda, 0xaa, 0xaa, 0xad, 0xfc, 0x00, 0xaf, 0x90, 0x00,
+  0x00, 0x07, 0xfd, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x0a, 0xfb, 0x00, 0xaf, 0x93, 0x77, 0x77, 0xaf,
+  0xf6, 0x00, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xf6, 0x00, 0xaf, 0x96, 0xdd, 0xdd, 0xdf, 0xff, 0x40,
+  0xaf, 0x90, 0x00, 0x00, 0x01, 0xcf, 0xa0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0xaf, 0xb4,
+  0x44, 0x44, 0x44, 0x9f, 0xd0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0xe9, 0x10, 0x01, 0x79, 0x99, 0x99, 0x99, 0x96, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f,
+  0xeb, 0xaa, 0xaa, 0xaa, 0xa6, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xc5, 0x44, 0x44, 0x44, 0x43, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf, 0xff, 0xff, 0xff,
+  0xf9, 0x29, 0x99, 0x99, 0x99, 0x84, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0xaf,
+  0xda, 0xaa, 0xab, 0xdf, 0xfd, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x05, 0xff, 0x70, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0xaf, 0xb0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0xaf, 0x90, 0x00, 0x00, 0x00,
+  0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x8f, 0xc0,
+  0xaf, 0x90, 0x00, 0x00, 0x01, 0xdf, 0x90, 0xaf, 0xb4, 0x44, 0x44, 0x7d, 0xff, 0x30, 0xaf, 0xff,
+  0xff, 0xff, 0xff, 0xf6, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00, 0x39, 0x99, 0x99, 0x99,
+  0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa, 0xa7, 0xbf, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77, 0x77, 0x77, 0x50,
+  0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44, 0x43, 0x4f, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x29, 0x99, 0x99, 0x99, 0x99, 0x97,
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0xda, 0xaa, 0xaa, 0xaa, 0xa8, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x93, 0x77, 0x77, 0x77, 0x50, 0xaf, 0x97,
+  0xff, 0xff, 0xff, 0xb0, 0xaf, 0x96, 0xdd, 0xdd, 0xdd, 0xa0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x99, 0x60, 0x2e,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0x70, 0xcf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x47, 0x77, 0x77,
+  0x77, 0x20, 0xdf, 0x70, 0x9f, 0xff, 0xff, 0xff, 0xb0, 0xdf, 0x70, 0x8d, 0xdd, 0xdd, 0xef, 0xc0,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xbf, 0xc5,
+  0x44, 0x44, 0x44, 0xaf, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x06, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0x70, 0x69, 0x60, 0x00, 0x00, 0x00, 0x39, 0x90, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f,
+  0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf,
+  0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xc7, 0x77, 0x77, 0x77, 0xaf, 0xe0, 0xaf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0xaf, 0xed, 0xdd, 0xdd, 0xdd, 0xdf, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00,
+  0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0x69, 0x60,
+  0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90,
+  0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xfe, 0x34, 0x44, 0x44, 0x44, 0x4b, 0xfc, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0xaf, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x69, 0x60, 0x00, 0x00, 0x01, 0x89, 0x92, 0xaf, 0x90, 0x00,
+  0x00, 0x1b, 0xff, 0x60, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xf6, 0x00, 0xaf, 0x90, 0x00, 0x1b, 0xff,
+  0x50, 0x00, 0xaf, 0x90, 0x01, 0xbf, 0xf5, 0x00, 0x00, 0xaf, 0x93, 0x7c, 0xff, 0x50, 0x00, 0x00,
+  0xaf, 0x97, 0xff, 0xf5, 0x00, 0x00, 0x00, 0xaf, 0x96, 0xde, 0xfc, 0x10, 0x00, 0x00, 0xaf, 0x90,
+  0x04, 0xef, 0xc1, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x4e, 0xfd, 0x10, 0x00, 0xaf, 0x90, 0x00, 0x04,
+  0xef, 0xd2, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x4e, 0xfd, 0x20, 0xaf, 0x90, 0x00, 0x00, 0x04, 0xef,
+  0xd2, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb4, 0x44,
+  0x44, 0x44, 0x44, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3b,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x70, 0xaf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf0, 0xaf,
+  0xf7, 0x00, 0x00, 0x00, 0x02, 0xff, 0xf0, 0xaf, 0xfe, 0x10, 0x00, 0x00, 0x0b, 0xff, 0xf0, 0xaf,
+  0xff, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xf0, 0xaf, 0xef, 0xf3, 0x00, 0x00, 0xdf, 0xef, 0xf0, 0xaf,
+  0x9c, 0xfb, 0x00, 0x07, 0xff, 0x7f, 0xf0, 0xaf, 0x94, 0xff, 0x50, 0x1e, 0xf8, 0x5f, 0xf0, 0xaf,
+  0x90, 0xaf, 0xd0, 0x9f, 0xe1, 0x5f, 0xf0, 0xaf, 0x90, 0x2f, 0xf9, 0xff, 0x60, 0x5f, 0xf0, 0xaf,
+  0x90, 0x08, 0xff, 0xfd, 0x00, 0x5f, 0xf0, 0xaf, 0x90, 0x01, 0xef, 0xf4, 0x00, 0x5f, 0xf0, 0xaf,
+  0x90, 0x00, 0x5f, 0xa0, 0x00, 0x5f, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x4b,
+  0x40, 0x00, 0x00, 0x00, 0x39, 0x80, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe, 0x30,
+  0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xff, 0xe3, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20, 0x00,
+  0x5f, 0xe0, 0xaf, 0x92, 0xef, 0xd2, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x5f, 0xe0,
+  0xaf, 0x90, 0x03, 0xef, 0xd1, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf, 0x90,
+  0x00, 0x04, 0xff, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00,
+  0x05, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1,
+  0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff,
+  0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff,
+  0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00,
+  0x00, 0x00, 0x69, 0x99, 0x99, 0x97, 0x30, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x8f,
+  0xfb, 0xaa, 0xaa, 0xad, 0xff, 0x40, 0xaf, 0xa0, 0x00, 0x00, 0x00, 0xcf, 0xa0, 0xbf, 0x90, 0x00,
+  0x00, 0x00, 0x7f, 0xd0, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0xbf, 0x90, 0x00, 0x00, 0x00,
+  0x9f, 0xc0, 0xbf, 0x93, 0x66, 0x66, 0x69, 0xff, 0x70, 0xbf, 0x98, 0xff, 0xff, 0xff, 0xfc, 0x10,
+  0xbf, 0x97, 0xee, 0xee, 0xec, 0x71, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc,
+  0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88,
+  0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22,
+  0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x07, 0xdf, 0xff,
+  0xff, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x02, 0x33, 0x4e, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xce, 0xe6, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x94, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0xaf, 0xda, 0xaa, 0xaa, 0xaa, 0xdf, 0xc0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x9f, 0xc0, 0xaf, 0x93,
+  0x66, 0x66, 0x6a, 0xff, 0x70, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xaf, 0x96, 0xdf, 0xff,
+  0xfc, 0x70, 0x00, 0xaf, 0x90, 0x03, 0xef, 0xf6, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x2c, 0xff, 0x80,
+  0x00, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xfa, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x09, 0xff, 0xc1, 0x00,
+  0x16, 0x99, 0x99, 0x99, 0x99, 0x30, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0c, 0xfe, 0xba,
+  0xaa, 0xaa, 0xaa, 0x30, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xfc, 0x77, 0x77, 0x77, 0x51, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+  0x00, 0x3a, 0xcd, 0xdd, 0xdd, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xf6, 0x04, 0x44, 0x44, 0x44, 0x44, 0x8f, 0xf3, 0x1f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x70, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7a, 0xaa, 0xad, 0xfe, 0xaa, 0xaa, 0x70, 0x00,
+  0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xfa, 0x00, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef,
+  0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44,
+  0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60,
+  0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0x79, 0x70, 0x08, 0xfe, 0x10, 0x00, 0x00, 0x02, 0xff, 0x60,
+  0x01, 0xef, 0x80, 0x00, 0x00, 0x0a, 0xfd, 0x00, 0x00, 0x8f, 0xe1, 0x00, 0x00, 0x2f, 0xf6, 0x00,
+  0x00, 0x1e, 0xf8, 0x00, 0x00, 0x9f, 0xd0, 0x00, 0x00, 0x08, 0xfe, 0x10, 0x02, 0xff, 0x60, 0x00,
+  0x00, 0x01, 0xef, 0x70, 0x09, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xe1, 0x2f, 0xf7, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0xf7, 0x9f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfe, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2e, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x39, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x3f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf3, 0x0f, 0xf5, 0x00, 0x00, 0x56, 0x00, 0x00, 0x4f, 0xf1, 0x0c, 0xf8, 0x00, 0x04, 0xff,
+  0x50, 0x00, 0x7f, 0xd0, 0x0a, 0xfa, 0x00, 0x1d, 0xff, 0xd1, 0x00, 0xaf, 0xa0, 0x07, 0xfd, 0x00,
+  0x8f, 0xff, 0xf9, 0x00, 0xcf, 0x80, 0x04, 0xff, 0x13, 0xff, 0x98, 0xff, 0x30, 0xff, 0x50, 0x01,
+  0xff, 0x4c, 0xfe, 0x11, 0xdf, 0xc3, 0xff, 0x20, 0x00, 0xef, 0xcf, 0xf5, 0x00, 0x5f, 0xfc, 0xfe,
+  0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x0a, 0xff, 0xfc, 0x00, 0x00, 0x8f, 0xff, 0x20, 0x00, 0x02,
+  0xef, 0xf9, 0x00, 0x00, 0x6f, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0xf7, 0x00, 0x00, 0x2e, 0xd1, 0x00,
+  0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x59, 0x95,
+  0x00, 0x00, 0x00, 0x39, 0x97, 0x00, 0x1d, 0xfe, 0x30, 0x00, 0x02, 0xef, 0xe2, 0x00, 0x02, 0xef,
+  0xe2, 0x00, 0x1c, 0xff, 0x40, 0x00, 0x00, 0x4f, 0xfc, 0x10, 0xbf, 0xf6, 0x00, 0x00, 0x00, 0x05,
+  0xff, 0xb9, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xdf, 0xed, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x42, 0xef, 0xd2, 0x00, 0x00, 0x00, 0xaf,
+  0xf6, 0x00, 0x4f, 0xfc, 0x10, 0x00, 0x08, 0xff, 0x80, 0x00, 0x06, 0xff, 0xb0, 0x00, 0x6f, 0xfa,
+  0x00, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x29, 0x90, 0x00, 0x00, 0x00, 0x09, 0x93, 0x4f, 0xf0, 0x00,
+  0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00,
+  0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x2f, 0xf4, 0x00, 0x00, 0x00, 0x3f, 0xf3,
+  0x0d, 0xfe, 0x87, 0x77, 0x78, 0xef, 0xd0, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x29,
+  0xcd, 0xff, 0xdc, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00,
+  0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x96, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x3a,
+  0xaa, 0xaa, 0xaa, 0xdf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00,
+  0x3e, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x02, 0xef, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xfe, 0x30,
+  0x00, 0x00, 0x00, 0x01, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x9f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc4, 0x44, 0x44, 0x44, 0x00, 0x3f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x49, 0xaa, 0x90, 0xcf,
+  0xff, 0xe0, 0xcf, 0xca, 0x90, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70,
+  0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00,
+  0xcf, 0x70, 0x00, 0xcf, 0x70, 0x00, 0xcf, 0x94, 0x30, 0xcf, 0xff, 0xe0, 0x9f, 0xff, 0xe0, 0x01,
+  0x11, 0x10, 0x19, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xef, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xd1, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0,
+  0x4a, 0xaa, 0x81, 0x6f, 0xff, 0xf5, 0x4a, 0xaf, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00,
+  0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e,
+  0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x00, 0x0e, 0xf6, 0x14, 0x4e, 0xf6, 0x5f, 0xff, 0xf6,
+  0x5f, 0xff, 0xe3, 0x01, 0x11, 0x00, 0x00, 0x08, 0x50, 0x00, 0x00, 0xaf, 0xf5, 0x00, 0x08, 0xfe,
+  0xfe, 0x30, 0x6f, 0xf3, 0x8f, 0xe2, 0xbf, 0x50, 0x0a, 0xf7, 0xb7, 0x00, 0x00, 0xb7, 0x50, 0x00,
+  0x00, 0x14, 0xde, 0xee, 0xee, 0xee, 0xee, 0x20, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x07, 0x71, 0x00, 0x1e, 0xfd, 0x50, 0x17, 0xcf, 0xfa, 0x00, 0x02, 0x86,
+  0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa,
+  0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe,
+  0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0,
+  0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x88, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x56, 0x88, 0x87, 0x40, 0x00, 0xff, 0x5c, 0xff, 0xff, 0xfa, 0x00,
+  0xff, 0x59, 0xcc, 0xcd, 0xff, 0x50, 0xff, 0x50, 0x00, 0x00, 0xcf, 0x80, 0xff, 0x50, 0x00, 0x00,
+  0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xdf, 0xb4,
+  0x44, 0x45, 0xef, 0x70, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x07, 0xdf, 0xff, 0xff, 0xc3, 0x00,
+  0x00, 0x26, 0x78, 0x88, 0x88, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0d, 0xfe, 0xcc, 0xcc,
+  0xcc, 0x30, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x44, 0x10,
+  0x09, 0xff, 0xff, 0xff, 0xff, 0x40, 0x01, 0x8e, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x84, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0xf8, 0x00, 0x16, 0x78, 0x88, 0x2c, 0xf8, 0x03, 0xef, 0xff, 0xff, 0x4c, 0xf8,
+  0x0c, 0xfe, 0xcc, 0xcc, 0x3c, 0xf8, 0x0f, 0xf5, 0x00, 0x00, 0x0c, 0xf8, 0x0f, 0xf4, 0x00, 0x00,
+  0x0c, 0xf8, 0x0f, 0xf4, 0x00, 0x00, 0x0c, 0xf8, 0x0f, 0xf4, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xfa,
+  0x44, 0x44, 0x6f, 0xf6, 0x08, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x8e, 0xff, 0xff, 0xfb, 0x30,
+  0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa,
+  0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1,
+  0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00,
+  0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20, 0x00, 0x02, 0x79, 0x99, 0x99,
+  0x50, 0x3e, 0xff, 0xff, 0xff, 0x70, 0xaf, 0xea, 0xaa, 0xaa, 0x50, 0xdf, 0x70, 0x00, 0x00, 0x00,
+  0xdf, 0x65, 0x88, 0x88, 0x40, 0xdf, 0x6a, 0xff, 0xff, 0x70, 0xdf, 0x68, 0xcc, 0xcc, 0x60, 0xdf,
+  0x60, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0d, 0xfe,
+  0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00, 0x00, 0x0e, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44,
+  0x1d, 0xf6, 0x0a, 0xff, 0xff, 0xff, 0x3d, 0xf6, 0x01, 0x9e, 0xff, 0xff, 0x3d, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x22, 0x22, 0x4f, 0xf5, 0x00, 0x00, 0xef, 0xff, 0xff, 0xe1,
+  0x00, 0x00, 0xef, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x22, 0x22, 0x10, 0x00, 0x78, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x65, 0x88, 0x87, 0x40, 0x00, 0xdf, 0x6a, 0xff, 0xff, 0xfb, 0x00,
+  0xdf, 0x68, 0xcc, 0xcd, 0xff, 0x60, 0xdf, 0x60, 0x00, 0x00, 0xbf, 0x90, 0xdf, 0x60, 0x00, 0x00,
+  0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60,
+  0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0,
+  0x78, 0x30, 0xdf, 0x60, 0x78, 0x30, 0x00, 0x00, 0x78, 0x30, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60,
+  0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0x00, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x22, 0x22, 0x4f, 0xf5, 0xef, 0xff, 0xff, 0xe1,
+  0xef, 0xff, 0xfc, 0x30, 0x22, 0x22, 0x10, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x06, 0x88, 0x70, 0xdf, 0x60, 0x01, 0xaf, 0xfc, 0x20, 0xdf, 0x60, 0x2c, 0xff,
+  0xa1, 0x00, 0xdf, 0x64, 0xef, 0xf7, 0x00, 0x00, 0xdf, 0x6e, 0xff, 0x50, 0x00, 0x00, 0xdf, 0x6a,
+  0xff, 0x80, 0x00, 0x00, 0xdf, 0x60, 0xaf, 0xf9, 0x00, 0x00, 0xdf, 0x60, 0x0a, 0xff, 0x90, 0x00,
+  0xdf, 0x60, 0x00, 0x9f, 0xfa, 0x00, 0xdf, 0x60, 0x00, 0x09, 0xff, 0xa0, 0x88, 0x20, 0x00, 0xff,
+  0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50,
+  0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xef, 0xb4, 0x10,
+  0x7f, 0xff, 0x40, 0x07, 0xdf, 0x40, 0x37, 0x88, 0x87, 0x34, 0x88, 0x75, 0x00, 0xdf, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xc1, 0xef, 0xdc, 0xcd, 0xff, 0xdc, 0xcf, 0xf7, 0xef, 0x50, 0x00, 0xcf, 0x80,
+  0x0a, 0xfa, 0xef, 0x50, 0x00, 0xbf, 0x80, 0x09, 0xfb, 0xef, 0x50, 0x00, 0xbf, 0x80, 0x09, 0xfb,
+  0xef, 0x50, 0x00, 0xbf, 0x80, 0x09, 0xfb, 0xef, 0x50, 0x00, 0xbf, 0x80, 0x09, 0xfb, 0xef, 0x50,
+  0x00, 0xbf, 0x80, 0x09, 0xfb, 0xef, 0x50, 0x00, 0xbf, 0x80, 0x09, 0xfb, 0x37, 0x88, 0x88, 0x75,
+  0x10, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00, 0xef, 0xdc, 0xcc, 0xcf, 0xfe, 0x10, 0xef, 0x50,
+  0x00, 0x03, 0xff, 0x60, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90,
+  0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00,
+  0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00, 0x04, 0xef,
+  0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf5,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00,
+  0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x01, 0x8e,
+  0xff, 0xff, 0xeb, 0x20, 0x01, 0x67, 0x88, 0x87, 0x40, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xfa, 0x00,
+  0xbf, 0xfc, 0xcc, 0xcd, 0xff, 0x40, 0xef, 0x60, 0x00, 0x00, 0xcf, 0x80, 0xff, 0x50, 0x00, 0x00,
+  0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x53,
+  0x44, 0x45, 0xef, 0x70, 0xff, 0x5c, 0xff, 0xff, 0xfe, 0x20, 0xff, 0x5c, 0xff, 0xff, 0xb3, 0x00,
+  0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0d, 0xfe,
+  0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00, 0x00, 0x0e, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44,
+  0x1d, 0xf6, 0x09, 0xff, 0xff, 0xff, 0x3d, 0xf6, 0x01, 0x8e, 0xff, 0xff, 0x3d, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6,
+  0x01, 0x67, 0x88, 0x88, 0x30, 0x3e, 0xff, 0xff, 0xff, 0x60, 0xbf, 0xfc, 0xcc, 0xcc, 0x50, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0x88, 0x88, 0x81, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x2f, 0xfc,
+  0xcc, 0xcc, 0xc1, 0x00, 0x3f, 0xf7, 0x66, 0x65, 0x20, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x02, 0xad, 0xdd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x30, 0x14, 0x44, 0x44, 0x48,
+  0xff, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0xa1, 0x00, 0x00, 0x05,
+  0x97, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x48, 0x8c, 0xfd,
+  0x88, 0x85, 0x8f, 0xff, 0xff, 0xff, 0xfb, 0x7c, 0xce, 0xfe, 0xcc, 0xc8, 0x00, 0x09, 0xfb, 0x00,
+  0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00,
+  0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x08,
+  0x82, 0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c,
+  0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00,
+  0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02,
+  0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x78, 0x30, 0x00, 0x00, 0x18,
+  0x82, 0xef, 0x50, 0x00, 0x00, 0x6f, 0xe1, 0xef, 0x50, 0x00, 0x00, 0xcf, 0xa0, 0xef, 0x50, 0x00,
+  0x05, 0xff, 0x30, 0xef, 0x50, 0x00, 0x1e, 0xfa, 0x00, 0xef, 0x50, 0x01, 0xbf, 0xe1, 0x00, 0xef,
+  0x50, 0x2b, 0xff, 0x40, 0x00, 0xef, 0x98, 0xef, 0xe5, 0x00, 0x00, 0xef, 0xff, 0xfd, 0x30, 0x00,
+  0x00, 0xaf, 0xeb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00,
+  0x06, 0x20, 0x00, 0x07, 0x84, 0xef, 0x50, 0x00, 0xaf, 0xc0, 0x00, 0x5f, 0xf3, 0xef, 0x50, 0x09,
+  0xff, 0xd0, 0x00, 0xdf, 0xb0, 0xef, 0x50, 0x7f, 0xff, 0xd0, 0x07, 0xff, 0x30, 0xef, 0x56, 0xff,
+  0xef, 0xd0, 0x2e, 0xf9, 0x00, 0xef, 0xaf, 0xfb, 0x7f, 0xd0, 0xcf, 0xd1, 0x00, 0xef, 0xff, 0xc1,
+  0x7f, 0xda, 0xff, 0x40, 0x00, 0xef, 0xfd, 0x10, 0x7f, 0xff, 0xf6, 0x00, 0x00, 0xef, 0xe2, 0x00,
+  0x7f, 0xff, 0x70, 0x00, 0x00, 0xae, 0x30, 0x00, 0x3e, 0xd5, 0x00, 0x00, 0x00, 0x17, 0x87, 0x00,
+  0x00, 0x38, 0x85, 0x00, 0x07, 0xff, 0x90, 0x03, 0xef, 0xd2, 0x00, 0x00, 0x9f, 0xf8, 0x2e, 0xfe,
+  0x20, 0x00, 0x00, 0x0a, 0xff, 0xef, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x40, 0x00, 0x00,
+  0x00, 0x01, 0xcf, 0xff, 0x50, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xef, 0xf4, 0x00, 0x00, 0x00, 0xaf,
+  0xf8, 0x2d, 0xfe, 0x30, 0x00, 0x08, 0xff, 0x90, 0x02, 0xef, 0xe2, 0x00, 0x7f, 0xfa, 0x00, 0x00,
+  0x3e, 0xfd, 0x20, 0x78, 0x20, 0x00, 0x00, 0x68, 0x40, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff,
+  0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf,
+  0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xef, 0xb4, 0x44,
+  0x41, 0xbf, 0x80, 0x7f, 0xff, 0xff, 0xf5, 0xbf, 0x80, 0x07, 0xdf, 0xff, 0xf5, 0xbf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x02, 0x22, 0x23, 0xef, 0x70, 0x00, 0x0c, 0xff, 0xff, 0xff,
+  0x20, 0x00, 0x0c, 0xff, 0xff, 0xd5, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x28, 0x88, 0x88,
+  0x88, 0x85, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3c, 0xcc, 0xcc, 0xff, 0xfb, 0x00, 0x00,
+  0x00, 0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00, 0x07, 0xff, 0xb1, 0x00,
+  0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00, 0x07, 0xff, 0xe5, 0x44, 0x44, 0x00, 0x3f, 0xff, 0xff,
+  0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x59, 0xa0, 0x00, 0x1c, 0xff,
+  0xf0, 0x00, 0x8f, 0xfb, 0xa0, 0x00, 0xbf, 0x90, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0xbf, 0x80,
+  0x00, 0x00, 0xbf, 0x80, 0x00, 0x28, 0xff, 0x60, 0x00, 0xbf, 0xff, 0x10, 0x00, 0x6e, 0xff, 0x40,
+  0x00, 0x00, 0xdf, 0x80, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0xbf, 0x80,
+  0x00, 0x00, 0xaf, 0xd4, 0x40, 0x00, 0x4f, 0xff, 0xf0, 0x00, 0x05, 0xcf, 0xf0, 0x00, 0x00, 0x01,
+  0x10, 0x8a, 0x50, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf,
+  0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf, 0x70, 0xcf,
+  0x70, 0xcf, 0x70, 0x11, 0x10, 0x4a, 0x83, 0x00, 0x00, 0x6f, 0xff, 0x70, 0x00, 0x4a, 0xcf, 0xf2,
+  0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00, 0x0e, 0xf5, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x0e, 0xf6,
+  0x00, 0x00, 0x0c, 0xfd, 0x60, 0x00, 0x06, 0xff, 0xf5, 0x00, 0x09, 0xff, 0xc2, 0x00, 0x0d, 0xf7,
+  0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x14, 0x6f, 0xf4,
+  0x00, 0x5f, 0xff, 0xd0, 0x00, 0x5f, 0xfa, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x79, 0x63,
+  0x00, 0x01, 0x30, 0x0e, 0xff, 0xff, 0xeb, 0xae, 0x70, 0x0f, 0xba, 0xcf, 0xff, 0xff, 0x60, 0x03,
+  0x00, 0x01, 0x47, 0x84, 0x00, 0x09, 0xe2, 0x0c, 0xf4, 0x01, 0x30, 0x08, 0xe1, 0x09, 0xf1, 0x0a,
+  0xf2, 0x0b, 0xf3, 0x0c, 0xf4, 0x0d, 0xf5, 0x0e, 0xf6, 0x0e, 0xf7, 0x0f, 0xf7, 0x19, 0x95, 0x00,
+  0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x16, 0xff, 0x66, 0x10, 0x04, 0xef,
+  0xff, 0xff, 0x30, 0x0d, 0xfc, 0x99, 0x99, 0x20, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x2f, 0xe0, 0x00,
+  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xf6, 0x44, 0x44, 0x10, 0x08, 0xff, 0xff, 0xff,
+  0x30, 0x00, 0x6b, 0xff, 0xcc, 0x20, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0xca, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x48, 0xfe, 0x44, 0x40, 0x00, 0x00, 0x00,
+  0x5f, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x4c, 0xcd, 0xff, 0xcc, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xfd, 0x00, 0x00, 0x00, 0x15, 0x51, 0x00, 0x06, 0xfd, 0x00, 0x00, 0x00, 0x2f, 0xf2,
+  0x00, 0x06, 0xfe, 0x44, 0x44, 0x44, 0x9f, 0xf1, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0xe9, 0x10, 0x03, 0x20, 0x03, 0x20, 0x2e, 0xec, 0xce, 0xd1,
+  0x09, 0xfd, 0xdf, 0x80, 0x09, 0xf1, 0x3f, 0x70, 0x08, 0xf8, 0xaf, 0x50, 0x2e, 0xff, 0xff, 0xd1,
+  0x07, 0x72, 0x18, 0x70, 0x09, 0x92, 0x00, 0x00, 0x00, 0x07, 0x95, 0x0f, 0xf4, 0x00, 0x00, 0x00,
+  0x0c, 0xf8, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0xf8, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0xf8,
+  0x0f, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0xf8, 0x0e, 0xf7, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x09, 0xff,
+  0x86, 0x66, 0x67, 0xcf, 0xf2, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x18, 0xcd, 0xff,
+  0xed, 0xa4, 0x00, 0x00, 0x02, 0x33, 0xef, 0x83, 0x31, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xf5,
+  0x00, 0x00, 0x0b, 0xdd, 0xff, 0xed, 0xd5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x8a,
+  0x50, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0x9c, 0x60, 0x00,
+  0x00, 0x46, 0x30, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf, 0x80, 0xcf,
+  0x80, 0x11, 0x10, 0x01, 0x6a, 0xaa, 0xaa, 0xaa, 0xa5, 0x00, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xf7,
+  0x00, 0x9f, 0xfa, 0xaa, 0xaa, 0xaa, 0xa5, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xe8, 0x88, 0x88, 0x76, 0x20, 0x00, 0x9f, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x00, 0xdf, 0xbb, 0xcc, 0xcc, 0xce, 0xff, 0x30, 0xef, 0x60, 0x00, 0x00, 0x01,
+  0xdf, 0x80, 0xbf, 0xd6, 0x66, 0x66, 0x64, 0xbf, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+  0x03, 0xad, 0xee, 0xee, 0xef, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0x90, 0x34, 0x44, 0x44, 0x44, 0x46, 0xff, 0x70, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0x10, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
+  0x00, 0x08, 0x70, 0x07, 0x80, 0x2f, 0xf1, 0x0f, 0xf2, 0x06, 0x60, 0x05, 0x60, 0x00, 0x01, 0x22,
+  0x10, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xfe, 0x91, 0x00, 0x3e, 0xb5, 0x55, 0x68, 0xec, 0x00, 0xac,
+  0x1d, 0xff, 0xf7, 0x3f, 0x40, 0xd8, 0x5f, 0x54, 0x42, 0x0d, 0x70, 0xe7, 0x5f, 0x00, 0x00, 0x0d,
+  0x80, 0xd7, 0x5f, 0x00, 0x00, 0x0d, 0x80, 0xca, 0x3f, 0xff, 0xf7, 0x1f, 0x60, 0x6f, 0x63, 0x66,
+  0x64, 0xae, 0x10, 0x09, 0xfe, 0xdd, 0xdf, 0xe4, 0x00, 0x00, 0x37, 0x78, 0x76, 0x10, 0x00, 0x00,
+  0x39, 0x99, 0x98, 0x30, 0x00, 0x5f, 0xff, 0xff, 0xf4, 0x00, 0x14, 0x44, 0x47, 0xfb, 0x02, 0xbe,
+  0xee, 0xe2, 0xfc, 0x0c, 0xfe, 0xdd, 0xd2, 0xfc, 0x1f, 0xc0, 0x00, 0x01, 0xfc, 0x0e, 0xe7, 0x66,
+  0x69, 0xfa, 0x06, 0xff, 0xff, 0xff, 0xe3, 0x00, 0x26, 0x66, 0x65, 0x10, 0x00, 0x00, 0x56, 0x50,
+  0x26, 0x63, 0x00, 0x1b, 0xfe, 0x33, 0xef, 0xb1, 0x02, 0xcf, 0xd2, 0x4e, 0xfa, 0x00, 0x2d, 0xfc,
+  0x15, 0xff, 0x80, 0x00, 0x5f, 0xf5, 0x0a, 0xfe, 0x10, 0x00, 0x09, 0xff, 0x61, 0xcf, 0xd3, 0x00,
+  0x00, 0x7f, 0xf8, 0x1b, 0xfe, 0x40, 0x00, 0x05, 0xdd, 0x70, 0x9d, 0xc4, 0x05, 0x55, 0x55, 0x55,
+  0x51, 0x1f, 0xff, 0xff, 0xff, 0xf3, 0x1b, 0xbb, 0xbb, 0xbf, 0xf3, 0x00, 0x00, 0x00, 0x0d, 0xf3,
+  0x00, 0x00, 0x00, 0x0d, 0xf3, 0x00, 0x00, 0x00, 0x0b, 0xc2, 0x55, 0x55, 0x55, 0x55, 0x10, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0xbb, 0xbb, 0xbb, 0xbb, 0x30, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x03,
+  0xcf, 0xff, 0xfe, 0x91, 0x00, 0x3e, 0xb6, 0x55, 0x57, 0xec, 0x00, 0xac, 0x5f, 0xff, 0xfc, 0x3f,
+  0x40, 0xd8, 0x6f, 0x44, 0x7f, 0x1d, 0x70, 0xe7, 0x6f, 0x59, 0xce, 0x0d, 0x80, 0xd7, 0x6f, 0x6f,
+  0xe4, 0x0d, 0x80, 0xca, 0x6f, 0x07, 0xfa, 0x1f, 0x60, 0x6f, 0x62, 0x00, 0x5e, 0xee, 0x10, 0x09,
+  0xfe, 0xdd, 0xdf, 0xe4, 0x00, 0x00, 0x37, 0x78, 0x76, 0x10, 0x00, 0x99, 0x99, 0x99, 0xef, 0xff,
+  0xff, 0x67, 0x77, 0x77, 0x00, 0x00, 0x00, 0x05, 0xef, 0xa1, 0x2f, 0xc9, 0xf7, 0x4f, 0x40, 0xda,
+  0x2f, 0xda, 0xf7, 0x05, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51, 0x00, 0x00, 0x00, 0x0c,
+  0xf4, 0x00, 0x00, 0x45, 0x5d, 0xf8, 0x55, 0x20, 0xdf, 0xff, 0xff, 0xff, 0x50, 0xab, 0xbe, 0xfc,
+  0xbb, 0x40, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x09, 0xb3, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0xdf, 0xff, 0xff, 0xff, 0x50, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x02, 0x44, 0x31, 0x00, 0x0a,
+  0xff, 0xfd, 0x10, 0x03, 0x78, 0xaf, 0x40, 0x0a, 0xff, 0xff, 0x20, 0x0f, 0xc8, 0x84, 0x00, 0x1f,
+  0xff, 0xff, 0x50, 0x08, 0x88, 0x88, 0x30, 0x34, 0x43, 0x00, 0xef, 0xff, 0xb0, 0x78, 0x8d, 0xf0,
+  0xef, 0xff, 0xf0, 0x78, 0x8f, 0xf0, 0xef, 0xff, 0xd0, 0x78, 0x88, 0x20, 0x00, 0x07, 0x80, 0x05,
+  0xdf, 0xe1, 0x9f, 0xfc, 0x71, 0x68, 0x30, 0x00, 0x58, 0x40, 0x00, 0x00, 0x48, 0x60, 0xbf, 0x80,
+  0x00, 0x00, 0x7f, 0xc0, 0xbf, 0x80, 0x00, 0x00, 0x7f, 0xc0, 0xbf, 0x80, 0x00, 0x00, 0x7f, 0xc0,
+  0xbf, 0x80, 0x00, 0x00, 0x7f, 0xc0, 0xbf, 0x90, 0x00, 0x00, 0x7f, 0xc0, 0xbf, 0xb0, 0x00, 0x00,
+  0x7f, 0xc0, 0xbf, 0xf9, 0x54, 0x44, 0x9f, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xdd,
+  0xff, 0xff, 0xff, 0x80, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x89, 0x99, 0x95, 0x69, 0x96, 0x00, 0x01, 0xcf, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x0a, 0xff, 0xca, 0xaa, 0xbf, 0xfc, 0xbf, 0xf7, 0x1f, 0xf7, 0x00, 0x00, 0x0c, 0xf8,
+  0x0b, 0xf9, 0x3f, 0xf1, 0x00, 0x00, 0x0b, 0xf8, 0x0a, 0xfa, 0x4f, 0xf1, 0x00, 0x00, 0x0b, 0xf8,
+  0x0a, 0xfa, 0x2f, 0xf4, 0x00, 0x00, 0x0b, 0xf8, 0x0a, 0xfa, 0x0d, 0xfe, 0x76, 0x66, 0x2b, 0xf8,
+  0x0a, 0xfa, 0x04, 0xff, 0xff, 0xff, 0x5b, 0xf8, 0x0a, 0xfa, 0x00, 0x29, 0xde, 0xee, 0x5b, 0xf8,
+  0x0a, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8,
+  0x0a, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0x0a, 0xfa, 0x05, 0x30, 0x2f, 0xe0, 0x0a, 0x80,
+  0x00, 0x12, 0x00, 0x00, 0x7e, 0x40, 0x00, 0x9d, 0xf7, 0x19, 0x68, 0xf9, 0x1d, 0xfe, 0xa2, 0x14,
+  0x41, 0x4f, 0xf3, 0x19, 0xf3, 0x06, 0xf3, 0x06, 0xf3, 0x06, 0xf3, 0x03, 0x82, 0x04, 0x89, 0x99,
+  0x94, 0x00, 0x6f, 0xff, 0xff, 0xff, 0x60, 0xdf, 0x54, 0x44, 0x5f, 0xd0, 0xfd, 0x00, 0x00, 0x0d,
+  0xe0, 0xfd, 0x00, 0x00, 0x0d, 0xe0, 0xfd, 0x00, 0x00, 0x0d, 0xe0, 0xdf, 0x86, 0x66, 0x7f, 0xc0,
+  0x4f, 0xff, 0xff, 0xff, 0x40, 0x02, 0x56, 0x66, 0x52, 0x00, 0x05, 0x65, 0x02, 0x66, 0x30, 0x00,
+  0x04, 0xef, 0xa0, 0x8f, 0xf6, 0x00, 0x00, 0x3e, 0xfb, 0x17, 0xff, 0x70, 0x00, 0x02, 0xdf, 0xc1,
+  0x5f, 0xf8, 0x00, 0x00, 0x7f, 0xf3, 0x0b, 0xfd, 0x00, 0x08, 0xff, 0x71, 0xbf, 0xe3, 0x00, 0xaf,
+  0xf5, 0x2d, 0xfd, 0x20, 0x09, 0xdc, 0x32, 0xbd, 0xb1, 0x00, 0x14, 0x41, 0x00, 0x03, 0x75, 0x00,
+  0x00, 0x2f, 0xf4, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x19, 0xf4, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x05,
+  0xf4, 0x01, 0xef, 0x20, 0x00, 0x00, 0x05, 0xf4, 0x08, 0xf8, 0x00, 0x00, 0x00, 0x05, 0xf4, 0x2f,
+  0xe1, 0x11, 0x00, 0x10, 0x03, 0x82, 0xaf, 0x62, 0xf8, 0x05, 0xf4, 0x00, 0x04, 0xfc, 0x02, 0xf8,
+  0x05, 0xf4, 0x00, 0x0c, 0xf4, 0x02, 0xff, 0xff, 0xf8, 0x00, 0x6f, 0xb0, 0x00, 0x89, 0x9e, 0xf6,
+  0x01, 0xef, 0x20, 0x00, 0x00, 0x05, 0xf4, 0x07, 0xd8, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x14, 0x41,
+  0x00, 0x03, 0x75, 0x00, 0x00, 0x2f, 0xf4, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x19, 0xf4, 0x00, 0x6f,
+  0xa0, 0x00, 0x00, 0x05, 0xf4, 0x01, 0xef, 0x20, 0x00, 0x00, 0x05, 0xf4, 0x08, 0xf8, 0x00, 0x00,
+  0x00, 0x05, 0xf4, 0x2f, 0xe1, 0x11, 0x11, 0x00, 0x03, 0x82, 0xaf, 0x62, 0xff, 0xff, 0x60, 0x00,
+  0x04, 0xfc, 0x01, 0x88, 0x8e, 0xc0, 0x00, 0x0c, 0xf4, 0x02, 0xdf, 0xff, 0xa0, 0x00, 0x6f, 0xb0,
+  0x08, 0xf9, 0x98, 0x10, 0x01, 0xef, 0x20, 0x08, 0xfe, 0xee, 0xb0, 0x07, 0xd8, 0x00, 0x06, 0xaa,
+  0xaa, 0x80, 0x44, 0x43, 0x00, 0x00, 0x17, 0x70, 0x00, 0x00, 0xff, 0xff, 0x90, 0x00, 0x8f, 0x90,
+  0x00, 0x00, 0x88, 0x8e, 0xf0, 0x02, 0xee, 0x10, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x0a, 0xf7, 0x00,
+  0x00, 0x00, 0x88, 0x8f, 0xf0, 0x3f, 0xd0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xcf, 0x51, 0x10,
+  0x01, 0x10, 0x88, 0x87, 0x26, 0xfb, 0x0c, 0xc0, 0x0f, 0x90, 0x00, 0x00, 0x1d, 0xf3, 0x0c, 0xc0,
+  0x0f, 0x90, 0x00, 0x00, 0x8f, 0x90, 0x0c, 0xff, 0xff, 0xf0, 0x00, 0x02, 0xee, 0x10, 0x05, 0x99,
+  0x9f, 0xe0, 0x00, 0x0a, 0xf7, 0x00, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x2d, 0xc0, 0x00, 0x00, 0x00,
+  0x0a, 0x60, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xee, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0xee, 0x20, 0x00, 0x00, 0x00, 0x02, 0xff, 0x20, 0x00,
+  0x00, 0x8c, 0xdd, 0xff, 0x20, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x10, 0x00, 0x2f, 0xf9, 0x77, 0x74,
+  0x00, 0x00, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd,
+  0xbb, 0xbb, 0xbb, 0xb2, 0x08, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x48, 0x99, 0x99, 0x99, 0x92,
+  0x00, 0x1b, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x39,
+  0xef, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff,
+  0xa0, 0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f,
+  0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xfd, 0x81, 0x00, 0x00, 0x00, 0x00, 0x49, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06,
+  0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x17, 0xd6,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x7f, 0xfa, 0x6c, 0xff, 0x40,
+  0x00, 0x00, 0x19, 0x30, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06, 0xff, 0xfc,
+  0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xee,
+  0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x23, 0x00, 0x34, 0x00,
+  0x00, 0x00, 0x05, 0xff, 0xa4, 0xec, 0x00, 0x00, 0x00, 0x0d, 0xec, 0xff, 0xf7, 0x00, 0x00, 0x00,
+  0x0b, 0x60, 0x5a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58,
+  0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06, 0xff, 0xfc, 0xaa, 0xaa,
+  0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x96,
+  0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xee, 0xee, 0xee,
+  0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x04, 0x91, 0x03, 0x92, 0x00, 0x00, 0x00,
+  0x0b, 0xf6, 0x0a, 0xf8, 0x00, 0x00, 0x00, 0x03, 0x81, 0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0,
+  0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xa0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00,
+  0x00, 0x4c, 0xec, 0x30, 0x00, 0x00, 0x00, 0x01, 0xec, 0x5e, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xfb,
+  0x2e, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa0, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef,
+  0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x01, 0x58,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xea, 0xaa, 0xaa, 0xaa, 0xa9, 0x2f, 0xfc,
+  0x20, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa3, 0x77, 0x77, 0x77, 0x60, 0xdf,
+  0x60, 0x00, 0x00, 0x00, 0x9f, 0xa6, 0xff, 0xff, 0xff, 0xc0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf,
+  0xa5, 0xdd, 0xdd, 0xdd, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00,
+  0x7f, 0xe5, 0x44, 0x44, 0x44, 0x44, 0xef, 0x60, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0xef, 0x60, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x01, 0x79, 0x99, 0x99,
+  0x99, 0x96, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xa6, 0xcf, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc5, 0x44, 0x44, 0x44, 0x43, 0x5f, 0xff,
+  0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x07, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x96, 0x8f, 0x90, 0x00, 0x00, 0x00, 0xdf, 0xeb,
+  0x20, 0x00, 0x00, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x5b,
+  0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x39, 0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa,
+  0xaa, 0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84,
+  0x77, 0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90,
+  0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44,
+  0x44, 0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xf1, 0x00, 0x00, 0x00, 0x8f, 0xfd, 0x71,
+  0x00, 0x00, 0x00, 0x58, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x99, 0x99, 0x99,
+  0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa, 0xa7, 0xbf, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77, 0x77, 0x77, 0x50,
+  0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44, 0x43, 0x4f, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x2b, 0xb2, 0x00, 0x00,
+  0x00, 0x19, 0xff, 0xff, 0x91, 0x00, 0x00, 0xdf, 0xe7, 0x7e, 0xfd, 0x00, 0x00, 0x48, 0x10, 0x01,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa, 0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77, 0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff,
+  0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44, 0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb,
+  0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x03, 0x92, 0x02, 0x93, 0x00, 0x00, 0x09, 0xf9, 0x08,
+  0xfa, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x99,
+  0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa, 0xa7,
+  0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77, 0x77,
+  0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44, 0x43,
+  0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x06, 0x81, 0x00, 0x00,
+  0x0d, 0xfe, 0x60, 0x00, 0x06, 0xcf, 0xfb, 0x00, 0x00, 0x02, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x01, 0x95, 0x00, 0x00, 0x7e, 0xfc, 0x00, 0x0c, 0xff, 0xb6, 0x00,
+  0x08, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x06, 0xd6, 0x00,
+  0x00, 0x04, 0xdf, 0xff, 0xd4, 0x00, 0x5f, 0xfb, 0x5b, 0xff, 0x50, 0x09, 0x40, 0x00, 0x49, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x96, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00,
+  0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a,
+  0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9,
+  0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00,
+  0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x39, 0x20, 0x29, 0x30, 0x9f, 0x80, 0x8f, 0x90, 0x28, 0x20,
+  0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf,
+  0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf,
+  0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf,
+  0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x02, 0x99, 0x99, 0x99, 0x98,
+  0x40, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00, 0x0a, 0xfd, 0xaa, 0xaa, 0xad,
+  0xff, 0xd1, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0xf7, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00,
+  0x09, 0xfc, 0x35, 0x5b, 0xfc, 0x55, 0x30, 0x00, 0x06, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,
+  0x05, 0xff, 0x7b, 0xbe, 0xfe, 0xbb, 0x70, 0x00, 0x05, 0xff, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00,
+  0x07, 0xfd, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x1d, 0xfa, 0x00, 0x0a, 0xfb, 0x44, 0x44, 0x46,
+  0xdf, 0xf3, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x05, 0xff, 0xff, 0xff, 0xfe,
+  0xa3, 0x00, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0xef, 0xc5, 0xbf, 0x00, 0x00,
+  0x00, 0x09, 0xfb, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x09, 0x90, 0x3a, 0x92, 0x00, 0x00, 0x4b, 0x40,
+  0x00, 0x00, 0x00, 0x39, 0x80, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe, 0x30, 0x00,
+  0x00, 0x5f, 0xe0, 0xaf, 0xff, 0xe3, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20, 0x00, 0x5f,
+  0xe0, 0xaf, 0x92, 0xef, 0xd2, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x5f, 0xe0, 0xaf,
+  0x90, 0x03, 0xef, 0xd1, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf, 0x90, 0x00,
+  0x04, 0xff, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x05,
+  0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x03, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xaf, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00,
+  0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00,
+  0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70,
+  0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80,
+  0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00,
+  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00,
+  0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xc7, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00,
+  0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50,
+  0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xfe, 0x60, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0xd6, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x02, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00,
+  0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00,
+  0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70,
+  0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80,
+  0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00,
+  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00,
+  0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x02, 0x41, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0xfd, 0x5a, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xce, 0xff, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x8a, 0x02, 0xaa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00,
+  0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50,
+  0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x40, 0x19, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x5f, 0xd0, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x30, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00,
+  0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30,
+  0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80,
+  0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50,
+  0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00,
+  0x06, 0x64, 0x00, 0x16, 0x62, 0x05, 0xff, 0x51, 0xcf, 0xa0, 0x00, 0x5f, 0xfd, 0xfa, 0x00, 0x00,
+  0x06, 0xff, 0xc0, 0x00, 0x00, 0x1c, 0xff, 0xf5, 0x00, 0x01, 0xcf, 0xa5, 0xff, 0x50, 0x09, 0xc9,
+  0x00, 0x5c, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x40, 0x00, 0x02, 0x7b, 0xcc, 0xcb,
+  0x9b, 0xfd, 0x10, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x8b,
+  0xff, 0xfa, 0x00, 0x0a, 0xfd, 0x20, 0x00, 0x2e, 0xfc, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0xcf,
+  0xc1, 0xef, 0x70, 0x1f, 0xf4, 0x00, 0x09, 0xfe, 0x20, 0xbf, 0x90, 0x1f, 0xf4, 0x00, 0x6f, 0xf4,
+  0x00, 0xbf, 0x90, 0x1f, 0xf4, 0x03, 0xff, 0x70, 0x00, 0xbf, 0x90, 0x0f, 0xf5, 0x1d, 0xfa, 0x00,
+  0x00, 0xcf, 0x80, 0x0c, 0xfa, 0xbf, 0xc1, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xff, 0x42, 0x22,
+  0x6e, 0xfd, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x02, 0xef, 0xef, 0xff, 0xff,
+  0xfb, 0x30, 0x00, 0x0b, 0xea, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x3a, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xd1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x90, 0x00, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60, 0xef, 0x50,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf,
+  0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6,
+  0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff,
+  0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0xef, 0xea, 0x40, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x10, 0x00, 0x00, 0x89, 0x30,
+  0x00, 0x00, 0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf,
+  0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x18, 0xd5, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xdf, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x7f, 0xfa, 0x6c, 0xff, 0x40, 0x00, 0x00, 0x19,
+  0x30, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00,
+  0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef,
+  0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x04, 0x91, 0x03, 0x92, 0x00, 0x00, 0x00, 0x0b,
+  0xf6, 0x0a, 0xf7, 0x00, 0x00, 0x00, 0x03, 0x81, 0x03, 0x81, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00,
+  0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef,
+  0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5d, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xc7, 0x10, 0x29, 0x90, 0x00, 0x06,
+  0x82, 0x09, 0x93, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e,
+  0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x2f,
+  0xf4, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x0d, 0xfe, 0x87, 0x77, 0x78, 0xef, 0xd0, 0x03, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0x00, 0x29, 0xcd, 0xff, 0xdc, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xef, 0xff, 0xff,
+  0xfd, 0x91, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0xaf, 0xd5, 0x44, 0x44, 0x57, 0xff,
+  0x80, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x8f, 0xd0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf,
+  0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x01, 0xcf, 0xb0, 0xaf, 0x95, 0xcc,
+  0xcc, 0xce, 0xff, 0x50, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xf7, 0x00, 0xaf, 0x93, 0x88, 0x88, 0x76,
+  0x20, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x68, 0x88, 0x85, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0xaf, 0xeb,
+  0xbb, 0xcf, 0xf5, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0xdf, 0x60, 0x16, 0x8f,
+  0xf7, 0x00, 0x00, 0xdf, 0x63, 0xef, 0xff, 0xd1, 0x00, 0x00, 0xdf, 0x6a, 0xfe, 0xc9, 0x20, 0x00,
+  0x00, 0xdf, 0x6c, 0xfb, 0x66, 0x66, 0x30, 0x00, 0xdf, 0x67, 0xff, 0xff, 0xff, 0xfa, 0x00, 0xdf,
+  0x60, 0x7c, 0xdd, 0xde, 0xff, 0x50, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xbf, 0x90, 0xdf, 0x63, 0x44,
+  0x44, 0x45, 0xdf, 0x80, 0xdf, 0x6b, 0xff, 0xff, 0xff, 0xff, 0x30, 0xdf, 0x6b, 0xff, 0xff, 0xff,
+  0xc4, 0x00, 0x04, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x05, 0xbf,
+  0xfd, 0x10, 0x00, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa,
+  0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe,
+  0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0,
+  0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0x50, 0x00, 0x00, 0x05, 0xff, 0xe9, 0x20, 0x00, 0x00,
+  0x02, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00,
+  0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43,
+  0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0,
+  0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60,
+  0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x5d, 0x81, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xfe,
+  0x60, 0x00, 0x03, 0xff, 0xc6, 0xaf, 0xf8, 0x00, 0x00, 0x85, 0x00, 0x03, 0x91, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20,
+  0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb,
+  0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4,
+  0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00,
+  0x00, 0x01, 0x30, 0x02, 0x40, 0x00, 0x00, 0x2e, 0xfd, 0x5b, 0xf1, 0x00, 0x00, 0x9f, 0xcf, 0xff,
+  0xc0, 0x00, 0x00, 0x89, 0x03, 0xaa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+  0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0,
+  0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda,
+  0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x29, 0x40, 0x19, 0x40, 0x00,
+  0x00, 0x7f, 0xb0, 0x6f, 0xc0, 0x00, 0x00, 0x18, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a,
+  0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0,
+  0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33,
+  0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x02,
+  0xbe, 0xd5, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0xcf, 0x10, 0x00, 0x00, 0x0c, 0xe2, 0xaf, 0x20, 0x00,
+  0x00, 0x04, 0xef, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x28, 0x88, 0x87,
+  0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24,
+  0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0,
+  0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff,
+  0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x37, 0x88, 0x87,
+  0x62, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x3a, 0xaa, 0xaa,
+  0xef, 0xfc, 0xaa, 0xaa, 0xdf, 0xe0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xe0, 0x00, 0x00, 0x2f, 0xf1,
+  0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd1, 0x66, 0x66, 0x9f, 0xe0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd2,
+  0xff, 0xff, 0xff, 0x70, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd2, 0xcc, 0xcc, 0xb6, 0x00, 0x7f, 0xd4,
+  0x33, 0x33, 0xaf, 0xf5, 0x33, 0x33, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x03, 0xbf, 0xff, 0xff, 0xd7, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x26, 0x78, 0x88,
+  0x88, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0d, 0xfe, 0xcc, 0xcc, 0xcc, 0x30, 0x1f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x44, 0x10, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0x01, 0x8e, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x0c, 0xc3, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xef, 0x30, 0x00, 0x00, 0x04, 0x86, 0xbf, 0x50, 0x00, 0x00, 0x04, 0xef, 0xd8, 0x00, 0x00,
+  0x01, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x9e, 0xfe, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+  0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1,
+  0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff,
+  0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff,
+  0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0xff, 0x60, 0x00, 0x00, 0x04, 0xff, 0xe9, 0x30, 0x00, 0x00, 0x01, 0xa5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef,
+  0xff, 0xff, 0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4,
+  0x2f, 0xf1, 0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc,
+  0xb7, 0x00, 0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e,
+  0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x2a, 0xb3, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0x91, 0x00,
+  0x00, 0xcf, 0xe8, 0x7e, 0xfe, 0x10, 0x00, 0x38, 0x10, 0x01, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xfd,
+  0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56, 0x66, 0x7f, 0xf2,
+  0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f, 0xf7, 0x33, 0x33,
+  0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20, 0x00, 0x00, 0x07,
+  0x80, 0x06, 0x80, 0x00, 0x00, 0x1f, 0xf2, 0x0f, 0xf3, 0x00, 0x00, 0x06, 0x60, 0x05, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff,
+  0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1,
+  0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00,
+  0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff,
+  0x20, 0x00, 0x08, 0x70, 0x00, 0x00, 0x1e, 0xfd, 0x40, 0x00, 0x17, 0xcf, 0xf9, 0x00, 0x00, 0x03,
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x02,
+  0xa3, 0x01, 0x8f, 0xfa, 0x1d, 0xff, 0xa5, 0x09, 0x61, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00,
+  0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf,
+  0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x18, 0xc4, 0x00, 0x00,
+  0x06, 0xef, 0xff, 0xb3, 0x00, 0x9f, 0xf9, 0x6d, 0xff, 0x20, 0x29, 0x20, 0x00, 0x67, 0x00, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d,
+  0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6,
+  0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00,
+  0x00, 0x59, 0x10, 0x49, 0x10, 0xdf, 0x50, 0xcf, 0x60, 0x47, 0x00, 0x38, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xfe, 0x33, 0xa1, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xef, 0xf7, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x16, 0x78, 0x88,
+  0x2d, 0xf6, 0x00, 0x04, 0xef, 0xff, 0xff, 0x3d, 0xf6, 0x00, 0x0d, 0xfe, 0xcc, 0xcc, 0x2d, 0xf6,
+  0x00, 0x2f, 0xf4, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x1f, 0xf9, 0x44,
+  0x44, 0x6f, 0xf4, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x01, 0x9e, 0xff, 0xff, 0xeb,
+  0x20, 0x00, 0x00, 0x02, 0x30, 0x03, 0x30, 0x00, 0x00, 0x6f, 0xfa, 0x5e, 0xb0, 0x00, 0x00, 0xee,
+  0xcf, 0xff, 0x60, 0x00, 0x01, 0xb6, 0x06, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x37, 0x88, 0x88, 0x75, 0x10, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00, 0xef, 0xdc, 0xcc, 0xcf,
+  0xfe, 0x10, 0xef, 0x50, 0x00, 0x03, 0xff, 0x60, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0xef, 0x50,
+  0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90,
+  0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0x00, 0xa5, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x8d, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x49, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00,
+  0x04, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00,
+  0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3,
+  0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1,
+  0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x10, 0x00, 0x00, 0x00, 0x19,
+  0xff, 0x80, 0x00, 0x00, 0x03, 0xef, 0xea, 0x40, 0x00, 0x00, 0x00, 0xa5, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x70,
+  0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00,
+  0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9,
+  0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20,
+  0x00, 0x00, 0x2a, 0xc3, 0x00, 0x00, 0x00, 0x18, 0xef, 0xff, 0xa2, 0x00, 0x00, 0xbf, 0xf8, 0x7e,
+  0xfe, 0x10, 0x00, 0x39, 0x20, 0x01, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x78, 0x88, 0x73, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2,
+  0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00,
+  0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0xd1, 0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x32, 0x00, 0x42, 0x00,
+  0x00, 0x09, 0xff, 0x86, 0xf8, 0x00, 0x00, 0x2f, 0xdd, 0xff, 0xf3, 0x00, 0x00, 0x3b, 0x30, 0x7b,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00, 0x04, 0xef,
+  0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf5,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00,
+  0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x01, 0x8e,
+  0xff, 0xff, 0xeb, 0x20, 0x00, 0x07, 0x80, 0x06, 0x90, 0x00, 0x00, 0x0f, 0xf2, 0x0e, 0xf4, 0x00,
+  0x00, 0x05, 0x70, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x78, 0x88,
+  0x73, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4,
+  0x00, 0x00, 0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x51, 0x2f, 0xff, 0xff, 0xff,
+  0xf2, 0x1b, 0xbb, 0xbb, 0xbb, 0xb1, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0xff, 0x10, 0x00,
+  0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x62, 0x00, 0x16, 0x78, 0x88, 0xbf,
+  0xd1, 0x04, 0xef, 0xff, 0xff, 0xff, 0x90, 0x0d, 0xfe, 0xcc, 0xdf, 0xff, 0xf2, 0x2f, 0xf4, 0x00,
+  0xcf, 0xae, 0xf6, 0x2f, 0xf3, 0x09, 0xfd, 0x1d, 0xf6, 0x2f, 0xf3, 0x5f, 0xf4, 0x0d, 0xf6, 0x2f,
+  0xf4, 0xef, 0x70, 0x0d, 0xf6, 0x1f, 0xfe, 0xfd, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff,
+  0xd1, 0x04, 0xff, 0xff, 0xff, 0xeb, 0x20, 0x1c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x02, 0x8d, 0xff, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0x40, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c,
+  0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00,
+  0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b,
+  0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff,
+  0xe3, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x00, 0x00, 0x18, 0xff, 0x90, 0x00, 0x00, 0x02,
+  0xef, 0xfa, 0x40, 0x00, 0x00, 0x00, 0xa6, 0x10, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84, 0x1f,
+  0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c,
+  0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00,
+  0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00,
+  0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x19, 0xc4, 0x00, 0x00, 0x00, 0x07, 0xef, 0xff, 0xa2,
+  0x00, 0x00, 0xaf, 0xf9, 0x6d, 0xfe, 0x10, 0x00, 0x29, 0x20, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f,
+  0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c,
+  0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74,
+  0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00,
+  0x06, 0x80, 0x05, 0x91, 0x00, 0x00, 0x0e, 0xf3, 0x0d, 0xf5, 0x00, 0x00, 0x05, 0x70, 0x04, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00,
+  0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f,
+  0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c,
+  0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef,
+  0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x02, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xfa, 0x00, 0x00,
+  0x00, 0x1d, 0xff, 0xb5, 0x00, 0x78, 0x20, 0x09, 0x61, 0x68, 0x40, 0xff, 0x50, 0x00, 0x00, 0xbf,
+  0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00,
+  0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xef,
+  0xb4, 0x44, 0x41, 0xbf, 0x80, 0x7f, 0xff, 0xff, 0xf5, 0xbf, 0x80, 0x07, 0xdf, 0xff, 0xf5, 0xbf,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x02, 0x22, 0x23, 0xef, 0x70, 0x00, 0x0c, 0xff,
+  0xff, 0xff, 0x20, 0x00, 0x0c, 0xff, 0xff, 0xd5, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x78,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0x88, 0x87, 0x40, 0x00, 0xdf, 0xff, 0xff,
+  0xff, 0xfb, 0x00, 0xdf, 0xfc, 0xcc, 0xcd, 0xff, 0x60, 0xdf, 0x70, 0x00, 0x00, 0xaf, 0x90, 0xdf,
+  0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf,
+  0xa0, 0xdf, 0x63, 0x44, 0x45, 0xdf, 0x80, 0xdf, 0x6a, 0xff, 0xff, 0xff, 0x30, 0xdf, 0x6a, 0xff,
+  0xff, 0xc4, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x10, 0x49, 0x10, 0x00, 0x00, 0xdf, 0x50, 0xcf, 0x60,
+  0x00, 0x00, 0x47, 0x00, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x20, 0x00,
+  0x00, 0x68, 0x40, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff,
+  0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf,
+  0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xef, 0xb4, 0x44, 0x41, 0xbf, 0x80, 0x7f, 0xff, 0xff,
+  0xf5, 0xbf, 0x80, 0x07, 0xdf, 0xff, 0xf5, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00,
+  0x02, 0x22, 0x23, 0xef, 0x70, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x20, 0x00, 0x0c, 0xff, 0xff, 0xd5,
+  0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x04, 0x99, 0x99, 0x94, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x73, 0x00, 0x00, 0x00, 0x01, 0x58, 0x99,
+  0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf,
+  0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf,
+  0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x96, 0x66,
+  0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xee, 0xee, 0xee, 0xee,
+  0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x19, 0x99, 0x99, 0x80, 0x00, 0x00, 0x1f, 0xff,
+  0xff, 0xc0, 0x00, 0x00, 0x17, 0x77, 0x77, 0x60, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00,
+  0x4f, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f,
+  0xd0, 0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00,
+  0x00, 0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03,
+  0xbf, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x0a, 0x70, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0c, 0xf9, 0x69,
+  0xfc, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x38, 0xa8, 0x30, 0x00,
+  0x00, 0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06,
+  0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x8f, 0xe1, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x6a, 0x10, 0x03,
+  0xa4, 0x00, 0x00, 0x7f, 0xc6, 0x7e, 0xf3, 0x00, 0x00, 0x1c, 0xff, 0xff, 0x90, 0x00, 0x00, 0x01,
+  0x7a, 0x95, 0x00, 0x00, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x20,
+  0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0, 0x07, 0xff, 0xff, 0xfb,
+  0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00, 0x5f, 0xd0, 0x7f, 0xd4,
+  0x33, 0x33, 0xaf, 0xb0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf, 0xff, 0xff, 0xd6, 0x00,
+  0x00, 0x01, 0x58, 0x99, 0x99, 0x99, 0x20, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00,
+  0x06, 0xff, 0xfc, 0xaa, 0xaa, 0xdf, 0xa0, 0x00, 0x2f, 0xfc, 0x20, 0x00, 0x00, 0x9f, 0xa0, 0x00,
+  0x8f, 0xe1, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00,
+  0xdf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0xef, 0x96, 0x66, 0x66, 0x66, 0xbf, 0xa0, 0x00,
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xef, 0xee, 0xee, 0xee, 0xee, 0xef, 0xa0, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00,
+  0xef, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdc, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xce, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x9c, 0xc9, 0x10, 0x00, 0x28, 0x88, 0x87, 0x51, 0x00, 0x00, 0x4f,
+  0xff, 0xff, 0xfd, 0x20, 0x00, 0x3a, 0xaa, 0xaa, 0xef, 0xa0, 0x00, 0x24, 0x44, 0x43, 0x5f, 0xd0,
+  0x07, 0xff, 0xff, 0xfb, 0x4f, 0xd0, 0x3f, 0xfe, 0xdd, 0xda, 0x4f, 0xd0, 0x7f, 0xc0, 0x00, 0x00,
+  0x5f, 0xd0, 0x7f, 0xd4, 0x33, 0x33, 0xaf, 0xc0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xbf,
+  0xff, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe0, 0x01, 0x00,
+  0x00, 0x00, 0x0e, 0xfc, 0xdb, 0x00, 0x00, 0x00, 0x04, 0xbc, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0x40, 0x00, 0x00, 0x00, 0x07, 0xef, 0xb0, 0x00, 0x00, 0x01, 0xdf, 0xfb, 0x50, 0x00, 0x00,
+  0x00, 0x86, 0x10, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x96, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9,
+  0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xa6, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xc5, 0x44, 0x44, 0x44, 0x43, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf, 0xff, 0xff,
+  0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x00, 0x00, 0x18, 0xff, 0x90, 0x00, 0x00,
+  0x02, 0xef, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x96, 0x10, 0x00, 0x00, 0x26, 0x78, 0x88, 0x88, 0x20,
+  0x04, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0d, 0xfe, 0xcc, 0xcc, 0xcc, 0x30, 0x1f, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x44, 0x10, 0x09, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0x01, 0x8e, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x2a, 0xb3, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff,
+  0x91, 0x00, 0x00, 0xcf, 0xe8, 0x7e, 0xfd, 0x00, 0x00, 0x48, 0x10, 0x01, 0x85, 0x00, 0x01, 0x79,
+  0x99, 0x99, 0x99, 0x96, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xa6,
+  0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc5, 0x44, 0x44, 0x44, 0x43,
+  0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x4c, 0x91,
+  0x00, 0x00, 0x00, 0x2b, 0xff, 0xfe, 0x70, 0x00, 0x02, 0xff, 0xd6, 0x9f, 0xf9, 0x00, 0x00, 0x76,
+  0x00, 0x02, 0x92, 0x00, 0x00, 0x26, 0x78, 0x88, 0x88, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0x0d, 0xfe, 0xcc, 0xcc, 0xcc, 0x30, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9,
+  0x44, 0x44, 0x44, 0x10, 0x09, 0xff, 0xff, 0xff, 0xff, 0x40, 0x01, 0x8e, 0xff, 0xff, 0xff, 0x40,
+  0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60,
+  0x00, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x96, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xeb,
+  0xaa, 0xaa, 0xaa, 0xa6, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc5,
+  0x44, 0x44, 0x44, 0x43, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xf9,
+  0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50,
+  0x00, 0x00, 0x00, 0x26, 0x78, 0x88, 0x88, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0d, 0xfe,
+  0xcc, 0xcc, 0xcc, 0x30, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44,
+  0x44, 0x10, 0x09, 0xff, 0xff, 0xff, 0xff, 0x40, 0x01, 0x8e, 0xff, 0xff, 0xff, 0x40, 0x00, 0x29,
+  0x20, 0x00, 0x67, 0x00, 0x00, 0xaf, 0xf9, 0x6d, 0xfe, 0x20, 0x00, 0x07, 0xef, 0xff, 0xa2, 0x00,
+  0x00, 0x00, 0x19, 0xc4, 0x00, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x96, 0x2e, 0xff, 0xff, 0xff,
+  0xff, 0xf9, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xa6, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0xc5, 0x44, 0x44, 0x44, 0x43, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xdf,
+  0xff, 0xff, 0xff, 0xf9, 0x00, 0x49, 0x10, 0x01, 0x85, 0x00, 0x00, 0xcf, 0xe8, 0x7e, 0xfd, 0x00,
+  0x00, 0x18, 0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x2a, 0xb3, 0x00, 0x00, 0x00, 0x26, 0x78, 0x88,
+  0x88, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0d, 0xfe, 0xcc, 0xcc, 0xcc, 0x30, 0x1f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x44, 0x10, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0x01, 0x8e, 0xff, 0xff, 0xff, 0x40, 0x00, 0x1a, 0x30, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x7f, 0xfb, 0x6c, 0xff, 0x40, 0x00, 0x00, 0x05, 0xdf, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xd6, 0x00, 0x00, 0x00, 0x29, 0x99, 0x99, 0x99, 0x84, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff,
+  0xc2, 0x00, 0xaf, 0xda, 0xaa, 0xab, 0xdf, 0xfd, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x05, 0xff, 0x70,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0xaf, 0xb0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xd0, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x8f, 0xc0, 0xaf, 0x90, 0x00, 0x00, 0x01, 0xdf, 0x90, 0xaf, 0xb4, 0x44, 0x44, 0x7d, 0xff,
+  0x30, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xf6, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0x70, 0x00,
+  0x16, 0x78, 0x88, 0x2d, 0xf6, 0x4f, 0x20, 0x04, 0xef, 0xff, 0xff, 0x3d, 0xf6, 0x37, 0x00, 0x0d,
+  0xfe, 0xcc, 0xcc, 0x2d, 0xf6, 0x00, 0x00, 0x1f, 0xf4, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf5, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x99, 0x99, 0x99, 0x98, 0x40, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,
+  0x0a, 0xfd, 0xaa, 0xaa, 0xad, 0xff, 0xd1, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0xf7, 0x00,
+  0x0a, 0xfa, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x35, 0x5b, 0xfc, 0x55, 0x30, 0x00, 0x06, 0xfe, 0x9f,
+  0xff, 0xff, 0xff, 0x90, 0x00, 0x05, 0xff, 0x7b, 0xbe, 0xfe, 0xbb, 0x70, 0x00, 0x05, 0xff, 0x00,
+  0x0a, 0xfa, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x1d, 0xfa, 0x00,
+  0x0a, 0xfb, 0x44, 0x44, 0x46, 0xdf, 0xf3, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00,
+  0x05, 0xff, 0xff, 0xff, 0xfe, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xae, 0xfc, 0xa2, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x05,
+  0x6e, 0xfa, 0x61, 0x00, 0x16, 0x78, 0x88, 0x2d, 0xf6, 0x00, 0x04, 0xef, 0xff, 0xff, 0x3d, 0xf6,
+  0x00, 0x0d, 0xfe, 0xcc, 0xcc, 0x2d, 0xf6, 0x00, 0x2f, 0xf4, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x2f, 0xf3, 0x00,
+  0x00, 0x0d, 0xf6, 0x00, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff,
+  0xd1, 0x00, 0x01, 0x9e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x07, 0x99, 0x99, 0x91, 0x00, 0x00,
+  0x0c, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x05, 0x77, 0x77, 0x71, 0x00, 0x39, 0x99, 0x99, 0x99, 0x99,
+  0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa, 0xa7, 0xbf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77, 0x77, 0x77, 0x50, 0xbf,
+  0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44, 0x43, 0x4f, 0xff, 0xff,
+  0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x19, 0x99, 0x99, 0x80, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x17, 0x77, 0x77, 0x60, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72,
+  0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00,
+  0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f,
+  0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20,
+  0x00, 0x01, 0x9e, 0xff, 0xff, 0x20, 0x00, 0x00, 0x4a, 0x40, 0x01, 0x97, 0x00, 0x00, 0x2f, 0xe7,
+  0x6c, 0xf7, 0x00, 0x00, 0x09, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x59, 0xa7, 0x10, 0x00, 0x39,
+  0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa,
+  0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77,
+  0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44,
+  0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x6a, 0x10,
+  0x03, 0xa4, 0x00, 0x00, 0x7f, 0xc6, 0x7e, 0xf3, 0x00, 0x00, 0x1c, 0xff, 0xff, 0x90, 0x00, 0x00,
+  0x01, 0x7a, 0x95, 0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff,
+  0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56,
+  0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f,
+  0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20,
+  0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x70, 0x00, 0x00, 0x39, 0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf,
+  0xda, 0xaa, 0xaa, 0xaa, 0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0x84, 0x77, 0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd,
+  0xdd, 0xdd, 0x90, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf,
+  0xd5, 0x44, 0x44, 0x44, 0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff,
+  0xfb, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x50, 0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0d,
+  0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56, 0x66, 0x7f,
+  0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f, 0xf7, 0x33,
+  0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20, 0x00, 0x39,
+  0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa, 0xaa, 0xaa,
+  0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x84, 0x77,
+  0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0xbf,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44, 0x44, 0x44,
+  0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00,
+  0x06, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x0e, 0xfc, 0xdb, 0x00,
+  0x00, 0x00, 0x04, 0xbc, 0xb6, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff,
+  0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f, 0xf1, 0x56,
+  0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7, 0x00, 0x1f,
+  0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff, 0xff, 0x20,
+  0x00, 0x00, 0x00, 0x0b, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x90, 0x01, 0x00, 0x00, 0x00, 0x4f,
+  0xec, 0xe6, 0x00, 0x00, 0x00, 0x08, 0xcc, 0xa3, 0x00, 0x00, 0x39, 0x20, 0x01, 0x76, 0x00, 0x00,
+  0xbf, 0xf9, 0x7e, 0xfe, 0x10, 0x00, 0x17, 0xef, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x19, 0xc3, 0x00,
+  0x00, 0x39, 0x99, 0x99, 0x99, 0x99, 0x97, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xda, 0xaa,
+  0xaa, 0xaa, 0xa7, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x84, 0x77, 0x77, 0x77, 0x50, 0xbf, 0x88, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0x87, 0xdd, 0xdd, 0xdd,
+  0x90, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd5, 0x44,
+  0x44, 0x44, 0x43, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x00,
+  0x67, 0x10, 0x02, 0x93, 0x00, 0x01, 0xef, 0xe7, 0x9f, 0xfb, 0x00, 0x00, 0x2a, 0xff, 0xfe, 0x81,
+  0x00, 0x00, 0x00, 0x3b, 0xa2, 0x00, 0x00, 0x00, 0x27, 0x78, 0x88, 0x72, 0x00, 0x04, 0xef, 0xff,
+  0xff, 0xff, 0x60, 0x0d, 0xfd, 0xaa, 0xaa, 0xcf, 0xf1, 0x1f, 0xf2, 0x00, 0x00, 0x0e, 0xf4, 0x2f,
+  0xf1, 0x56, 0x66, 0x7f, 0xf2, 0x2f, 0xf1, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xf1, 0xcc, 0xcc, 0xb7,
+  0x00, 0x1f, 0xf7, 0x33, 0x33, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x01, 0x9e, 0xff,
+  0xff, 0x20, 0x00, 0x00, 0x00, 0x04, 0xc9, 0x10, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xff, 0xe7, 0x00,
+  0x00, 0x00, 0x2f, 0xfd, 0x69, 0xff, 0x90, 0x00, 0x00, 0x07, 0x60, 0x00, 0x29, 0x20, 0x00, 0x01,
+  0x79, 0x99, 0x99, 0x99, 0x99, 0x60, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f, 0xeb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x70, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x47, 0x77, 0x77, 0x77, 0x20, 0xdf, 0x70, 0x9f, 0xff, 0xff, 0xff, 0xb0,
+  0xdf, 0x70, 0x8d, 0xdd, 0xdd, 0xef, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xdf, 0x70,
+  0x00, 0x00, 0x00, 0x8f, 0xc0, 0xbf, 0xc5, 0x44, 0x44, 0x44, 0xaf, 0xc0, 0x5f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x19, 0xc4, 0x00, 0x00,
+  0x00, 0x07, 0xef, 0xff, 0xa2, 0x00, 0x00, 0xaf, 0xf9, 0x6d, 0xfe, 0x20, 0x00, 0x29, 0x20, 0x00,
+  0x67, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0d, 0xfe,
+  0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00, 0x00, 0x0e, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6,
+  0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44,
+  0x1d, 0xf6, 0x0a, 0xff, 0xff, 0xff, 0x3d, 0xf6, 0x01, 0x9e, 0xff, 0xff, 0x3d, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x22, 0x22, 0x4f, 0xf5, 0x00, 0x00, 0xef, 0xff, 0xff, 0xe1,
+  0x00, 0x00, 0xef, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x22, 0x22, 0x10, 0x00, 0x00, 0x07, 0x90, 0x00,
+  0x4a, 0x30, 0x00, 0x00, 0x08, 0xfb, 0x67, 0xef, 0x10, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xa9, 0x40, 0x00, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x99, 0x60, 0x2e,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0x70, 0xcf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x47, 0x77, 0x77,
+  0x77, 0x20, 0xdf, 0x70, 0x9f, 0xff, 0xff, 0xff, 0xb0, 0xdf, 0x70, 0x8d, 0xdd, 0xdd, 0xef, 0xc0,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xbf, 0xc5,
+  0x44, 0x44, 0x44, 0xaf, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x06, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0x70, 0x00, 0x3a, 0x40, 0x01, 0x97, 0x00, 0x00, 0x2f, 0xe7, 0x6b, 0xf8, 0x00, 0x00,
+  0x08, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x59, 0xa7, 0x10, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73,
+  0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00,
+  0x00, 0x0e, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x1d, 0xf6, 0x0a, 0xff, 0xff, 0xff, 0x3d,
+  0xf6, 0x01, 0x9e, 0xff, 0xff, 0x3d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x22,
+  0x22, 0x4f, 0xf5, 0x00, 0x00, 0xef, 0xff, 0xff, 0xe1, 0x00, 0x00, 0xef, 0xff, 0xfc, 0x30, 0x00,
+  0x00, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x99,
+  0x60, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f, 0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0x70, 0xcf,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x47,
+  0x77, 0x77, 0x77, 0x20, 0xdf, 0x70, 0x9f, 0xff, 0xff, 0xff, 0xb0, 0xdf, 0x70, 0x8d, 0xdd, 0xdd,
+  0xef, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0,
+  0xbf, 0xc5, 0x44, 0x44, 0x44, 0xaf, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x06, 0xdf,
+  0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x05, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73, 0x00, 0x04, 0xff, 0xff,
+  0xff, 0xff, 0x80, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00, 0x00, 0x0e, 0xf6, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d,
+  0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x1d, 0xf6, 0x0a, 0xff, 0xff, 0xff, 0x3d, 0xf6, 0x01, 0x9e, 0xff,
+  0xff, 0x3d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x22, 0x22, 0x4f, 0xf5, 0x00,
+  0x00, 0xef, 0xff, 0xff, 0xe1, 0x00, 0x00, 0xef, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x22, 0x22, 0x10,
+  0x00, 0x01, 0x79, 0x99, 0x99, 0x99, 0x99, 0x60, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f,
+  0xeb, 0xaa, 0xaa, 0xaa, 0xaa, 0x70, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x47, 0x77, 0x77, 0x77, 0x20, 0xdf, 0x70, 0x9f, 0xff, 0xff,
+  0xff, 0xb0, 0xdf, 0x70, 0x8d, 0xdd, 0xdd, 0xef, 0xc0, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x8f, 0xc0, 0xbf, 0xc5, 0x44, 0x44, 0x44, 0xaf, 0xc0, 0x5f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf2,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x78, 0x88, 0x73, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80,
+  0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x1f, 0xf4, 0x00, 0x00, 0x0e, 0xf6, 0x2f, 0xf3, 0x00, 0x00,
+  0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9,
+  0x44, 0x44, 0x1d, 0xf6, 0x0a, 0xff, 0xff, 0xff, 0x3d, 0xf6, 0x01, 0x9e, 0xff, 0xff, 0x3d, 0xf6,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x22, 0x22, 0x4f, 0xf5, 0x00, 0x00, 0xef, 0xff,
+  0xff, 0xe1, 0x00, 0x00, 0xef, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+  0x05, 0xd8, 0x10, 0x00, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x6a,
+  0xff, 0x80, 0x00, 0x00, 0x08, 0x50, 0x00, 0x39, 0x10, 0x00, 0x69, 0x60, 0x00, 0x00, 0x00, 0x39,
+  0x90, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf,
+  0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xc7, 0x77,
+  0x77, 0x77, 0xaf, 0xe0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xaf, 0xed, 0xdd, 0xdd, 0xdd,
+  0xdf, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x5f, 0xe0, 0x78, 0x30, 0x04, 0xc9, 0x10, 0x00, 0xdf, 0x62, 0xbf, 0xff, 0xe7,
+  0x00, 0xdf, 0x8f, 0xfd, 0x69, 0xff, 0x90, 0xdf, 0x67, 0x60, 0x00, 0x29, 0x20, 0xdf, 0x65, 0x88,
+  0x87, 0x40, 0x00, 0xdf, 0x6a, 0xff, 0xff, 0xfb, 0x00, 0xdf, 0x68, 0xcc, 0xcd, 0xff, 0x60, 0xdf,
+  0x60, 0x00, 0x00, 0xbf, 0x90, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf,
+  0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00,
+  0x00, 0xaf, 0xa0, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0x06, 0x96, 0x00, 0x00, 0x00, 0x03, 0x99,
+  0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x00, 0x3c, 0xfc, 0x66, 0x66, 0x66, 0x69, 0xfe,
+  0x50, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x6d, 0xfd, 0xaa, 0xaa, 0xaa, 0xac, 0xff,
+  0x80, 0x0a, 0xfc, 0x77, 0x77, 0x77, 0x7a, 0xfe, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0x00, 0x0a, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xfe, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe,
+  0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe,
+  0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x05, 0xfe,
+  0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xef, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x16, 0xef, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x65,
+  0x88, 0x87, 0x40, 0x00, 0x00, 0xdf, 0x6a, 0xff, 0xff, 0xfb, 0x00, 0x00, 0xdf, 0x68, 0xcc, 0xcd,
+  0xff, 0x60, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xbf, 0x90, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0,
+  0x00, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0xdf,
+  0x60, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xaf, 0xa0, 0x00, 0xdf, 0x60, 0x00,
+  0x00, 0xaf, 0xa0, 0x01, 0x30, 0x03, 0x40, 0x4f, 0xfb, 0x4d, 0xd0, 0xbf, 0xbf, 0xff, 0x90, 0xa8,
+  0x04, 0xa9, 0x10, 0x00, 0x69, 0x60, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x22, 0x00, 0x43, 0x07, 0xff, 0x95, 0xfa, 0x0e,
+  0xec, 0xff, 0xf5, 0x2b, 0x50, 0x6b, 0x70, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00,
+  0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00,
+  0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x49,
+  0x99, 0x99, 0x40, 0x7f, 0xff, 0xff, 0x70, 0x37, 0x77, 0x77, 0x30, 0x00, 0x69, 0x60, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x69,
+  0x99, 0x99, 0x20, 0xaf, 0xff, 0xff, 0x30, 0x57, 0x77, 0x77, 0x10, 0x00, 0x78, 0x30, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x0a, 0x70, 0x00, 0x7a, 0x00, 0x0c, 0xf9, 0x69, 0xfc, 0x00, 0x04, 0xff, 0xff,
+  0xf4, 0x00, 0x00, 0x38, 0xa8, 0x30, 0x00, 0x00, 0x06, 0x96, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00,
+  0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00,
+  0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00,
+  0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x00, 0x0a,
+  0xf9, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x3a, 0x50, 0x00, 0x98, 0x1f, 0xe8, 0x6b, 0xf9,
+  0x07, 0xff, 0xff, 0xd2, 0x00, 0x49, 0xa7, 0x10, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0d, 0xf6, 0x00,
+  0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00,
+  0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x0d, 0xf6, 0x00,
+  0x06, 0x96, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a,
+  0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9,
+  0x00, 0x0a, 0xf9, 0x00, 0x0a, 0xf9, 0x00, 0x1d, 0xb0, 0x00, 0x8f, 0x50, 0x10, 0x8f, 0xec, 0xf2,
+  0x19, 0xcc, 0x91, 0x07, 0x83, 0x00, 0x0d, 0xf6, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x83, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6,
+  0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x0d, 0xf6, 0x00, 0x3e, 0x90, 0x00,
+  0xbf, 0x20, 0x10, 0xbf, 0xdc, 0xe0, 0x3a, 0xcb, 0x80, 0x39, 0x30, 0x9f, 0x90, 0x28, 0x20, 0x69,
+  0x60, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf,
+  0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0xaf, 0x90, 0x78, 0x30, 0xdf, 0x60, 0xdf, 0x60, 0xdf,
+  0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0xdf, 0x60, 0x69, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x93, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0xaf, 0x91, 0x44,
+  0x44, 0x44, 0x44, 0x6f, 0xf4, 0xaf, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xaf, 0x93, 0xff,
+  0xff, 0xff, 0xff, 0xea, 0x20, 0x07, 0x83, 0x07, 0x83, 0x0d, 0xf6, 0x0e, 0xf6, 0x07, 0x83, 0x07,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x07, 0x83, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e,
+  0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e,
+  0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x0d, 0xf6, 0x0e, 0xf6, 0x00, 0x00, 0x0e,
+  0xf6, 0x22, 0x22, 0x4f, 0xf4, 0xef, 0xff, 0xff, 0xe1, 0xef, 0xff, 0xfc, 0x30, 0x22, 0x22, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xff, 0xe7,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xfd, 0x69, 0xff, 0x90, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x29,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,
+  0x00, 0x34, 0x44, 0x44, 0x44, 0x4b, 0xfc, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00,
+  0x00, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc4, 0x00, 0x00, 0x00,
+  0x06, 0xef, 0xff, 0xb3, 0x00, 0x00, 0x9f, 0xf9, 0x6d, 0xff, 0x20, 0x00, 0x29, 0x20, 0x00, 0x67,
+  0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0xf6, 0x00, 0x00, 0x22, 0x22, 0x4f, 0xf5, 0x00, 0x00, 0xef, 0xff, 0xff, 0xe1, 0x00, 0x00, 0xef,
+  0xff, 0xfc, 0x30, 0x00, 0x00, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0x01,
+  0x89, 0x92, 0xaf, 0x90, 0x00, 0x00, 0x1b, 0xff, 0x60, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xf6, 0x00,
+  0xaf, 0x90, 0x00, 0x1b, 0xff, 0x50, 0x00, 0xaf, 0x90, 0x01, 0xbf, 0xf5, 0x00, 0x00, 0xaf, 0x93,
+  0x7c, 0xff, 0x50, 0x00, 0x00, 0xaf, 0x97, 0xff, 0xf5, 0x00, 0x00, 0x00, 0xaf, 0x96, 0xde, 0xfc,
+  0x10, 0x00, 0x00, 0xaf, 0x90, 0x04, 0xef, 0xc1, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x4e, 0xfd, 0x10,
+  0x00, 0xaf, 0x90, 0x00, 0x04, 0xef, 0xd2, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x4e, 0xfd, 0x20, 0xaf,
+  0x90, 0x00, 0x00, 0x04, 0xef, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x06, 0x88, 0x70, 0xdf, 0x60,
+  0x01, 0xaf, 0xfc, 0x20, 0xdf, 0x60, 0x2c, 0xff, 0xa1, 0x00, 0xdf, 0x64, 0xef, 0xf7, 0x00, 0x00,
+  0xdf, 0x6e, 0xff, 0x50, 0x00, 0x00, 0xdf, 0x6a, 0xff, 0x80, 0x00, 0x00, 0xdf, 0x60, 0xaf, 0xf9,
+  0x00, 0x00, 0xdf, 0x60, 0x0a, 0xff, 0x90, 0x00, 0xdf, 0x60, 0x00, 0x9f, 0xfa, 0x00, 0xdf, 0x60,
+  0x00, 0x09, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x60, 0x00, 0x06, 0x88, 0x70, 0xdf, 0x60, 0x01, 0xaf, 0xfc, 0x20, 0xdf, 0x60, 0x2c, 0xff,
+  0xa1, 0x00, 0xdf, 0x64, 0xef, 0xf7, 0x00, 0x00, 0xdf, 0x6e, 0xff, 0x50, 0x00, 0x00, 0xdf, 0x6a,
+  0xff, 0x80, 0x00, 0x00, 0xdf, 0x60, 0xaf, 0xf9, 0x00, 0x00, 0xdf, 0x60, 0x0a, 0xff, 0x90, 0x00,
+  0xdf, 0x60, 0x00, 0x9f, 0xfa, 0x00, 0xdf, 0x60, 0x00, 0x09, 0xff, 0xa0, 0x00, 0x01, 0x96, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0xfc, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x07, 0x72,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xb4, 0x44, 0x44, 0x44, 0x44, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0x00, 0x02, 0xb2, 0x01, 0x8f, 0xf9, 0x2e, 0xff, 0xa4, 0x09, 0x61, 0x00, 0x88, 0x20,
+  0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00,
+  0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xef,
+  0xb4, 0x10, 0x7f, 0xff, 0x40, 0x07, 0xdf, 0x40, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xb4, 0x44, 0x44, 0x44, 0x44, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x88, 0x20, 0x00, 0xff, 0x50, 0x00,
+  0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff,
+  0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xef, 0xb4, 0x10, 0x7f, 0xff,
+  0x40, 0x07, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x05, 0x60, 0x00, 0x0e, 0xb0, 0x00, 0x1f, 0x60, 0x00,
+  0x4f, 0x20, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x50,
+  0x00, 0x00, 0x69, 0x60, 0x6f, 0x10, 0x00, 0x00, 0xaf, 0x90, 0x46, 0x00, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb4,
+  0x44, 0x44, 0x44, 0x44, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0x88, 0x20, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0xff, 0x50, 0x0b, 0xe0, 0xff, 0x50, 0x0e, 0xa0,
+  0xff, 0x50, 0x1f, 0x50, 0xff, 0x50, 0x28, 0x10, 0xff, 0x50, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00,
+  0xff, 0x50, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0xef, 0xb4, 0x10, 0x00,
+  0x7f, 0xff, 0x40, 0x00, 0x07, 0xdf, 0x40, 0x00, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x61, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x09, 0xf8, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x04, 0xb3,
+  0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb4,
+  0x44, 0x44, 0x44, 0x44, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0x00, 0x88, 0x20, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x50, 0x00, 0xff,
+  0x50, 0x00, 0xff, 0x50, 0x00, 0xff, 0x53, 0x50, 0xff, 0x5d, 0xf4, 0xff, 0x57, 0xb1, 0xff, 0x50,
+  0x00, 0xff, 0x50, 0x00, 0xef, 0xb4, 0x10, 0x7f, 0xff, 0x40, 0x07, 0xdf, 0x40, 0x00, 0x29, 0x91,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7,
+  0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xfe,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xaf, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x3f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf5,
+  0x44, 0x44, 0x44, 0x44, 0x20, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x1d, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x18, 0x81, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x00, 0x3f, 0xf2,
+  0x00, 0x00, 0x3f, 0xf2, 0x00, 0x00, 0x3f, 0xf2, 0x03, 0x00, 0x3f, 0xf7, 0xdb, 0x00, 0x3f, 0xff,
+  0xfa, 0x06, 0xdf, 0xfe, 0x81, 0x7f, 0xff, 0xf2, 0x00, 0x8e, 0xaf, 0xf2, 0x00, 0x31, 0x3f, 0xf2,
+  0x00, 0x00, 0x1f, 0xf9, 0x40, 0x00, 0x0b, 0xff, 0xf1, 0x00, 0x01, 0x9e, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xef, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xfb,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x77, 0x20, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x39, 0x80,
+  0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe, 0x30, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xff,
+  0xe3, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20, 0x00, 0x5f, 0xe0, 0xaf, 0x92, 0xef, 0xd2,
+  0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x5f, 0xe0, 0xaf, 0x90, 0x03, 0xef, 0xd1, 0x5f,
+  0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf, 0x90, 0x00, 0x04, 0xff, 0xff, 0xe0, 0xaf,
+  0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x05, 0xff, 0xe0, 0xaf, 0x90, 0x00,
+  0x00, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb1,
+  0x00, 0x00, 0x00, 0x01, 0x9f, 0xf7, 0x00, 0x00, 0x00, 0x3e, 0xfe, 0x93, 0x00, 0x00, 0x00, 0x1a,
+  0x51, 0x00, 0x00, 0x37, 0x88, 0x88, 0x75, 0x10, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00, 0xef,
+  0xdc, 0xcc, 0xcf, 0xfe, 0x10, 0xef, 0x50, 0x00, 0x03, 0xff, 0x60, 0xef, 0x50, 0x00, 0x00, 0xbf,
+  0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00,
+  0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0x4b,
+  0x40, 0x00, 0x00, 0x00, 0x39, 0x80, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe, 0x30,
+  0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xff, 0xe3, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20, 0x00,
+  0x5f, 0xe0, 0xaf, 0x92, 0xef, 0xd2, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x5f, 0xe0,
+  0xaf, 0x90, 0x03, 0xef, 0xd1, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf, 0x90,
+  0x00, 0x04, 0xff, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00,
+  0x05, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x37, 0x88, 0x88, 0x75, 0x10, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00,
+  0xef, 0xdc, 0xcc, 0xcf, 0xfe, 0x10, 0xef, 0x50, 0x00, 0x03, 0xff, 0x60, 0xef, 0x50, 0x00, 0x00,
+  0xbf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50,
+  0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x00, 0x3a, 0x10, 0x00, 0x00, 0x4f, 0xfc, 0x6b, 0xff,
+  0x70, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd7, 0x10, 0x00, 0x00,
+  0x4b, 0x40, 0x00, 0x00, 0x00, 0x39, 0x80, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe,
+  0x30, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xff, 0xe3, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20,
+  0x00, 0x5f, 0xe0, 0xaf, 0x92, 0xef, 0xd2, 0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x5f,
+  0xe0, 0xaf, 0x90, 0x03, 0xef, 0xd1, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf,
+  0x90, 0x00, 0x04, 0xff, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00,
+  0x00, 0x05, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x02, 0x92, 0x00, 0x06, 0x70, 0x00, 0x09, 0xff, 0xa6, 0xdf, 0xf2, 0x00, 0x00, 0x7e,
+  0xff, 0xfb, 0x20, 0x00, 0x00, 0x01, 0x8c, 0x40, 0x00, 0x00, 0x37, 0x88, 0x88, 0x75, 0x10, 0x00,
+  0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00, 0xef, 0xdc, 0xcc, 0xcf, 0xfe, 0x10, 0xef, 0x50, 0x00, 0x03,
+  0xff, 0x60, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50,
+  0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90,
+  0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x34, 0x78, 0x88, 0x87, 0x40, 0x00, 0x38, 0x0f, 0xff, 0xff, 0xff,
+  0xfd, 0x20, 0x00, 0x0f, 0xfd, 0xcc, 0xcc, 0xff, 0xd0, 0x00, 0x0f, 0xf4, 0x00, 0x00, 0x4f, 0xf5,
+  0x00, 0x0f, 0xf4, 0x00, 0x00, 0x0d, 0xf7, 0x00, 0x0f, 0xf4, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x0f,
+  0xf4, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x0f, 0xf4, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x0f, 0xf4, 0x00,
+  0x00, 0x0c, 0xf8, 0x00, 0x0f, 0xf4, 0x00, 0x00, 0x0c, 0xf8, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x39,
+  0x80, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x5f, 0xe0, 0xaf, 0xfe, 0x30, 0x00, 0x00, 0x5f, 0xe0, 0xaf,
+  0xff, 0xe3, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0xbd, 0xfe, 0x20, 0x00, 0x6f, 0xe0, 0xaf, 0x92, 0xef,
+  0xd2, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x3e, 0xfd, 0x20, 0x6f, 0xe0, 0xaf, 0x90, 0x03, 0xef, 0xd1,
+  0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x4e, 0xfc, 0x7f, 0xe0, 0xaf, 0x90, 0x00, 0x04, 0xff, 0xff, 0xe0,
+  0xaf, 0x90, 0x00, 0x00, 0x4f, 0xff, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x05, 0xff, 0xe0, 0xaf, 0x90,
+  0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xe0, 0x02, 0x33, 0x33, 0x33, 0x33, 0xaf, 0xc0, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x70, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x37,
+  0x88, 0x88, 0x75, 0x10, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd3, 0x00, 0xef, 0xdc, 0xcc, 0xcf, 0xfe,
+  0x10, 0xef, 0x50, 0x00, 0x03, 0xff, 0x60, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0xef, 0x50, 0x00,
+  0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xaf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0xef,
+  0x50, 0x00, 0x00, 0xbf, 0x90, 0xef, 0x50, 0x00, 0x00, 0xbf, 0x90, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x02, 0x33, 0x34, 0xef, 0x70, 0x00, 0x0b, 0xff,
+  0xff, 0xff, 0x20, 0x00, 0x0b, 0xff, 0xff, 0xd5, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x99, 0x99, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x77, 0x77, 0x50, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00,
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a,
+  0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f,
+  0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f,
+  0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c,
+  0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00,
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00,
+  0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x08, 0x99, 0x99, 0x91, 0x00, 0x00, 0x0c, 0xff,
+  0xff, 0xf1, 0x00, 0x00, 0x06, 0x77, 0x77, 0x71, 0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00, 0x04,
+  0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00, 0x0e,
+  0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00,
+  0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x01,
+  0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x89, 0x00, 0x05, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x9f,
+  0xb6, 0x8e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x7a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00, 0x00, 0x00, 0x5e, 0xff,
+  0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa, 0x00, 0x0a, 0xfd, 0x10,
+  0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef, 0x70, 0x1f, 0xf4, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x0c, 0xfa, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd, 0x00, 0x00, 0xaf, 0xff,
+  0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x02,
+  0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x4a, 0x30, 0x01, 0xa6, 0x00, 0x00, 0x3f, 0xe7, 0x6c, 0xf7,
+  0x00, 0x00, 0x09, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x59, 0xa7, 0x10, 0x00, 0x00, 0x16, 0x78,
+  0x88, 0x73, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xf2, 0x2f,
+  0xf4, 0x00, 0x00, 0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d,
+  0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f, 0xf4, 0x09, 0xff, 0xff,
+  0xff, 0xff, 0xd1, 0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0xc0, 0x3e, 0x90, 0x00, 0x00, 0x00, 0x02, 0xde, 0x85, 0xed, 0x60,
+  0x00, 0x00, 0x00, 0x04, 0x81, 0x07, 0x60, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xcc, 0xcb, 0x94, 0x00,
+  0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xfa,
+  0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x30, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x70, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x80, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf,
+  0x80, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff, 0x50, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xfd,
+  0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xdf, 0xff, 0xff, 0xfb, 0x30,
+  0x00, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00,
+  0x00, 0x08, 0xf3, 0x1b, 0xe1, 0x00, 0x00, 0xaf, 0xb4, 0xcf, 0x91, 0x00, 0x01, 0x93, 0x02, 0x92,
+  0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x00, 0x04, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0d, 0xfe, 0xcc,
+  0xcc, 0xdf, 0xf2, 0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf5, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f,
+  0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x1f, 0xf9, 0x44, 0x44, 0x6f,
+  0xf4, 0x09, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x01, 0x8e, 0xff, 0xff, 0xeb, 0x20, 0x00, 0x01, 0x7b,
+  0xcc, 0xcb, 0x94, 0x39, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfb, 0x03, 0xff, 0xe9, 0x88, 0x88, 0xcf, 0xff, 0xda, 0xaa, 0xaa, 0xaa,
+  0xa7, 0x0a, 0xfd, 0x10, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x83, 0x77, 0x77, 0x77, 0x50, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x88, 0xff, 0xff, 0xff,
+  0xa0, 0x1f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x87, 0xdd, 0xdd, 0xdd, 0x90, 0x0f, 0xf5, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x03, 0xff,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xa4, 0x22, 0x22, 0x6e, 0xff, 0xd5, 0x44, 0x44, 0x44,
+  0x43, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x07, 0xdf,
+  0xff, 0xff, 0xfb, 0x35, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x02, 0x33, 0x32, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x78, 0x88, 0x73, 0x05, 0x78, 0x88, 0x74, 0x00, 0x04,
+  0xef, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x0d, 0xfe, 0xcc, 0xcc, 0xdf, 0xfe, 0xaa,
+  0xaa, 0xbf, 0xf7, 0x2f, 0xf4, 0x00, 0x00, 0x0e, 0xf7, 0x00, 0x00, 0x09, 0xfa, 0x2f, 0xf3, 0x00,
+  0x00, 0x0d, 0xf6, 0x36, 0x66, 0x6d, 0xf8, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x9f, 0xff, 0xff,
+  0xe2, 0x2f, 0xf3, 0x00, 0x00, 0x0d, 0xf6, 0x7c, 0xcc, 0xc9, 0x20, 0x1f, 0xf9, 0x44, 0x44, 0x6f,
+  0xfb, 0x33, 0x33, 0x10, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01,
+  0x8e, 0xff, 0xff, 0xfb, 0x6d, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xfa, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0x10, 0x00, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x94, 0x00, 0xaf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0xaf, 0xda, 0xaa, 0xaa, 0xaa, 0xdf, 0xc0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x5f,
+  0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x9f, 0xc0, 0xaf,
+  0x93, 0x66, 0x66, 0x6a, 0xff, 0x70, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xaf, 0x96, 0xdf,
+  0xff, 0xfc, 0x70, 0x00, 0xaf, 0x90, 0x03, 0xef, 0xf6, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x2c, 0xff,
+  0x80, 0x00, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xfa, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x09, 0xff, 0xc1,
+  0x00, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x00, 0x18, 0xff, 0x90, 0x00, 0x02, 0xef, 0xfa, 0x40, 0x00,
+  0x00, 0x96, 0x10, 0x00, 0x01, 0x67, 0x88, 0x88, 0x30, 0x3e, 0xff, 0xff, 0xff, 0x60, 0xbf, 0xfc,
+  0xcc, 0xcc, 0x50, 0xef, 0x60, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00,
+  0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x94, 0x00, 0xaf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0xaf, 0xda, 0xaa, 0xaa, 0xaa, 0xdf, 0xc0, 0xaf, 0x90, 0x00, 0x00, 0x00,
+  0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x9f, 0xc0,
+  0xaf, 0x93, 0x66, 0x66, 0x6a, 0xff, 0x70, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xaf, 0x96,
+  0xdf, 0xff, 0xfc, 0x70, 0x00, 0xaf, 0x90, 0x03, 0xef, 0xf6, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x2c,
+  0xff, 0x80, 0x00, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xfa, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x09, 0xff,
+  0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x67, 0x88, 0x88, 0x30,
+  0x3e, 0xff, 0xff, 0xff, 0x60, 0xbf, 0xfc, 0xcc, 0xcc, 0x50, 0xef, 0x60, 0x00, 0x00, 0x00, 0xff,
+  0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00,
+  0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x6f, 0xfb, 0x6c, 0xff, 0x50, 0x00, 0x00, 0x05, 0xdf, 0xff, 0xc4, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xd6, 0x00, 0x00, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x94, 0x00, 0xaf, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0xaf, 0xda, 0xaa, 0xaa, 0xaa, 0xdf, 0xc0, 0xaf, 0x90, 0x00, 0x00,
+  0x00, 0x5f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0xaf, 0x90, 0x00, 0x00, 0x00, 0x9f,
+  0xc0, 0xaf, 0x93, 0x66, 0x66, 0x6a, 0xff, 0x70, 0xaf, 0x97, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xaf,
+  0x96, 0xdf, 0xff, 0xfc, 0x70, 0x00, 0xaf, 0x90, 0x03, 0xef, 0xf6, 0x00, 0x00, 0xaf, 0x90, 0x00,
+  0x2c, 0xff, 0x80, 0x00, 0xaf, 0x90, 0x00, 0x01, 0xbf, 0xfa, 0x10, 0xaf, 0x90, 0x00, 0x00, 0x09,
+  0xff, 0xc1, 0x05, 0x71, 0x00, 0x19, 0x30, 0x1e, 0xfe, 0x78, 0xef, 0xc0, 0x01, 0x9f, 0xff, 0xf8,
+  0x10, 0x00, 0x03, 0xba, 0x20, 0x00, 0x00, 0x16, 0x78, 0x88, 0x83, 0x03, 0xef, 0xff, 0xff, 0xf6,
+  0x0b, 0xff, 0xcc, 0xcc, 0xc5, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x0f,
+  0xf5, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x0f, 0xf5,
+  0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb2, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x8f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x61, 0x00, 0x00, 0x00, 0x16, 0x99, 0x99, 0x99, 0x99, 0x30, 0x03, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0x0c, 0xfe, 0xba, 0xaa, 0xaa, 0xaa, 0x30, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xfc, 0x77, 0x77, 0x77, 0x51, 0x00, 0x05, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x3a, 0xcd, 0xdd, 0xdd, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf6, 0x04, 0x44, 0x44, 0x44, 0x44, 0x8f,
+  0xf3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x00,
+  0x00, 0x00, 0x02, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xfa, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xb5,
+  0x00, 0x00, 0x00, 0x09, 0x61, 0x00, 0x00, 0x00, 0x47, 0x88, 0x88, 0x81, 0x00, 0x09, 0xff, 0xff,
+  0xff, 0xf2, 0x00, 0x2f, 0xfc, 0xcc, 0xcc, 0xc1, 0x00, 0x3f, 0xf7, 0x66, 0x65, 0x20, 0x00, 0x0d,
+  0xff, 0xff, 0xff, 0xe4, 0x00, 0x02, 0xad, 0xdd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+  0x30, 0x14, 0x44, 0x44, 0x48, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xff,
+  0xfe, 0xa1, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0xf9, 0x10,
+  0x00, 0x00, 0x0d, 0xfe, 0x77, 0xef, 0xd0, 0x00, 0x00, 0x04, 0x81, 0x00, 0x18, 0x40, 0x00, 0x00,
+  0x16, 0x99, 0x99, 0x99, 0x99, 0x30, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0c, 0xfe, 0xba,
+  0xaa, 0xaa, 0xaa, 0x30, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xfc, 0x77, 0x77, 0x77, 0x51, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
+  0x00, 0x3a, 0xcd, 0xdd, 0xdd, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xf6, 0x04, 0x44, 0x44, 0x44, 0x44, 0x8f, 0xf3, 0x1f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x00, 0x01, 0x7d, 0x60, 0x00, 0x00,
+  0x00, 0x5d, 0xff, 0xfc, 0x40, 0x00, 0x07, 0xff, 0xa6, 0xcf, 0xf4, 0x00, 0x01, 0x93, 0x00, 0x05,
+  0x80, 0x00, 0x00, 0x47, 0x88, 0x88, 0x81, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x2f, 0xfc,
+  0xcc, 0xcc, 0xc1, 0x00, 0x3f, 0xf7, 0x66, 0x65, 0x20, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xe4, 0x00,
+  0x02, 0xad, 0xdd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x30, 0x14, 0x44, 0x44, 0x48,
+  0xff, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0xa1, 0x00, 0x00, 0x16,
+  0x99, 0x99, 0x99, 0x99, 0x30, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0c, 0xfe, 0xba, 0xaa,
+  0xaa, 0xaa, 0x30, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0xfc, 0x77, 0x77, 0x77, 0x51, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00,
+  0x3a, 0xcd, 0xdd, 0xdd, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xf6, 0x04, 0x44, 0x44, 0x44, 0x44, 0x8f, 0xf3, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x00, 0x00, 0x00, 0xcb, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xbe, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x47, 0x6b, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x5e, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x47, 0x88, 0x88, 0x81, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf2,
+  0x00, 0x2f, 0xfc, 0xcc, 0xcc, 0xc1, 0x00, 0x3f, 0xf7, 0x66, 0x65, 0x20, 0x00, 0x0d, 0xff, 0xff,
+  0xff, 0xe4, 0x00, 0x02, 0xad, 0xdd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x30, 0x14,
+  0x44, 0x44, 0x48, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0xa1,
+  0x00, 0x00, 0x00, 0x6f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xf8, 0x00, 0x00, 0x00, 0x09, 0x68,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0xfe, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x92, 0x00, 0x17, 0x60, 0x00,
+  0x00, 0x0b, 0xff, 0x97, 0xef, 0xe1, 0x00, 0x00, 0x01, 0x7e, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x99, 0x99,
+  0x99, 0x99, 0x30, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0c, 0xfe, 0xba, 0xaa, 0xaa, 0xaa,
+  0x30, 0x1f, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0xfc, 0x77, 0x77, 0x77, 0x51, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x3a, 0xcd,
+  0xdd, 0xdd, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0xf6, 0x04, 0x44, 0x44, 0x44, 0x44, 0x8f, 0xf3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+  0x1f, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x00, 0x94, 0x00, 0x04, 0x90, 0x00, 0x05, 0xff, 0xb6,
+  0xbf, 0xf5, 0x00, 0x00, 0x4d, 0xff, 0xfd, 0x40, 0x00, 0x00, 0x00, 0x6d, 0x60, 0x00, 0x00, 0x00,
+  0x47, 0x88, 0x88, 0x81, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x2f, 0xfc, 0xcc, 0xcc, 0xc1,
+  0x00, 0x3f, 0xf7, 0x66, 0x65, 0x20, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x02, 0xad, 0xdd,
+  0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x30, 0x14, 0x44, 0x44, 0x48, 0xff, 0x20, 0x2f,
+  0xff, 0xff, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0xa1, 0x00, 0x69, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x70, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7a, 0xaa, 0xad, 0xfe, 0xaa, 0xaa, 0x70,
+  0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x97, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x48,
+  0x8c, 0xfd, 0x88, 0x85, 0x8f, 0xff, 0xff, 0xff, 0xfb, 0x7c, 0xce, 0xfe, 0xcc, 0xc8, 0x00, 0x09,
+  0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb,
+  0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x62, 0x00, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00,
+  0x00, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x40, 0x00, 0x49, 0x00, 0x00, 0x00, 0x5f, 0xfc, 0x6b, 0xff, 0x60, 0x00, 0x00, 0x04, 0xcf,
+  0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd7, 0x00, 0x00, 0x00, 0x69, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x70, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7a, 0xaa, 0xad, 0xfe, 0xaa, 0xaa, 0x70,
+  0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb,
+  0x00, 0x00, 0x3f, 0x70, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x6f, 0x20, 0x48, 0x8c, 0xfd, 0x88, 0x85,
+  0x9c, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xfb, 0x65, 0x00, 0x7c, 0xce, 0xfe, 0xcc, 0xc8, 0x00, 0x00,
+  0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x70, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7a,
+  0xaa, 0xad, 0xfe, 0xaa, 0xaa, 0x70, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7c, 0xfc, 0x77,
+  0x10, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x19, 0x9d, 0xfd, 0x99, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0x00,
+  0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x48, 0x8c, 0xfd, 0x88, 0x85,
+  0x8f, 0xff, 0xff, 0xff, 0xfb, 0x7c, 0xce, 0xfe, 0xcc, 0xc8, 0x06, 0x6b, 0xfd, 0x66, 0x20, 0x0e,
+  0xff, 0xff, 0xff, 0x40, 0x09, 0x9d, 0xfd, 0x99, 0x20, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09,
+  0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0xff, 0xb4, 0xdd, 0x00, 0x00, 0x00, 0x0b, 0xfb, 0xff, 0xf9,
+  0x00, 0x00, 0x00, 0x0a, 0x80, 0x4a, 0x91, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60,
+  0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b,
+  0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe,
+  0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x22, 0x00, 0x43, 0x00, 0x00, 0x07, 0xff, 0x95, 0xfa, 0x00,
+  0x00, 0x1e, 0xec, 0xff, 0xf5, 0x00, 0x00, 0x2b, 0x50, 0x6b, 0x70, 0x00, 0x08, 0x82, 0x00, 0x00,
+  0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3,
+  0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7,
+  0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff,
+  0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00, 0x04, 0x99, 0x99, 0x94, 0x00, 0x00, 0x00,
+  0x07, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x73, 0x00, 0x00, 0x89, 0x30, 0x00,
+  0x00, 0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff,
+  0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x07, 0x99, 0x99, 0x92, 0x00, 0x00, 0x0b,
+  0xff, 0xff, 0xf3, 0x00, 0x00, 0x05, 0x77, 0x77, 0x71, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84,
+  0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00,
+  0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6,
+  0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7,
+  0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00, 0x0a, 0x70, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x0c, 0xf9,
+  0x69, 0xfc, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x38, 0xa8, 0x30,
+  0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01,
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x3a, 0x50,
+  0x00, 0x98, 0x00, 0x00, 0x1f, 0xe7, 0x6b, 0xf8, 0x00, 0x00, 0x07, 0xff, 0xff, 0xd2, 0x00, 0x00,
+  0x00, 0x49, 0xa7, 0x10, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c,
+  0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00,
+  0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b,
+  0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff,
+  0xe3, 0x00, 0x00, 0x3c, 0xec, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x5d, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0xec, 0x2c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00, 0x00, 0x89, 0x30, 0x01,
+  0x31, 0x00, 0x69, 0x60, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff,
+  0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x6d, 0xeb, 0x20, 0x00, 0x00, 0x02,
+  0xfb, 0x6f, 0xa0, 0x00, 0x00, 0x03, 0xf9, 0x3f, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xfd, 0x30, 0x00,
+  0x08, 0x82, 0x01, 0x20, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00,
+  0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3,
+  0x00, 0x00, 0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7,
+  0x02, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x08, 0xf3, 0x00, 0x00, 0x00, 0x7f, 0xc4, 0xaf, 0xa2,
+  0x00, 0x00, 0x00, 0x94, 0x01, 0x93, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60, 0xef,
+  0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00,
+  0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00,
+  0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0,
+  0xaf, 0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff,
+  0xb6, 0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff,
+  0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x09, 0xf2, 0x1b, 0xd1, 0x00,
+  0x00, 0xaf, 0xa4, 0xcf, 0x91, 0x00, 0x01, 0x93, 0x03, 0x81, 0x00, 0x08, 0x82, 0x00, 0x00, 0x06,
+  0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00,
+  0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x0e,
+  0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef, 0xff, 0xff, 0xff,
+  0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x89, 0x30, 0x00, 0x00, 0x00, 0x69, 0x60, 0xef, 0x50,
+  0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00,
+  0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f,
+  0xa0, 0xef, 0x50, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0xaf,
+  0xb0, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x5f, 0xf6, 0x00, 0x00, 0x00, 0x9f, 0xa0, 0x0b, 0xff, 0xb6,
+  0x44, 0x44, 0xbf, 0xa0, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x05, 0xbe, 0xff, 0xff,
+  0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xcb, 0x50, 0x08, 0x82,
+  0x00, 0x00, 0x06, 0x84, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7,
+  0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00, 0x0c, 0xf7, 0x1f, 0xf3, 0x00, 0x00,
+  0x0c, 0xf7, 0x0e, 0xf6, 0x00, 0x00, 0x0c, 0xf7, 0x0b, 0xfe, 0x74, 0x44, 0x4d, 0xf7, 0x02, 0xef,
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0x2a, 0xef, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x0a, 0xe2, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0xe7, 0x00, 0x00, 0x00, 0x07,
+  0xcc, 0xa3, 0x00, 0x00, 0x00, 0x02, 0xbb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff,
+  0xf9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xfe, 0x87, 0xef, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x18, 0x40, 0x00, 0x00, 0x39, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x3f,
+  0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf3, 0x0f, 0xf5, 0x00, 0x00, 0x56, 0x00, 0x00, 0x4f,
+  0xf1, 0x0c, 0xf8, 0x00, 0x04, 0xff, 0x50, 0x00, 0x7f, 0xd0, 0x0a, 0xfa, 0x00, 0x1d, 0xff, 0xd1,
+  0x00, 0xaf, 0xa0, 0x07, 0xfd, 0x00, 0x8f, 0xff, 0xf9, 0x00, 0xcf, 0x80, 0x04, 0xff, 0x13, 0xff,
+  0x98, 0xff, 0x30, 0xff, 0x50, 0x01, 0xff, 0x4c, 0xfe, 0x11, 0xdf, 0xc3, 0xff, 0x20, 0x00, 0xef,
+  0xcf, 0xf5, 0x00, 0x5f, 0xfc, 0xfe, 0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x0a, 0xff, 0xfc, 0x00,
+  0x00, 0x8f, 0xff, 0x20, 0x00, 0x02, 0xef, 0xf9, 0x00, 0x00, 0x6f, 0xf8, 0x00, 0x00, 0x00, 0x7f,
+  0xf7, 0x00, 0x00, 0x2e, 0xd1, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff,
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe7, 0x8e, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x57, 0x10,
+  0x01, 0x84, 0x00, 0x00, 0x78, 0x30, 0x00, 0x06, 0x20, 0x00, 0x07, 0x84, 0xef, 0x50, 0x00, 0xaf,
+  0xc0, 0x00, 0x5f, 0xf3, 0xef, 0x50, 0x09, 0xff, 0xd0, 0x00, 0xdf, 0xb0, 0xef, 0x50, 0x7f, 0xff,
+  0xd0, 0x07, 0xff, 0x30, 0xef, 0x56, 0xff, 0xef, 0xd0, 0x2e, 0xf9, 0x00, 0xef, 0xaf, 0xfb, 0x7f,
+  0xd0, 0xcf, 0xd1, 0x00, 0xef, 0xff, 0xc1, 0x7f, 0xda, 0xff, 0x40, 0x00, 0xef, 0xfd, 0x10, 0x7f,
+  0xff, 0xf6, 0x00, 0x00, 0xef, 0xe2, 0x00, 0x7f, 0xff, 0x70, 0x00, 0x00, 0xae, 0x30, 0x00, 0x3e,
+  0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xab, 0x30, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xff, 0xf9,
+  0x10, 0x00, 0x00, 0x0c, 0xfe, 0x87, 0xef, 0xd0, 0x00, 0x00, 0x04, 0x81, 0x00, 0x18, 0x50, 0x00,
+  0x29, 0x90, 0x00, 0x00, 0x00, 0x09, 0x93, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0,
+  0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0xf5, 0x2f, 0xf4, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x0d, 0xfe, 0x87, 0x77, 0x78, 0xef,
+  0xd0, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x29, 0xcd, 0xff, 0xdc, 0x92, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x50, 0x00,
+  0x00, 0x00, 0x6e, 0xff, 0xfb, 0x30, 0x00, 0x08, 0xff, 0xa6, 0xcf, 0xf3, 0x00, 0x01, 0x93, 0x00,
+  0x05, 0x80, 0x00, 0x78, 0x20, 0x00, 0x00, 0x68, 0x40, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff,
+  0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf,
+  0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xff, 0x50, 0x00, 0x00, 0xbf, 0x80, 0xef, 0xb4, 0x44,
+  0x41, 0xbf, 0x80, 0x7f, 0xff, 0xff, 0xf5, 0xbf, 0x80, 0x07, 0xdf, 0xff, 0xf5, 0xbf, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x02, 0x22, 0x23, 0xef, 0x70, 0x00, 0x0c, 0xff, 0xff, 0xff,
+  0x20, 0x00, 0x0c, 0xff, 0xff, 0xd5, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x77,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0xff, 0x10, 0xff, 0x20, 0x00, 0x00, 0x00, 0x66, 0x00, 0x56,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x90, 0x00, 0x00, 0x00, 0x09, 0x93,
+  0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0,
+  0x00, 0x00, 0x00, 0x0e, 0xf5, 0x4f, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x2f, 0xf4, 0x00, 0x00,
+  0x00, 0x3f, 0xf3, 0x0d, 0xfe, 0x87, 0x77, 0x78, 0xef, 0xd0, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0x00, 0x29, 0xcd, 0xff, 0xdc, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xef,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x60, 0x00, 0x00, 0x00, 0x00, 0x87, 0x10, 0x00, 0x00,
+  0x29, 0x99, 0x99, 0x99, 0x99, 0x96, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x3a, 0xaa,
+  0xaa, 0xaa, 0xdf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x3e,
+  0xfd, 0x10, 0x00, 0x00, 0x00, 0x02, 0xef, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xfe, 0x30, 0x00,
+  0x00, 0x00, 0x01, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc4, 0x44, 0x44, 0x44, 0x00, 0x3f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x02, 0xa3,
+  0x00, 0x00, 0x00, 0x01, 0x8f, 0xfa, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x09,
+  0x61, 0x00, 0x00, 0x28, 0x88, 0x88, 0x88, 0x85, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3c,
+  0xcc, 0xcc, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10,
+  0x00, 0x00, 0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00, 0x07, 0xff, 0xe5,
+  0x44, 0x44, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00,
+  0x00, 0x03, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x81, 0x00, 0x00, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x96, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x3a, 0xaa, 0xaa, 0xaa, 0xdf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc1, 0x00,
+  0x00, 0x00, 0x00, 0x3e, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x02, 0xef, 0xe2, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc4, 0x44, 0x44, 0x44,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00,
+  0x00, 0x39, 0x20, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x00,
+  0x00, 0x28, 0x88, 0x88, 0x88, 0x85, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3c, 0xcc, 0xcc,
+  0xff, 0xfb, 0x00, 0x00, 0x00, 0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00,
+  0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00, 0x07, 0xff, 0xe5, 0x44, 0x44,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x19, 0x40,
+  0x00, 0x59, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x6c, 0xff, 0x40, 0x00, 0x00, 0x05, 0xdf, 0xff, 0xc4,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x29, 0x99, 0x99, 0x99, 0x99, 0x96, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x3a, 0xaa,
+  0xaa, 0xaa, 0xdf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x3e,
+  0xfd, 0x10, 0x00, 0x00, 0x00, 0x02, 0xef, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xfe, 0x30, 0x00,
+  0x00, 0x00, 0x01, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc4, 0x44, 0x44, 0x44, 0x00, 0x3f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x01, 0xa3, 0x00, 0x05, 0x90,
+  0x00, 0x07, 0xff, 0xb6, 0xcf, 0xf4, 0x00, 0x00, 0x5d, 0xff, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x7d,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x88, 0x88, 0x85, 0x00, 0x4f,
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x3c, 0xcc, 0xcc, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x07, 0xff, 0xb1,
+  0x00, 0x00, 0x00, 0x7f, 0xfb, 0x10, 0x00, 0x00, 0x07, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x7f, 0xfb,
+  0x10, 0x00, 0x00, 0x07, 0xff, 0xe5, 0x44, 0x44, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x2d,
+  0xff, 0xff, 0xff, 0xff, 0x10,
+};
+
+static const bfont_glyph bfont_audiowide_glyphs[]=
+{
+  {0,0,0,0,6,1,0},    // minx, maxy, w, h, advance, provided, offset
+  {1,13,3,13,5,1,0},
+  {0,13,7,6,7,1,26},
+  {0,13,13,13,13,1,50},
+  {0,13,9,13,10,1,141},
+  {0,12,15,12,16,1,206},
+  {1,12,11,12,12,1,302},
+  {0,13,3,6,4,1,374},
+  {0,15,8,17,8,1,386},
+  {0,15,8,17,8,1,454},
+  {1,13,8,9,10,1,522},
+  {0,11,9,9,10,1,558},
+  {0,3,4,5,4,1,603},
+  {1,8,9,3,10,1,613},
+  {0,3,3,3,4,1,628},
+  {0,13,12,13,12,1,634},
+  {1,13,15,13,17,1,712},
+  {0,13,5,13,6,1,816},
+  {0,13,13,13,14,1,855},
+  {1,13,11,13,13,1,946},
+  {0,13,13,13,14,1,1024},
+  {1,13,12,13,14,1,1115},
+  {1,13,12,13,13,1,1193},
+  {0,13,12,13,12,1,1271},
+  {0,13,13,13,13,1,1349},
+  {0,13,13,13,13,1,1440},
+  {1,10,3,10,4,1,1531},
+  {0,10,4,12,5,1,1551},
+  {0,12,9,11,9,1,1575},
+  {1,10,9,7,11,1,1630},
+  {0,12,9,11,9,1,1665},
+  {0,13,12,13,12,1,1720},
+  {1,10,10,11,12,1,1798},
+  {1,13,13,13,15,1,1853},
+  {1,13,13,13,15,1,1944},
+  {1,13,12,13,13,1,2035},
+  {1,13,13,13,15,1,2113},
+  {1,13,12,13,14,1,2204},
+  {1,13,12,13,13,1,2282},
+  {1,13,13,13,15,1,2360},
+  {1,13,13,13,15,1,2451},
+  {1,13,3,13,5,1,2542},
+  {0,13,12,13,13,1,2568},
+  {1,13,14,13,15,1,2646},
+  {1,13,12,13,13,1,2737},
+  {1,13,15,14,17,1,2815},
+  {1,13,13,14,15,1,2927},
+  {0,13,15,14,15,1,3025},
+  {1,13,13,13,15,1,3137},
+  {0,13,15,15,15,1,3228},
+  {1,13,14,13,15,1,3348},
+  {0,13,14,13,14,1,3439},
+  {0,13,13,13,13,1,3530},
+  {1,13,13,13,15,1,3621},
+  {-1,13,15,14,14,1,3712},
+  {0,13,18,14,18,1,3824},
+  {0,13,15,13,14,1,3950},
+  {0,13,14,13,14,1,4054},
+  {0,13,13,13,13,1,4145},
+  {1,15,5,18,7,1,4236},
+  {0,13,12,13,12,1,4290},
+  {0,15,6,18,7,1,4368},
+  {0,13,8,7,8,1,4422},
+  {1,-1,11,3,12,1,4450},
+  {1,14,6,4,10,1,4468},
+  {0,10,11,10,12,1,4480},
+  {1,14,11,14,12,1,4540},
+  {0,10,11,10,11,1,4624},
+  {0,14,12,14,13,1,4684},
+  {0,10,12,10,12,1,4768},
+  {1,14,9,14,10,1,4828},
+  {0,10,12,15,12,1,4898},
+  {1,14,11,14,13,1,4988},
+  {1,14,3,14,5,1,5072},
+  {-4,14,8,19,5,1,5100},
+  {1,14,12,14,12,1,5176},
+  {1,14,5,14,6,1,5260},
+  {1,10,14,10,16,1,5302},
+  {1,10,11,10,13,1,5372},
+  {0,10,12,10,12,1,5432},
+  {1,10,11,13,12,1,5492},
+  {0,10,12,13,12,1,5570},
+  {1,10,9,10,10,1,5648},
+  {0,10,11,10,11,1,5698},
+  {0,13,10,13,10,1,5758},
+  {0,10,12,10,13,1,5823},
+  {1,10,12,11,12,1,5883},
+  {1,10,16,10,16,1,5949},
+  {0,10,13,10,13,1,6029},
+  {1,10,11,15,13,1,6099},
+  {0,10,11,10,11,1,6189},
+  {0,15,8,18,8,1,6249},
+  {1,15,3,18,5,1,6321},
+  {0,15,8,18,8,1,6357},
+  {0,8,11,4,11,1,6429},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,0,6453},
+  {0,0,0,0,6,1,6453},
+  {0,9,4,13,4,1,6453},
+  {0,13,9,13,9,1,6479},
+  {0,13,16,13,16,1,6544},
+  {0,10,8,7,8,1,6648},
+  {0,13,14,13,15,1,6676},
+  {1,15,3,18,5,1,6767},
+  {1,15,13,18,15,1,6803},
+  {1,13,8,3,10,1,6929},
+  {1,12,11,11,13,1,6941},
+  {0,13,10,9,11,1,7007},
+  {0,9,12,8,13,1,7052},
+  {0,8,10,6,10,1,7100},
+  {1,8,9,3,10,1,7130},
+  {1,12,11,11,13,1,7145},
+  {2,13,6,3,10,1,7211},
+  {0,13,6,7,6,1,7220},
+  {1,10,9,10,10,1,7241},
+  {0,12,7,7,7,1,7291},
+  {1,12,6,7,7,1,7319},
+  {3,14,6,4,10,1,7340},
+  {1,10,11,15,13,1,7352},
+  {0,13,16,13,17,1,7442},
+  {0,8,4,3,4,1,7546},
+  {1,1,6,5,9,1,7552},
+  {0,12,4,7,4,1,7567},
+  {1,13,9,9,11,1,7581},
+  {0,9,12,8,13,1,7626},
+  {0,12,14,12,14,1,7674},
+  {0,12,13,12,14,1,7758},
+  {1,12,15,12,17,1,7842},
+  {0,9,12,13,12,1,7938},
+  {1,18,13,18,15,1,8016},
+  {1,18,13,18,15,1,8142},
+  {1,18,13,18,15,1,8268},
+  {1,18,13,18,15,1,8394},
+  {1,17,13,17,15,1,8520},
+  {1,18,13,18,15,1,8639},
+  {1,13,22,13,24,1,8765},
+  {1,13,12,17,13,1,8908},
+  {1,18,12,18,14,1,9010},
+  {1,18,12,18,14,1,9118},
+  {1,18,12,18,14,1,9226},
+  {1,17,12,17,14,1,9334},
+  {-3,18,7,18,5,1,9436},
+  {1,18,7,18,5,1,9508},
+  {-2,18,9,18,5,1,9580},
+  {-1,17,7,17,5,1,9670},
+  {0,13,16,13,17,1,9738},
+  {1,17,13,18,15,1,9842},
+  {0,18,15,19,15,1,9968},
+  {0,18,15,19,15,1,10120},
+  {0,18,15,19,15,1,10272},
+  {0,18,15,19,15,1,10424},
+  {0,17,15,18,15,1,10576},
+  {0,10,10,7,10,1,10720},
+  {0,14,15,15,16,1,10755},
+  {1,17,13,17,15,1,10875},
+  {1,17,13,17,15,1,10994},
+  {1,18,13,18,15,1,11113},
+  {1,16,13,16,15,1,11239},
+  {0,16,14,16,14,1,11351},
+  {1,14,13,15,15,1,11463},
+  {1,14,13,14,14,1,11568},
+  {0,15,11,15,12,1,11666},
+  {0,15,11,15,12,1,11756},
+  {0,15,11,15,12,1,11846},
+  {0,15,11,15,12,1,11936},
+  {0,14,11,14,12,1,12026},
+  {0,15,11,15,12,1,12110},
+  {0,10,20,10,20,1,12200},
+  {0,10,11,14,11,1,12300},
+  {0,15,12,15,12,1,12384},
+  {0,15,12,15,12,1,12474},
+  {0,15,12,15,12,1,12564},
+  {0,14,12,14,12,1,12654},
+  {-3,15,7,15,5,1,12738},
+  {1,15,6,15,5,1,12798},
+  {-2,14,9,14,5,1,12843},
+  {-1,14,7,14,5,1,12913},
+  {0,15,14,15,12,1,12969},
+  {1,15,11,15,13,1,13074},
+  {0,15,12,15,12,1,13164},
+  {0,15,12,15,12,1,13254},
+  {0,15,12,15,12,1,13344},
+  {0,15,12,15,12,1,13434},
+  {0,14,12,14,12,1,13524},
+  {0,11,10,9,10,1,13608},
+  {0,11,12,12,12,1,13653},
+  {0,14,12,14,13,1,13725},
+  {0,14,12,14,13,1,13809},
+  {0,15,12,15,13,1,13893},
+  {0,14,12,14,13,1,13983},
+  {1,13,11,18,13,1,14067},
+  {1,14,11,17,13,1,14175},
+  {1,14,11,19,13,1,14277},
+  {1,16,13,16,15,1,14391},
+  {0,13,11,13,12,1,14503},
+  {1,17,13,17,15,1,14581},
+  {0,14,11,14,12,1,14700},
+  {1,13,15,17,15,1,14784},
+  {0,10,11,14,12,1,14920},
+  {1,17,12,17,13,1,15004},
+  {0,14,11,14,11,1,15106},
+  {1,17,12,17,13,1,15190},
+  {0,14,11,14,11,1,15292},
+  {1,16,12,16,13,1,15376},
+  {0,13,11,13,11,1,15472},
+  {1,17,12,17,13,1,15550},
+  {0,14,11,14,11,1,15652},
+  {1,17,13,17,15,1,15736},
+  {0,14,15,14,15,1,15855},
+  {0,13,16,13,17,1,15967},
+  {0,14,14,14,12,1,16071},
+  {1,16,12,16,14,1,16169},
+  {0,13,12,13,12,1,16265},
+  {1,17,12,17,14,1,16343},
+  {0,14,12,14,12,1,16445},
+  {1,16,12,16,14,1,16529},
+  {0,13,12,13,12,1,16625},
+  {1,13,12,17,14,1,16703},
+  {0,10,12,14,12,1,16805},
+  {1,17,12,17,14,1,16889},
+  {0,14,12,14,12,1,16991},
+  {1,17,13,17,15,1,17075},
+  {0,14,12,19,12,1,17194},
+  {1,17,13,17,15,1,17308},
+  {0,14,12,19,12,1,17427},
+  {1,16,13,16,15,1,17541},
+  {0,13,12,18,12,1,17653},
+  {1,13,13,19,15,1,17761},
+  {0,15,12,20,12,1,17894},
+  {1,17,13,17,15,1,18014},
+  {1,14,11,14,13,1,18133},
+  {0,13,15,13,15,1,18217},
+  {-1,14,13,14,13,1,18321},
+  {-1,17,7,17,5,1,18419},
+  {-2,14,8,14,5,1,18487},
+  {-1,16,7,16,5,1,18543},
+  {-1,13,7,13,5,1,18607},
+  {-2,17,9,17,5,1,18659},
+  {-2,14,8,14,5,1,18744},
+  {0,13,6,17,5,1,18800},
+  {0,14,5,18,5,1,18851},
+  {1,16,3,16,5,1,18905},
+  {1,10,3,10,5,1,18937},
+  {1,13,16,13,18,1,18957},
+  {0,14,8,19,8,1,19061},
+  {0,17,15,17,13,1,19137},
+  {-4,14,11,19,5,1,19273},
+  {1,13,14,19,15,1,19387},
+  {1,14,12,20,12,1,19520},
+  {1,14,12,14,12,1,19640},
+  {1,17,12,17,13,1,19724},
+  {1,18,6,18,6,1,19826},
+  {1,13,12,19,13,1,19880},
+  {1,14,5,20,6,1,19994},
+  {1,15,12,15,13,1,20054},
+  {1,14,8,14,9,1,20144},
+  {1,13,14,13,15,1,20200},
+  {1,14,6,14,7,1,20291},
+  {0,13,15,13,15,1,20333},
+  {0,14,8,14,8,1,20437},
+  {1,17,13,18,15,1,20493},
+  {1,14,11,14,13,1,20619},
+  {1,13,13,19,15,1,20703},
+  {1,10,11,16,13,1,20836},
+  {1,17,13,18,15,1,20932},
+  {1,14,11,14,13,1,21058},
+  {0,12,14,12,14,1,21142},
+  {1,13,13,19,15,1,21226},
+  {1,10,11,16,13,1,21359},
+  {0,16,15,17,15,1,21455},
+  {0,13,12,13,12,1,21591},
+  {0,17,15,18,15,1,21669},
+  {0,14,12,14,12,1,21813},
+  {0,17,15,18,15,1,21897},
+  {0,14,12,14,12,1,22041},
+  {0,13,24,14,25,1,22125},
+  {0,10,20,10,20,1,22293},
+  {1,17,14,17,15,1,22393},
+  {1,14,9,14,10,1,22512},
+  {1,13,14,19,15,1,22582},
+  {1,10,9,16,10,1,22715},
+  {1,17,14,17,15,1,22795},
+  {0,14,10,14,10,1,22914},
+  {0,17,14,17,14,1,22984},
+  {0,14,11,14,11,1,23103},
+  {0,17,14,17,14,1,23187},
+  {0,14,11,14,11,1,23306},
+  {0,13,14,17,14,1,23390},
+  {0,10,11,14,11,1,23509},
+  {0,18,14,18,14,1,23593},
+  {0,14,11,14,11,1,23719},
+  {0,13,13,19,13,1,23803},
+  {0,13,10,19,10,1,23936},
+  {0,17,13,17,13,1,24031},
+  {0,13,13,13,13,1,24150},
+  {0,13,13,13,13,1,24241},
+  {0,13,10,13,10,1,24332},
+  {1,17,13,17,15,1,24397},
+  {0,14,12,14,13,1,24516},
+  {1,16,13,16,15,1,24600},
+  {0,13,12,13,13,1,24712},
+  {1,17,13,17,15,1,24790},
+  {0,14,12,14,13,1,24909},
+  {1,17,13,17,15,1,24993},
+  {0,14,12,14,13,1,25112},
+  {1,17,13,17,15,1,25196},
+  {0,14,12,14,13,1,25315},
+  {1,13,13,17,15,1,25399},
+  {0,10,12,14,13,1,25518},
+  {0,17,18,18,18,1,25602},
+  {1,14,16,14,16,1,25764},
+  {0,17,14,17,14,1,25876},
+  {1,14,11,19,13,1,25995},
+  {0,17,14,17,14,1,26109},
+  {0,17,13,17,13,1,26228},
+  {0,14,11,14,11,1,26347},
+  {0,16,13,16,13,1,26431},
+  {0,13,11,13,11,1,26543},
+  {0,18,13,18,13,1,26621},
+  {0,15,11,15,11,1,26747},
+  {0,0,0,0,6,0,6453},
+};
+
+static const bfont_kern bfont_audiowide_kern[]=
+{
+  {34,44,-1},
+  {34,46,-1},
+  {34,47,-1},
+  {34,74,-1},
+  {34,97,-1},
+  {34,225,-1},
+  {34,226,-1},
+  {34,227,-1},
+  {34,228,-1},
+  {34,229,-1},
+  {34,230,-1},
+  {34,257,-1},
+  {34,308,-1},
+  {39,44,-1},
+  {39,46,-1},
+  {39,47,-1},
+  {39,74,-1},
+  {39,228,-1},
+  {39,230,-1},
+  {39,257,-1},
+  {39,259,-1},
+  {39,261,-1},
+  {39,308,-1},
+  {40,40,-1},
+  {40,48,-1},
+  {40,54,-1},
+  {40,56,-1},
+  {40,57,-1},
+  {40,67,-1},
+  {40,69,-1},
+  {40,71,-1},
+  {40,79,-1},
+  {40,81,-1},
+  {40,97,-1},
+  {40,99,-1},
+  {40,100,-1},
+  {40,101,-1},
+  {40,103,-1},
+  {40,106,3},
+  {40,111,-1},
+  {40,113,-1},
+  {40,116,-1},
+  {40,117,-1},
+  {40,118,-1},
+  {40,119,-1},
+  {40,121,-1},
+  {40,123,-1},
+  {40,199,-1},
+  {40,200,-1},
+  {40,201,-1},
+  {40,202,-1},
+  {40,203,-1},
+  {40,210,-1},
+  {40,211,-1},
+  {40,212,-1},
+  {40,213,-1},
+  {40,214,-1},
+  {40,216,-1},
+  {40,224,-1},
+  {40,225,-1},
+  {40,226,-1},
+  {40,227,-1},
+  {40,228,-1},
+  {40,229,-1},
+  {40,230,-1},
+  {40,231,-1},
+  {40,232,-1},
+  {40,233,-1},
+  {40,234,-1},
+  {40,235,-1},
+  {40,240,-1},
+  {40,242,-1},
+  {40,243,-1},
+  {40,244,-1},
+  {40,245,-1},
+  {40,246,-1},
+  {40,248,-1},
+  {40,249,-1},
+  {40,250,-1},
+  {40,251,-1},
+  {40,252,-1},
+  {40,253,-1},
+  {40,255,-1},
+  {40,257,-1},
+  {40,259,-1},
+  {40,261,-1},
+  {40,262,-1},
+  {40,263,-1},
+  {40,264,-1},
+  {40,265,-1},
+  {40,266,-1},
+  {40,267,-1},
+  {40,268,-1},
+  {40,269,-1},
+  {40,271,-1},
+  {40,274,-1},
+  {40,275,-1},
+  {40,276,-1},
+  {40,277,-1},
+  {40,278,-1},
+  {40,279,-1},
+  {40,280,-1},
+  {40,281,-1},
+  {40,282,-1},
+  {40,283,-1},
+  {40,284,-1},
+  {40,285,-1},
+  {40,286,-1},
+  {40,287,-1},
+  {40,288,-1},
+  {40,289,-1},
+  {40,290,-1},
+  {40,291,-1},
+  {40,309,3},
+  {40,332,-1},
+  {40,333,-1},
+  {40,334,-1},
+  {40,335,-1},
+  {40,336,-1},
+  {40,337,-1},
+  {40,338,-1},
+  {40,339,-1},
+  {40,355,-1},
+  {40,359,-1},
+  {40,361,-1},
+  {40,363,-1},
+  {40,365,-1},
+  {40,367,-1},
+  {40,369,-1},
+  {40,371,-1},
+  {40,373,-1},
+  {40,375,-1},
+  {41,41,-1},
+  {42,74,-1},
+  {42,308,-1},
+  {44,34,-1},
+  {44,39,-1},
+  {44,45,-1},
+  {44,52,-1},
+  {44,84,-1},
+  {44,86,-1},
+  {44,89,-1},
+  {44,221,-1},
+  {44,354,-1},
+  {44,356,-1},
+  {44,358,-1},
+  {44,374,-1},
+  {44,376,-1},
+  {45,74,-1},
+  {45,84,-1},
+  {45,88,-1},
+  {45,308,-1},
+  {45,354,-1},
+  {45,356,-1},
+  {45,358,-1},
+  {46,34,-1},
+  {46,39,-1},
+  {46,45,-1},
+  {46,52,-1},
+  {46,84,-1},
+  {46,86,-1},
+  {46,89,-1},
+  {46,221,-1},
+  {46,354,-1},
+  {46,356,-1},
+  {46,358,-1},
+  {46,374,-1},
+  {46,376,-1},
+  {47,47,-4},
+  {47,65,-1},
+  {47,74,-2},
+  {47,97,-1},
+  {47,99,-1},
+  {47,100,-1},
+  {47,101,-1},
+  {47,103,-1},
+  {47,109,-1},
+  {47,110,-1},
+  {47,111,-1},
+  {47,112,-1},
+  {47,113,-1},
+  {47,114,-1},
+  {47,115,-1},
+  {47,192,-1},
+  {47,193,-1},
+  {47,194,-1},
+  {47,195,-1},
+  {47,196,-1},
+  {47,197,-1},
+  {47,198,-1},
+  {47,224,-1},
+  {47,225,-1},
+  {47,226,-1},
+  {47,227,-1},
+  {47,228,-1},
+  {47,229,-1},
+  {47,230,-1},
+  {47,231,-1},
+  {47,232,-1},
+  {47,233,-1},
+  {47,234,-1},
+  {47,235,-1},
+  {47,240,-1},
+  {47,241,-1},
+  {47,242,-1},
+  {47,243,-1},
+  {47,244,-1},
+  {47,245,-1},
+  {47,246,-1},
+  {47,248,-1},
+  {47,256,-1},
+  {47,257,-1},
+  {47,258,-1},
+  {47,259,-1},
+  {47,260,-1},
+  {47,261,-1},
+  {47,263,-1},
+  {47,265,-1},
+  {47,267,-1},
+  {47,269,-1},
+  {47,271,-1},
+  {47,275,-1},
+  {47,277,-1},
+  {47,279,-1},
+  {47,281,-1},
+  {47,283,-1},
+  {47,285,-1},
+  {47,287,-1},
+  {47,289,-1},
+  {47,291,-1},
+  {47,308,-2},
+  {47,324,-1},
+  {47,326,-1},
+  {47,328,-1},
+  {47,331,-1},
+  {47,333,-1},
+  {47,335,-1},
+  {47,337,-1},
+  {47,339,-1},
+  {47,341,-1},
+  {47,343,-1},
+  {47,345,-1},
+  {47,347,-1},
+  {47,349,-1},
+  {47,351,-1},
+  {47,353,-1},
+  {48,41,-1},
+  {51,41,-1},
+  {53,41,-1},
+  {54,41,-1},
+  {55,35,-1},
+  {55,44,-1},
+  {55,46,-1},
+  {55,47,-1},
+  {55,74,-1},
+  {55,308,-1},
+  {56,41,-1},
+  {57,41,-1},
+  {64,84,-1},
+  {64,354,-1},
+  {64,356,-1},
+  {64,358,-1},
+  {66,41,-1},
+  {68,41,-1},
+  {70,44,-1},
+  {70,46,-1},
+  {70,47,-1},
+  {70,74,-2},
+  {70,97,-1},
+  {70,224,-1},
+  {70,225,-1},
+  {70,226,-1},
+  {70,227,-1},
+  {70,228,-1},
+  {70,229,-1},
+  {70,230,-1},
+  {70,257,-1},
+  {70,259,-1},
+  {70,261,-1},
+  {70,308,-2},
+  {75,45,-1},
+  {75,116,-1},
+  {75,174,-1},
+  {75,355,-1},
+  {75,359,-1},
+  {76,34,-1},
+  {76,39,-1},
+  {76,42,-1},
+  {76,45,-1},
+  {76,52,-1},
+  {76,63,-1},
+  {76,84,-3},
+  {76,85,-1},
+  {76,86,-2},
+  {76,87,-1},
+  {76,89,-2},
+  {76,92,-2},
+  {76,116,-2},
+  {76,117,-1},
+  {76,183,-1},
+  {76,217,-1},
+  {76,218,-1},
+  {76,219,-1},
+  {76,220,-1},
+  {76,221,-2},
+  {76,249,-1},
+  {76,250,-1},
+  {76,251,-1},
+  {76,252,-1},
+  {76,354,-3},
+  {76,355,-2},
+  {76,356,-3},
+  {76,358,-3},
+  {76,359,-2},
+  {76,360,-1},
+  {76,361,-1},
+  {76,362,-1},
+  {76,363,-1},
+  {76,364,-1},
+  {76,365,-1},
+  {76,366,-1},
+  {76,367,-1},
+  {76,368,-1},
+  {76,369,-1},
+  {76,370,-1},
+  {76,371,-1},
+  {76,372,-1},
+  {76,374,-2},
+  {76,376,-2},
+  {79,41,-1},
+  {80,41,-1},
+  {80,44,-1},
+  {80,46,-1},
+  {80,47,-1},
+  {80,74,-1},
+  {80,88,-1},
+  {80,308,-1},
+  {83,41,-1},
+  {83,355,-1},
+  {83,359,-1},
+  {84,44,-1},
+  {84,45,-1},
+  {84,46,-1},
+  {84,47,-1},
+  {84,64,-1},
+  {84,65,-1},
+  {84,74,-3},
+  {84,97,-2},
+  {84,99,-1},
+  {84,100,-1},
+  {84,101,-1},
+  {84,103,-1},
+  {84,109,-1},
+  {84,110,-1},
+  {84,111,-1},
+  {84,112,-2},
+  {84,113,-1},
+  {84,114,-2},
+  {84,115,-1},
+  {84,116,-1},
+  {84,117,-1},
+  {84,118,-1},
+  {84,119,-1},
+  {84,120,-1},
+  {84,121,-1},
+  {84,122,-1},
+  {84,171,-1},
+  {84,187,-1},
+  {84,192,-1},
+  {84,193,-1},
+  {84,194,-1},
+  {84,195,-1},
+  {84,196,-1},
+  {84,197,-1},
+  {84,198,-1},
+  {84,224,-2},
+  {84,225,-2},
+  {84,226,-2},
+  {84,227,-2},
+  {84,228,-2},
+  {84,229,-2},
+  {84,230,-2},
+  {84,231,-1},
+  {84,232,-1},
+  {84,233,-1},
+  {84,234,-1},
+  {84,235,-1},
+  {84,240,-1},
+  {84,241,-1},
+  {84,242,-1},
+  {84,243,-1},
+  {84,244,-1},
+  {84,245,-1},
+  {84,246,-1},
+  {84,248,-1},
+  {84,249,-1},
+  {84,250,-1},
+  {84,251,-1},
+  {84,252,-1},
+  {84,253,-1},
+  {84,255,-1},
+  {84,256,-1},
+  {84,257,-2},
+  {84,258,-1},
+  {84,259,-2},
+  {84,260,-1},
+  {84,261,-2},
+  {84,263,-1},
+  {84,265,-1},
+  {84,267,-1},
+  {84,269,-1},
+  {84,271,-1},
+  {84,275,-1},
+  {84,277,-1},
+  {84,279,-1},
+  {84,281,-1},
+  {84,283,-1},
+  {84,285,-1},
+  {84,287,-1},
+  {84,289,-1},
+  {84,291,-1},
+  {84,308,-3},
+  {84,324,-1},
+  {84,326,-1},
+  {84,328,-1},
+  {84,331,-1},
+  {84,333,-1},
+  {84,335,-1},
+  {84,337,-1},
+  {84,339,-1},
+  {84,341,-2},
+  {84,343,-2},
+  {84,345,-2},
+  {84,347,-1},
+  {84,349,-1},
+  {84,351,-1},
+  {84,353,-1},
+  {84,361,-1},
+  {84,363,-1},
+  {84,365,-1},
+  {84,367,-1},
+  {84,369,-1},
+  {84,371,-1},
+  {84,373,-1},
+  {84,375,-1},
+  {84,378,-1},
+  {84,380,-1},
+  {84,382,-1},
+  {86,44,-1},
+  {86,46,-1},
+  {86,47,-1},
+  {86,74,-2},
+  {86,97,-2},
+  {86,99,-1},
+  {86,100,-1},
+  {86,101,-1},
+  {86,103,-1},
+  {86,109,-1},
+  {86,110,-1},
+  {86,111,-1},
+  {86,112,-1},
+  {86,113,-1},
+  {86,114,-1},
+  {86,115,-1},
+  {86,171,-1},
+  {86,224,-2},
+  {86,225,-2},
+  {86,226,-2},
+  {86,227,-2},
+  {86,228,-2},
+  {86,229,-2},
+  {86,230,-2},
+  {86,231,-1},
+  {86,232,-1},
+  {86,233,-1},
+  {86,234,-1},
+  {86,235,-1},
+  {86,240,-1},
+  {86,241,-1},
+  {86,242,-1},
+  {86,243,-1},
+  {86,244,-1},
+  {86,245,-1},
+  {86,246,-1},
+  {86,248,-1},
+  {86,257,-2},
+  {86,259,-2},
+  {86,261,-2},
+  {86,263,-1},
+  {86,265,-1},
+  {86,267,-1},
+  {86,269,-1},
+  {86,271,-1},
+  {86,275,-1},
+  {86,277,-1},
+  {86,279,-1},
+  {86,281,-1},
+  {86,283,-1},
+  {86,285,-1},
+  {86,287,-1},
+  {86,289,-1},
+  {86,291,-1},
+  {86,308,-2},
+  {86,324,-1},
+  {86,326,-1},
+  {86,328,-1},
+  {86,331,-1},
+  {86,333,-1},
+  {86,335,-1},
+  {86,337,-1},
+  {86,339,-1},
+  {86,341,-1},
+  {86,343,-1},
+  {86,345,-1},
+  {86,347,-1},
+  {86,349,-1},
+  {86,351,-1},
+  {86,353,-1},
+  {87,74,-1},
+  {87,308,-1},
+  {88,45,-1},
+  {88,116,-1},
+  {88,174,-1},
+  {88,355,-1},
+  {88,359,-1},
+  {89,44,-1},
+  {89,46,-1},
+  {89,47,-1},
+  {89,74,-2},
+  {89,97,-1},
+  {89,224,-1},
+  {89,225,-1},
+  {89,226,-1},
+  {89,227,-1},
+  {89,228,-1},
+  {89,229,-1},
+  {89,230,-1},
+  {89,257,-1},
+  {89,259,-1},
+  {89,261,-1},
+  {89,308,-2},
+  {91,106,3},
+  {91,309,3},
+  {92,34,-1},
+  {92,39,-1},
+  {92,52,-1},
+  {92,84,-1},
+  {92,85,-1},
+  {92,86,-1},
+  {92,89,-1},
+  {92,116,-1},
+  {92,217,-1},
+  {92,218,-1},
+  {92,219,-1},
+  {92,220,-1},
+  {92,221,-1},
+  {92,354,-1},
+  {92,355,-1},
+  {92,356,-1},
+  {92,358,-1},
+  {92,359,-1},
+  {92,360,-1},
+  {92,362,-1},
+  {92,364,-1},
+  {92,366,-1},
+  {92,368,-1},
+  {92,370,-1},
+  {92,374,-1},
+  {92,376,-1},
+  {97,41,-1},
+  {97,92,-1},
+  {98,41,-1},
+  {98,92,-1},
+  {101,41,-1},
+  {101,92,-1},
+  {101,125,-1},
+  {102,44,-1},
+  {102,46,-1},
+  {102,47,-1},
+  {102,97,-1},
+  {102,224,-1},
+  {102,225,-1},
+  {102,226,-1},
+  {102,227,-1},
+  {102,228,-1},
+  {102,229,-1},
+  {102,230,-1},
+  {102,257,-1},
+  {102,259,-1},
+  {102,261,-1},
+  {103,92,-1},
+  {104,92,-1},
+  {107,171,-1},
+  {108,183,-1},
+  {109,92,-1},
+  {110,92,-1},
+  {111,41,-1},
+  {111,92,-1},
+  {112,41,-1},
+  {112,92,-1},
+  {113,92,-1},
+  {114,41,-1},
+  {114,44,-1},
+  {114,46,-1},
+  {114,47,-1},
+  {114,97,-1},
+  {114,224,-1},
+  {114,225,-1},
+  {114,226,-1},
+  {114,227,-1},
+  {114,228,-1},
+  {114,229,-1},
+  {114,230,-1},
+  {114,257,-1},
+  {114,259,-1},
+  {114,261,-1},
+  {115,41,-1},
+  {115,92,-1},
+  {116,41,-1},
+  {116,44,-1},
+  {116,46,-1},
+  {116,47,-1},
+  {116,97,-1},
+  {116,224,-1},
+  {116,225,-1},
+  {116,226,-1},
+  {116,227,-1},
+  {116,228,-1},
+  {116,229,-1},
+  {116,230,-1},
+  {116,257,-1},
+  {116,259,-1},
+  {116,261,-1},
+  {117,41,-1},
+  {118,44,-1},
+  {118,46,-1},
+  {118,47,-1},
+  {119,44,-1},
+  {119,46,-1},
+  {119,47,-1},
+  {120,171,-1},
+  {123,106,3},
+  {123,309,3},
+  {124,106,3},
+  {124,309,3},
+  {125,41,-1},
+  {161,84,-1},
+  {161,106,3},
+  {161,309,3},
+  {161,354,-1},
+  {161,356,-1},
+  {161,358,-1},
+  {163,55,-1},
+  {171,84,-1},
+  {171,354,-1},
+  {171,356,-1},
+  {171,358,-1},
+  {187,84,-1},
+  {187,86,-1},
+  {187,120,-1},
+  {187,354,-1},
+  {187,356,-1},
+  {187,358,-1},
+  {191,65,-1},
+  {191,66,-1},
+  {191,67,-1},
+  {191,68,-1},
+  {191,69,-1},
+  {191,70,-1},
+  {191,71,-1},
+  {191,72,-1},
+  {191,73,-1},
+  {191,75,-1},
+  {191,76,-1},
+  {191,77,-1},
+  {191,78,-1},
+  {191,79,-1},
+  {191,80,-1},
+  {191,81,-1},
+  {191,82,-1},
+  {191,83,-1},
+  {191,84,-1},
+  {191,85,-1},
+  {191,86,-1},
+  {191,87,-1},
+  {191,89,-1},
+  {191,90,-1},
+  {191,97,-1},
+  {191,98,-1},
+  {191,99,-1},
+  {191,100,-1},
+  {191,101,-1},
+  {191,102,-1},
+  {191,103,-1},
+  {191,104,-1},
+  {191,105,-1},
+  {191,106,3},
+  {191,107,-1},
+  {191,108,-1},
+  {191,109,-1},
+  {191,110,-1},
+  {191,111,-1},
+  {191,113,-1},
+  {191,114,-1},
+  {191,115,-1},
+  {191,116,-1},
+  {191,117,-1},
+  {191,118,-1},
+  {191,119,-1},
+  {191,121,-1},
+  {191,122,-1},
+  {191,192,-1},
+  {191,193,-1},
+  {191,194,-1},
+  {191,195,-1},
+  {191,196,-1},
+  {191,197,-1},
+  {191,198,-1},
+  {191,199,-1},
+  {191,200,-1},
+  {191,201,-1},
+  {191,202,-1},
+  {191,203,-1},
+  {191,204,-1},
+  {191,205,-1},
+  {191,206,-1},
+  {191,207,-1},
+  {191,208,-1},
+  {191,209,-1},
+  {191,210,-1},
+  {191,211,-1},
+  {191,212,-1},
+  {191,213,-1},
+  {191,214,-1},
+  {191,216,-1},
+  {191,217,-1},
+  {191,218,-1},
+  {191,219,-1},
+  {191,220,-1},
+  {191,221,-1},
+  {191,223,-1},
+  {191,224,-1},
+  {191,225,-1},
+  {191,226,-1},
+  {191,227,-1},
+  {191,228,-1},
+  {191,229,-1},
+  {191,230,-1},
+  {191,231,-1},
+  {191,232,-1},
+  {191,233,-1},
+  {191,234,-1},
+  {191,235,-1},
+  {191,236,-1},
+  {191,237,-1},
+  {191,238,-1},
+  {191,239,-1},
+  {191,240,-1},
+  {191,241,-1},
+  {191,242,-1},
+  {191,243,-1},
+  {191,244,-1},
+  {191,245,-1},
+  {191,246,-1},
+  {191,248,-1},
+  {191,249,-1},
+  {191,250,-1},
+  {191,251,-1},
+  {191,252,-1},
+  {191,253,-1},
+  {191,255,-1},
+  {191,256,-1},
+  {191,257,-1},
+  {191,258,-1},
+  {191,259,-1},
+  {191,260,-1},
+  {191,261,-1},
+  {191,262,-1},
+  {191,263,-1},
+  {191,264,-1},
+  {191,265,-1},
+  {191,266,-1},
+  {191,267,-1},
+  {191,268,-1},
+  {191,269,-1},
+  {191,270,-1},
+  {191,271,-1},
+  {191,272,-1},
+  {191,274,-1},
+  {191,275,-1},
+  {191,276,-1},
+  {191,277,-1},
+  {191,278,-1},
+  {191,279,-1},
+  {191,280,-1},
+  {191,281,-1},
+  {191,282,-1},
+  {191,283,-1},
+  {191,284,-1},
+  {191,285,-1},
+  {191,286,-1},
+  {191,287,-1},
+  {191,288,-1},
+  {191,289,-1},
+  {191,290,-1},
+  {191,291,-1},
+  {191,292,-1},
+  {191,293,-1},
+  {191,294,-1},
+  {191,295,-1},
+  {191,296,-1},
+  {191,297,-1},
+  {191,298,-1},
+  {191,299,-1},
+  {191,300,-1},
+  {191,301,-1},
+  {191,302,-1},
+  {191,303,-1},
+  {191,304,-1},
+  {191,305,-1},
+  {191,309,3},
+  {191,310,-1},
+  {191,311,-1},
+  {191,312,-1},
+  {191,313,-1},
+  {191,314,-1},
+  {191,315,-1},
+  {191,316,-1},
+  {191,321,-1},
+  {191,322,-1},
+  {191,323,-1},
+  {191,324,-1},
+  {191,325,-1},
+  {191,326,-1},
+  {191,327,-1},
+  {191,328,-1},
+  {191,330,-1},
+  {191,331,-1},
+  {191,332,-1},
+  {191,333,-1},
+  {191,334,-1},
+  {191,335,-1},
+  {191,336,-1},
+  {191,337,-1},
+  {191,338,-1},
+  {191,339,-1},
+  {191,340,-1},
+  {191,341,-1},
+  {191,342,-1},
+  {191,343,-1},
+  {191,344,-1},
+  {191,345,-1},
+  {191,346,-1},
+  {191,347,-1},
+  {191,348,-1},
+  {191,349,-1},
+  {191,350,-1},
+  {191,351,-1},
+  {191,352,-1},
+  {191,353,-1},
+  {191,354,-1},
+  {191,355,-1},
+  {191,356,-1},
+  {191,358,-1},
+  {191,359,-1},
+  {191,360,-1},
+  {191,361,-1},
+  {191,362,-1},
+  {191,363,-1},
+  {191,364,-1},
+  {191,365,-1},
+  {191,366,-1},
+  {191,367,-1},
+  {191,368,-1},
+  {191,369,-1},
+  {191,370,-1},
+  {191,371,-1},
+  {191,372,-1},
+  {191,373,-1},
+  {191,374,-1},
+  {191,375,-1},
+  {191,376,-1},
+  {191,377,-1},
+  {191,378,-1},
+  {191,379,-1},
+  {191,380,-1},
+  {191,381,-1},
+  {191,382,-1},
+  {208,41,-1},
+  {210,41,-1},
+  {211,41,-1},
+  {212,41,-1},
+  {213,41,-1},
+  {214,41,-1},
+  {216,41,-1},
+  {221,44,-1},
+  {221,46,-1},
+  {221,47,-1},
+  {221,74,-2},
+  {221,97,-1},
+  {221,224,-1},
+  {221,225,-1},
+  {221,226,-1},
+  {221,227,-1},
+  {221,228,-1},
+  {221,229,-1},
+  {221,230,-1},
+  {221,257,-1},
+  {221,259,-1},
+  {221,261,-1},
+  {221,308,-2},
+  {223,41,-1},
+  {223,63,-1},
+  {223,84,-1},
+  {223,86,-1},
+  {223,89,-1},
+  {223,92,-1},
+  {223,116,-1},
+  {223,221,-1},
+  {223,354,-1},
+  {223,355,-1},
+  {223,356,-1},
+  {223,358,-1},
+  {223,359,-1},
+  {223,374,-1},
+  {223,376,-1},
+  {224,41,-1},
+  {224,92,-1},
+  {225,41,-1},
+  {225,92,-1},
+  {226,41,-1},
+  {226,92,-1},
+  {227,41,-1},
+  {227,92,-1},
+  {228,41,-1},
+  {228,92,-1},
+  {229,41,-1},
+  {229,92,-1},
+  {232,41,-1},
+  {232,92,-1},
+  {232,125,-1},
+  {233,41,-1},
+  {233,92,-1},
+  {234,41,-1},
+  {234,92,-1},
+  {234,125,-1},
+  {235,41,-1},
+  {235,92,-1},
+  {235,125,-1},
+  {240,41,-1},
+  {240,92,-1},
+  {241,92,-1},
+  {242,41,-1},
+  {242,92,-1},
+  {243,41,-1},
+  {243,92,-1},
+  {244,41,-1},
+  {244,92,-1},
+  {245,41,-1},
+  {245,92,-1},
+  {246,41,-1},
+  {246,92,-1},
+  {248,41,-1},
+  {248,92,-1},
+  {249,41,-1},
+  {250,41,-1},
+  {251,41,-1},
+  {252,41,-1},
+  {257,41,-1},
+  {257,92,-1},
+  {259,41,-1},
+  {259,92,-1},
+  {261,41,-1},
+  {261,92,-1},
+  {270,41,-1},
+  {272,41,-1},
+  {275,41,-1},
+  {275,92,-1},
+  {277,41,-1},
+  {277,92,-1},
+  {279,41,-1},
+  {279,92,-1},
+  {279,125,-1},
+  {281,41,-1},
+  {281,92,-1},
+  {281,125,-1},
+  {283,41,-1},
+  {283,92,-1},
+  {283,125,-1},
+  {285,92,-1},
+  {287,92,-1},
+  {289,92,-1},
+  {291,92,-1},
+  {293,92,-1},
+  {295,92,-1},
+  {310,45,-1},
+  {310,116,-1},
+  {310,174,-1},
+  {310,355,-1},
+  {310,359,-1},
+  {311,171,-1},
+  {312,171,-1},
+  {313,34,-1},
+  {313,39,-1},
+  {313,42,-1},
+  {313,45,-1},
+  {313,52,-1},
+  {313,63,-1},
+  {313,84,-3},
+  {313,85,-1},
+  {313,86,-2},
+  {313,87,-1},
+  {313,89,-2},
+  {313,92,-2},
+  {313,116,-2},
+  {313,117,-1},
+  {313,183,-1},
+  {313,217,-1},
+  {313,218,-1},
+  {313,219,-1},
+  {313,220,-1},
+  {313,221,-2},
+  {313,249,-1},
+  {313,250,-1},
+  {313,251,-1},
+  {313,252,-1},
+  {313,354,-3},
+  {313,355,-2},
+  {313,356,-3},
+  {313,358,-3},
+  {313,359,-2},
+  {313,360,-1},
+  {313,361,-1},
+  {313,362,-1},
+  {313,363,-1},
+  {313,364,-1},
+  {313,365,-1},
+  {313,366,-1},
+  {313,367,-1},
+  {313,368,-1},
+  {313,369,-1},
+  {313,370,-1},
+  {313,371,-1},
+  {313,372,-1},
+  {313,374,-2},
+  {313,376,-2},
+  {314,183,-1},
+  {315,34,-1},
+  {315,39,-1},
+  {315,42,-1},
+  {315,45,-1},
+  {315,52,-1},
+  {315,63,-1},
+  {315,84,-3},
+  {315,85,-1},
+  {315,86,-2},
+  {315,87,-1},
+  {315,89,-2},
+  {315,92,-2},
+  {315,116,-2},
+  {315,117,-1},
+  {315,183,-1},
+  {315,217,-1},
+  {315,218,-1},
+  {315,219,-1},
+  {315,220,-1},
+  {315,221,-2},
+  {315,249,-1},
+  {315,250,-1},
+  {315,251,-1},
+  {315,252,-1},
+  {315,354,-3},
+  {315,355,-2},
+  {315,356,-3},
+  {315,358,-3},
+  {315,359,-2},
+  {315,360,-1},
+  {315,361,-1},
+  {315,362,-1},
+  {315,363,-1},
+  {315,364,-1},
+  {315,365,-1},
+  {315,366,-1},
+  {315,367,-1},
+  {315,368,-1},
+  {315,369,-1},
+  {315,370,-1},
+  {315,371,-1},
+  {315,372,-1},
+  {315,374,-2},
+  {315,376,-2},
+  {316,183,-1},
+  {321,34,-1},
+  {321,39,-1},
+  {321,42,-1},
+  {321,45,-1},
+  {321,52,-1},
+  {321,63,-1},
+  {321,84,-3},
+  {321,85,-1},
+  {321,86,-2},
+  {321,87,-1},
+  {321,89,-2},
+  {321,92,-2},
+  {321,116,-2},
+  {321,117,-1},
+  {321,183,-1},
+  {321,217,-1},
+  {321,218,-1},
+  {321,219,-1},
+  {321,220,-1},
+  {321,221,-2},
+  {321,249,-1},
+  {321,250,-1},
+  {321,251,-1},
+  {321,252,-1},
+  {321,354,-3},
+  {321,355,-2},
+  {321,356,-3},
+  {321,358,-3},
+  {321,359,-2},
+  {321,360,-1},
+  {321,361,-1},
+  {321,362,-1},
+  {321,363,-1},
+  {321,364,-1},
+  {321,365,-1},
+  {321,366,-1},
+  {321,367,-1},
+  {321,368,-1},
+  {321,369,-1},
+  {321,370,-1},
+  {321,371,-1},
+  {321,372,-1},
+  {321,374,-2},
+  {321,376,-2},
+  {322,183,-1},
+  {324,92,-1},
+  {326,92,-1},
+  {328,92,-1},
+  {331,92,-1},
+  {332,41,-1},
+  {333,41,-1},
+  {333,92,-1},
+  {334,41,-1},
+  {335,41,-1},
+  {335,92,-1},
+  {336,41,-1},
+  {337,41,-1},
+  {337,92,-1},
+  {341,41,-1},
+  {341,44,-1},
+  {341,46,-1},
+  {341,47,-1},
+  {341,97,-1},
+  {341,224,-1},
+  {341,225,-1},
+  {341,226,-1},
+  {341,227,-1},
+  {341,228,-1},
+  {341,229,-1},
+  {341,230,-1},
+  {341,257,-1},
+  {341,259,-1},
+  {341,261,-1},
+  {343,41,-1},
+  {343,44,-1},
+  {343,46,-1},
+  {343,47,-1},
+  {343,97,-1},
+  {343,224,-1},
+  {343,225,-1},
+  {343,226,-1},
+  {343,227,-1},
+  {343,228,-1},
+  {343,229,-1},
+  {343,230,-1},
+  {343,257,-1},
+  {343,259,-1},
+  {343,261,-1},
+  {345,41,-1},
+  {345,44,-1},
+  {345,46,-1},
+  {345,47,-1},
+  {345,97,-1},
+  {345,224,-1},
+  {345,225,-1},
+  {345,226,-1},
+  {345,227,-1},
+  {345,228,-1},
+  {345,229,-1},
+  {345,230,-1},
+  {345,257,-1},
+  {345,259,-1},
+  {345,261,-1},
+  {346,41,-1},
+  {346,116,-1},
+  {346,355,-1},
+  {347,41,-1},
+  {347,92,-1},
+  {348,41,-1},
+  {348,355,-1},
+  {348,359,-1},
+  {349,41,-1},
+  {349,92,-1},
+  {350,41,-1},
+  {350,116,-1},
+  {350,355,-1},
+  {350,359,-1},
+  {351,41,-1},
+  {351,92,-1},
+  {352,41,-1},
+  {352,116,-1},
+  {352,355,-1},
+  {352,359,-1},
+  {353,41,-1},
+  {353,92,-1},
+  {354,44,-1},
+  {354,45,-1},
+  {354,46,-1},
+  {354,47,-1},
+  {354,64,-1},
+  {354,65,-1},
+  {354,74,-3},
+  {354,97,-2},
+  {354,99,-1},
+  {354,100,-1},
+  {354,101,-1},
+  {354,103,-1},
+  {354,109,-1},
+  {354,110,-1},
+  {354,111,-1},
+  {354,112,-2},
+  {354,113,-1},
+  {354,114,-2},
+  {354,115,-1},
+  {354,116,-1},
+  {354,117,-1},
+  {354,118,-1},
+  {354,119,-1},
+  {354,120,-1},
+  {354,121,-1},
+  {354,122,-1},
+  {354,171,-1},
+  {354,187,-1},
+  {354,192,-1},
+  {354,193,-1},
+  {354,194,-1},
+  {354,195,-1},
+  {354,196,-1},
+  {354,197,-1},
+  {354,198,-1},
+  {354,224,-2},
+  {354,225,-2},
+  {354,226,-2},
+  {354,227,-2},
+  {354,228,-2},
+  {354,229,-2},
+  {354,230,-2},
+  {354,231,-1},
+  {354,232,-1},
+  {354,233,-1},
+  {354,234,-1},
+  {354,235,-1},
+  {354,240,-1},
+  {354,241,-1},
+  {354,242,-1},
+  {354,243,-1},
+  {354,244,-1},
+  {354,245,-1},
+  {354,246,-1},
+  {354,248,-1},
+  {354,249,-1},
+  {354,250,-1},
+  {354,251,-1},
+  {354,252,-1},
+  {354,253,-1},
+  {354,255,-1},
+  {354,256,-1},
+  {354,257,-2},
+  {354,258,-1},
+  {354,259,-2},
+  {354,260,-1},
+  {354,261,-2},
+  {354,263,-1},
+  {354,265,-1},
+  {354,267,-1},
+  {354,269,-1},
+  {354,271,-1},
+  {354,275,-1},
+  {354,277,-1},
+  {354,279,-1},
+  {354,281,-1},
+  {354,283,-1},
+  {354,285,-1},
+  {354,287,-1},
+  {354,289,-1},
+  {354,291,-1},
+  {354,308,-3},
+  {354,324,-1},
+  {354,326,-1},
+  {354,328,-1},
+  {354,331,-1},
+  {354,333,-1},
+  {354,335,-1},
+  {354,337,-1},
+  {354,339,-1},
+  {354,341,-2},
+  {354,343,-2},
+  {354,345,-2},
+  {354,347,-1},
+  {354,349,-1},
+  {354,351,-1},
+  {354,353,-1},
+  {354,355,-1},
+  {354,359,-1},
+  {354,361,-1},
+  {354,363,-1},
+  {354,365,-1},
+  {354,367,-1},
+  {354,369,-1},
+  {354,371,-1},
+  {354,373,-1},
+  {354,375,-1},
+  {354,378,-1},
+  {354,380,-1},
+  {354,382,-1},
+  {355,41,-1},
+  {355,44,-1},
+  {355,46,-1},
+  {355,47,-1},
+  {355,97,-1},
+  {355,224,-1},
+  {355,225,-1},
+  {355,226,-1},
+  {355,227,-1},
+  {355,228,-1},
+  {355,229,-1},
+  {355,230,-1},
+  {355,257,-1},
+  {355,259,-1},
+  {355,261,-1},
+  {356,44,-1},
+  {356,45,-1},
+  {356,46,-1},
+  {356,47,-1},
+  {356,64,-1},
+  {356,65,-1},
+  {356,74,-3},
+  {356,97,-2},
+  {356,99,-1},
+  {356,100,-1},
+  {356,101,-1},
+  {356,103,-1},
+  {356,109,-1},
+  {356,110,-1},
+  {356,111,-1},
+  {356,112,-2},
+  {356,113,-1},
+  {356,114,-2},
+  {356,115,-1},
+  {356,116,-1},
+  {356,117,-1},
+  {356,118,-1},
+  {356,119,-1},
+  {356,120,-1},
+  {356,121,-1},
+  {356,122,-1},
+  {356,171,-1},
+  {356,187,-1},
+  {356,192,-1},
+  {356,193,-1},
+  {356,194,-1},
+  {356,195,-1},
+  {356,196,-1},
+  {356,197,-1},
+  {356,198,-1},
+  {356,224,-2},
+  {356,225,-2},
+  {356,226,-2},
+  {356,227,-2},
+  {356,228,-2},
+  {356,229,-2},
+  {356,230,-2},
+  {356,231,-1},
+  {356,232,-1},
+  {356,233,-1},
+  {356,234,-1},
+  {356,235,-1},
+  {356,240,-1},
+  {356,241,-1},
+  {356,242,-1},
+  {356,243,-1},
+  {356,244,-1},
+  {356,245,-1},
+  {356,246,-1},
+  {356,248,-1},
+  {356,249,-1},
+  {356,250,-1},
+  {356,251,-1},
+  {356,252,-1},
+  {356,253,-1},
+  {356,255,-1},
+  {356,256,-1},
+  {356,257,-2},
+  {356,258,-1},
+  {356,259,-2},
+  {356,260,-1},
+  {356,261,-2},
+  {356,263,-1},
+  {356,265,-1},
+  {356,267,-1},
+  {356,269,-1},
+  {356,271,-1},
+  {356,275,-1},
+  {356,277,-1},
+  {356,279,-1},
+  {356,281,-1},
+  {356,283,-1},
+  {356,285,-1},
+  {356,287,-1},
+  {356,289,-1},
+  {356,291,-1},
+  {356,308,-3},
+  {356,324,-1},
+  {356,326,-1},
+  {356,328,-1},
+  {356,331,-1},
+  {356,333,-1},
+  {356,335,-1},
+  {356,337,-1},
+  {356,339,-1},
+  {356,341,-2},
+  {356,343,-2},
+  {356,345,-2},
+  {356,347,-1},
+  {356,349,-1},
+  {356,351,-1},
+  {356,353,-1},
+  {356,355,-1},
+  {356,359,-1},
+  {356,361,-1},
+  {356,363,-1},
+  {356,365,-1},
+  {356,367,-1},
+  {356,369,-1},
+  {356,371,-1},
+  {356,373,-1},
+  {356,375,-1},
+  {356,378,-1},
+  {356,380,-1},
+  {356,382,-1},
+  {358,44,-1},
+  {358,45,-1},
+  {358,46,-1},
+  {358,47,-1},
+  {358,64,-1},
+  {358,65,-1},
+  {358,74,-3},
+  {358,97,-2},
+  {358,99,-1},
+  {358,100,-1},
+  {358,101,-1},
+  {358,103,-1},
+  {358,109,-1},
+  {358,110,-1},
+  {358,111,-1},
+  {358,112,-2},
+  {358,113,-1},
+  {358,114,-2},
+  {358,115,-1},
+  {358,116,-1},
+  {358,117,-1},
+  {358,118,-1},
+  {358,119,-1},
+  {358,120,-1},
+  {358,121,-1},
+  {358,122,-1},
+  {358,171,-1},
+  {358,187,-1},
+  {358,192,-1},
+  {358,193,-1},
+  {358,194,-1},
+  {358,195,-1},
+  {358,196,-1},
+  {358,197,-1},
+  {358,198,-1},
+  {358,224,-2},
+  {358,225,-2},
+  {358,226,-2},
+  {358,227,-2},
+  {358,228,-2},
+  {358,229,-2},
+  {358,230,-2},
+  {358,231,-1},
+  {358,232,-1},
+  {358,233,-1},
+  {358,234,-1},
+  {358,235,-1},
+  {358,240,-1},
+  {358,241,-1},
+  {358,242,-1},
+  {358,243,-1},
+  {358,244,-1},
+  {358,245,-1},
+  {358,246,-1},
+  {358,248,-1},
+  {358,249,-1},
+  {358,250,-1},
+  {358,251,-1},
+  {358,252,-1},
+  {358,253,-1},
+  {358,255,-1},
+  {358,256,-1},
+  {358,257,-2},
+  {358,258,-1},
+  {358,259,-2},
+  {358,260,-1},
+  {358,261,-2},
+  {358,263,-1},
+  {358,265,-1},
+  {358,267,-1},
+  {358,269,-1},
+  {358,271,-1},
+  {358,275,-1},
+  {358,277,-1},
+  {358,279,-1},
+  {358,281,-1},
+  {358,283,-1},
+  {358,285,-1},
+  {358,287,-1},
+  {358,289,-1},
+  {358,291,-1},
+  {358,308,-3},
+  {358,324,-1},
+  {358,326,-1},
+  {358,328,-1},
+  {358,331,-1},
+  {358,333,-1},
+  {358,335,-1},
+  {358,337,-1},
+  {358,339,-1},
+  {358,341,-2},
+  {358,343,-2},
+  {358,345,-2},
+  {358,347,-1},
+  {358,349,-1},
+  {358,351,-1},
+  {358,353,-1},
+  {358,355,-1},
+  {358,361,-1},
+  {358,363,-1},
+  {358,365,-1},
+  {358,367,-1},
+  {358,369,-1},
+  {358,371,-1},
+  {358,373,-1},
+  {358,375,-1},
+  {358,378,-1},
+  {358,380,-1},
+  {358,382,-1},
+  {359,41,-1},
+  {359,44,-1},
+  {359,46,-1},
+  {359,47,-1},
+  {359,97,-1},
+  {359,224,-1},
+  {359,225,-1},
+  {359,226,-1},
+  {359,227,-1},
+  {359,228,-1},
+  {359,229,-1},
+  {359,230,-1},
+  {359,257,-1},
+  {359,259,-1},
+  {359,261,-1},
+  {361,41,-1},
+  {363,41,-1},
+  {365,41,-1},
+  {367,41,-1},
+  {369,41,-1},
+  {371,41,-1},
+  {372,74,-1},
+  {372,308,-1},
+  {373,44,-1},
+  {373,46,-1},
+  {373,47,-1},
+  {374,44,-1},
+  {374,46,-1},
+  {374,47,-1},
+  {374,74,-2},
+  {374,97,-1},
+  {374,224,-1},
+  {374,225,-1},
+  {374,226,-1},
+  {374,227,-1},
+  {374,228,-1},
+  {374,229,-1},
+  {374,230,-1},
+  {374,257,-1},
+  {374,259,-1},
+  {374,261,-1},
+  {374,308,-2},
+  {376,44,-1},
+  {376,46,-1},
+  {376,47,-1},
+  {376,74,-2},
+  {376,97,-1},
+  {376,224,-1},
+  {376,225,-1},
+  {376,226,-1},
+  {376,227,-1},
+  {376,228,-1},
+  {376,229,-1},
+  {376,230,-1},
+  {376,257,-1},
+  {376,259,-1},
+  {376,261,-1},
+  {376,308,-2},
+};
+
+static const bfont bfont_audiowide=
+{
+  18,18,-5,24,23,    // size, ascent, descent, height, lineskip
+  32,383,127,    // first, last, missing
+  bfont_audiowide_glyphs,
+  bfont_audiowide_bits,
+  bfont_audiowide_kern,
+  1619
+};
+
+#endif
@@ -0,0 +1,643 @@
+#ifndef BFONT_PIXELBERRY_H
+#define BFONT_PIXELBERRY_H
+
+// generated by tools/bakefont from media/pixelberry.ttf at 8 pt, don't edit
+
+#include "bitmap_font.h"
+
+static const Uint8 bfont_pixelberry_bits[]=
+{
+  0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x01,
+  0xf1, 0xf0, 0x00, 0x01, 0xf1, 0xf0, 0x01, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f,
+  0x1f, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x01, 0xf1, 0xf0, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0xff, 0xf0, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x01, 0xff, 0x00, 0x00, 0x1f, 0xf0,
+  0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xff, 0x00, 0x1f,
+  0x00, 0x00, 0x1f, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf1, 0xf0, 0x00, 0x00, 0x01, 0xff,
+  0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x01, 0xf0,
+  0x00, 0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x01, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0x00,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x1f, 0x00, 0x01, 0xff, 0x00, 0x01,
+  0xff, 0xff, 0x01, 0xf0, 0x1f, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00,
+  0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x1f,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x01,
+  0xf0, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01,
+  0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0x01, 0xff, 0x1f, 0x1f, 0x00, 0x1f, 0x00,
+  0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x01,
+  0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x01,
+  0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00,
+  0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+  0xf0, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00,
+  0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x01, 0xff, 0xf1, 0xf0, 0x1f, 0x1f, 0x01,
+  0xf1, 0xf0, 0x1f, 0x1f, 0x01, 0xf1, 0xf0, 0x1f, 0x1f, 0x01, 0xf1, 0xf0, 0x1f, 0x01, 0xff, 0x1f,
+  0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x01,
+  0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x01,
+  0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x1f,
+  0x00, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00,
+  0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x1f,
+  0x1f, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x1f, 0x1f,
+  0xf0, 0x01, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f,
+  0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0xf0, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf1, 0xf0, 0x1f, 0x00, 0x1f, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x01,
+  0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f,
+  0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0xff, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x01,
+  0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f,
+  0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x1f, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x01, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01,
+  0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f,
+  0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x01, 0xf1, 0xf1, 0xf1, 0xf0, 0x01,
+  0xf1, 0xf1, 0xf1, 0xf0, 0x01, 0xf1, 0xf1, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00,
+  0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x01, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x01,
+  0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0x1f, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0xff, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+  0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0xff, 0x00,
+  0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01,
+  0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x1f, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xff,
+  0xff, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x01, 0xff, 0xf0,
+  0x1f, 0x00, 0x1f, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0xf0, 0x01,
+  0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0xf0, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0,
+  0x00, 0x01, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x01, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x01, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xf0,
+  0x1f, 0x1f, 0x00, 0x1f, 0xf1, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+  0x1f, 0x01, 0xff, 0x1f, 0xf0, 0x1f, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf0,
+  0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x01, 0xff, 0xf0, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f,
+  0xff, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xff,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0xff, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f,
+  0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xf1, 0xf0, 0x01, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x01, 0xf0,
+  0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xff, 0x1f,
+  0xf0, 0x1f, 0x00, 0x1f, 0x01, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x1f, 0x00, 0x1f,
+  0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x1f, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0,
+  0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x1f, 0x10, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x1f, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x00, 0x2f, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xff, 0x1f,
+  0x1f, 0x1f, 0xf0, 0x8f, 0xf8, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x8f, 0xf8, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x1f, 0xf0,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xf0,
+  0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x00,
+  0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xf0,
+  0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0xff,
+  0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf1,
+  0xf0, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x01, 0xff, 0xf1, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x00,
+  0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f,
+  0x01, 0xff, 0x01, 0xf0, 0x1f, 0x1f, 0x01, 0xf1, 0xf0, 0x1f, 0x1f, 0xff, 0x01, 0xf0, 0x1f, 0x1f,
+  0x01, 0xf1, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x01, 0xf0, 0x1f,
+  0x1f, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0xf0, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xff, 0x01, 0xf0, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00,
+  0x1f, 0xf1, 0xf0, 0x01, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x1f, 0xf0, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f,
+  0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00,
+  0x1f, 0xf1, 0xff, 0xff, 0xff, 0x01, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00,
+  0x1f, 0xff, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xf0, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x0f, 0xf0, 0xf0, 0x00, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0xf0, 0x01, 0xf0, 0x1f, 0x1f, 0x01,
+  0xf0, 0x1f, 0x01, 0xf1, 0xf0, 0x1f, 0x00, 0x1f, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0xff, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x01, 0xf0, 0x01,
+  0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0xf1, 0xf0, 0x01, 0xf1, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01,
+  0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x1f, 0xff,
+  0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xff, 0x1f, 0x00, 0x1f, 0x1f, 0x1f, 0x01, 0xf0,
+  0x1f, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f,
+  0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0xf0,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xf0, 0x01,
+  0xf0, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x01, 0xff, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x01,
+  0xf0, 0x1f, 0x1f, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f,
+  0x01, 0xff, 0x01, 0xff, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x00, 0x1f, 0x00,
+  0x01, 0xf1, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f,
+  0x01, 0xff, 0x01, 0xff, 0x1f, 0x01, 0xff, 0x1f, 0x1f, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x01, 0xf1, 0xf0,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01,
+  0xff, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01, 0xff, 0x01, 0xff, 0x1f, 0x01, 0xff, 0xf1, 0xff, 0xf0, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0x01, 0xff, 0x00, 0x00, 0x01, 0xff,
+  0x1f, 0xff, 0xf0, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x01,
+  0xff, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf0,
+  0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f,
+  0xff, 0xff, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf0,
+  0x01, 0xf1, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0xff, 0xff, 0x1f,
+  0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+  0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0xf0, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01,
+  0xf0, 0x01, 0xf0, 0x01, 0xff, 0x1f, 0x1f, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f,
+  0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x01, 0xff, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f,
+  0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x01, 0xf1,
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+  0x01, 0xff, 0xf0, 0x01, 0xff, 0x1f, 0x1f, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x1f,
+  0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x01, 0xf1, 0xf0, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xf0,
+  0x01, 0xff, 0xf0, 0x1f, 0x01, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0xf0, 0x1f, 0x01, 0xff, 0xf0, 0x01,
+  0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x00,
+  0x1f, 0x00, 0x01, 0xf1, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00,
+  0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x01, 0xf1, 0xf0, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f,
+  0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x01, 0xff, 0xff, 0x00, 0x01, 0xf0, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x01,
+  0xff, 0x01, 0xff, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0xff,
+  0x1f, 0xff, 0xff, 0xff, 0x01, 0xf0, 0x01, 0xff, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xff, 0x1f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xf1, 0xff, 0xf0, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x1f,
+  0x00, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xff, 0xf1, 0xff, 0xf0,
+};
+
+static const bfont_glyph bfont_pixelberry_glyphs[]=
+{
+  {0,0,0,0,3,1,0},    // minx, maxy, w, h, advance, provided, offset
+  {-1,8,2,8,2,1,0},
+  {-1,8,4,3,4,1,8},
+  {-1,8,8,8,8,1,14},
+  {-1,9,6,10,6,1,46},
+  {-1,8,11,8,11,1,76},
+  {-1,8,9,8,9,1,124},
+  {-1,8,2,3,2,1,164},
+  {-1,9,5,11,5,1,167},
+  {-1,9,5,11,5,1,200},
+  {-1,8,6,5,6,1,233},
+  {-1,7,6,7,6,1,248},
+  {-1,1,3,3,3,1,269},
+  {-1,3,5,1,5,1,275},
+  {-1,1,2,1,2,1,278},
+  {-1,8,5,8,5,1,279},
+  {-1,8,6,8,6,1,303},
+  {-1,8,4,8,4,1,327},
+  {-1,8,6,8,6,1,343},
+  {-1,8,6,8,6,1,367},
+  {-1,8,7,8,7,1,391},
+  {-1,8,6,8,6,1,423},
+  {-1,8,6,8,6,1,447},
+  {-1,8,6,8,6,1,471},
+  {-1,8,6,8,6,1,495},
+  {-1,8,6,8,6,1,519},
+  {-1,5,2,5,2,1,543},
+  {-1,4,3,6,3,1,548},
+  {-1,7,5,7,5,1,560},
+  {-1,5,5,4,5,1,581},
+  {-1,7,5,7,5,1,593},
+  {-1,8,6,8,6,1,614},
+  {-1,8,9,9,9,1,638},
+  {-1,8,7,8,7,1,683},
+  {-1,8,7,8,7,1,715},
+  {-1,8,8,8,8,1,747},
+  {-1,8,7,8,7,1,779},
+  {-1,8,7,8,7,1,811},
+  {-1,8,7,8,7,1,843},
+  {-1,8,8,8,8,1,875},
+  {-1,8,7,8,7,1,907},
+  {-1,8,2,8,2,1,939},
+  {-1,8,7,8,7,1,947},
+  {-1,8,7,8,7,1,979},
+  {-1,8,6,8,6,1,1011},
+  {-1,8,8,8,8,1,1035},
+  {-1,8,7,8,7,1,1067},
+  {-1,8,8,8,8,1,1099},
+  {-1,8,7,8,7,1,1131},
+  {-1,8,8,10,8,1,1163},
+  {-1,8,7,8,7,1,1203},
+  {-1,8,7,8,7,1,1235},
+  {-1,8,6,8,6,1,1267},
+  {-1,8,7,8,7,1,1291},
+  {-1,8,8,8,8,1,1323},
+  {-1,8,10,8,10,1,1355},
+  {-1,8,7,8,7,1,1395},
+  {-1,8,8,8,8,1,1427},
+  {-1,8,6,8,6,1,1459},
+  {-1,9,4,11,4,1,1483},
+  {-1,8,5,8,5,1,1505},
+  {-1,9,4,11,4,1,1529},
+  {-1,6,6,3,6,1,1551},
+  {-1,-1,5,1,5,1,1560},
+  {-1,8,3,2,3,1,1563},
+  {-1,5,6,5,6,1,1567},
+  {-1,8,6,8,6,1,1582},
+  {-1,5,6,5,6,1,1606},
+  {-1,8,6,8,6,1,1621},
+  {-1,5,6,5,6,1,1645},
+  {-1,8,5,8,5,1,1660},
+  {-1,5,6,8,6,1,1684},
+  {-1,8,6,8,6,1,1708},
+  {-1,7,2,7,2,1,1732},
+  {-1,8,3,11,3,1,1739},
+  {-1,8,6,8,6,1,1761},
+  {-1,8,2,8,2,1,1785},
+  {-1,5,8,5,8,1,1793},
+  {-1,5,6,5,6,1,1813},
+  {-1,5,6,5,6,1,1828},
+  {-1,5,6,8,6,1,1843},
+  {-1,5,6,8,6,1,1867},
+  {-1,5,5,5,5,1,1891},
+  {-1,5,5,5,5,1,1906},
+  {-1,7,4,7,4,1,1921},
+  {-1,5,6,5,6,1,1935},
+  {-1,5,6,5,6,1,1950},
+  {-1,5,8,5,8,1,1965},
+  {-1,5,6,5,6,1,1985},
+  {-1,5,6,8,6,1,2000},
+  {-1,5,5,5,5,1,2024},
+  {-1,9,4,11,4,1,2039},
+  {-1,9,2,10,2,1,2061},
+  {-1,9,4,11,4,1,2071},
+  {-1,5,6,2,6,1,2093},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,6,2,8,2,1,2117},
+  {0,9,4,9,4,0,2099},
+  {-1,8,7,8,7,1,2125},
+  {0,9,4,9,4,0,2099},
+  {-1,8,8,8,8,1,2157},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,8,9,8,9,1,2189},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,8,9,8,9,1,2229},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,8,4,3,4,1,2269},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,6,6,8,6,1,2275},
+  {-1,11,7,11,7,1,2299},
+  {-1,11,7,11,7,1,2343},
+  {-1,11,7,11,7,1,2387},
+  {-1,11,7,11,7,1,2431},
+  {-1,10,7,10,7,1,2475},
+  {-1,11,7,11,7,1,2515},
+  {-1,8,12,8,12,1,2559},
+  {-1,8,8,10,8,1,2607},
+  {-1,11,7,11,7,1,2647},
+  {-1,11,7,11,7,1,2691},
+  {-1,11,7,11,7,1,2735},
+  {-1,10,7,10,7,1,2779},
+  {-2,11,3,11,2,1,2819},
+  {-1,11,3,11,2,1,2841},
+  {-2,11,4,11,2,1,2863},
+  {-2,10,4,10,2,1,2885},
+  {0,9,4,9,4,0,2099},
+  {-1,11,7,11,7,1,2905},
+  {-1,11,8,11,8,1,2949},
+  {-1,11,8,11,8,1,2993},
+  {-1,11,8,11,8,1,3037},
+  {-1,11,8,11,8,1,3081},
+  {-1,10,8,10,8,1,3125},
+  {0,9,4,9,4,0,2099},
+  {-1,8,8,8,8,1,3165},
+  {-1,11,7,11,7,1,3197},
+  {-1,11,7,11,7,1,3241},
+  {-1,11,7,11,7,1,3285},
+  {-1,10,7,10,7,1,3329},
+  {-1,11,8,11,8,1,3369},
+  {0,9,4,9,4,0,2099},
+  {-1,8,7,10,7,1,3413},
+  {-1,8,6,8,6,1,3453},
+  {-1,8,6,8,6,1,3477},
+  {-1,8,6,8,6,1,3501},
+  {-1,8,6,8,6,1,3525},
+  {-1,7,6,7,6,1,3549},
+  {-1,8,6,8,6,1,3570},
+  {-1,5,10,5,10,1,3594},
+  {-1,5,6,7,6,1,3619},
+  {-1,8,6,8,6,1,3640},
+  {-1,8,6,8,6,1,3664},
+  {-1,8,6,8,6,1,3688},
+  {-1,7,6,7,6,1,3712},
+  {-1,8,3,8,3,1,3733},
+  {-1,8,3,8,3,1,3749},
+  {-1,8,4,8,4,1,3765},
+  {-1,7,4,7,4,1,3781},
+  {0,9,4,9,4,0,2099},
+  {-1,8,6,8,6,1,3795},
+  {-1,8,6,8,6,1,3819},
+  {-1,8,6,8,6,1,3843},
+  {-1,8,6,8,6,1,3867},
+  {-1,8,6,8,6,1,3891},
+  {-1,7,6,7,6,1,3915},
+  {0,9,4,9,4,0,2099},
+  {-1,5,6,5,6,1,3936},
+  {-1,8,6,8,6,1,3951},
+  {-1,8,6,8,6,1,3975},
+  {-1,8,6,8,6,1,3999},
+  {-1,7,6,7,6,1,4023},
+  {-1,8,6,11,6,1,4044},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {-1,8,14,8,14,1,4077},
+  {-1,5,10,5,10,1,4133},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+  {0,9,4,9,4,0,2099},
+};
+
+static const bfont_kern bfont_pixelberry_kern[]=
+{
+  {0,0,0}
+};
+
+static const bfont bfont_pixelberry=
+{
+  8,9,-2,12,11,    // size, ascent, descent, height, lineskip
+  32,383,127,    // first, last, missing
+  bfont_pixelberry_glyphs,
+  bfont_pixelberry_bits,
+  bfont_pixelberry_kern,
+  0
+};
+
+#endif
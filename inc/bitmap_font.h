@@ -0,0 +1,65 @@
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Prerasterized bitmap fonts   */
+///////////////////////////////////
+// Fonts rasterized at build time by tools/bakefont (FreeType, same
+// metrics as SDL_ttf) into inc/bfont_*.h. Glyphs are 4 bit coverage,
+// two pixels per byte (high nibble first), rows padded to a byte, and
+// are blended straight into the destination surface. Text is UTF-8,
+// the fonts have chars 32..383 (Latin-1 and Latin Extended-A).
+
+struct bfont_glyph
+{
+  Sint8 minx;
+  Sint8 maxy;
+  Uint8 w;
+  Uint8 h;
+  Sint16 advance;
+  Uint8 provided;       // 0: the missing glyph box of the font
+  Uint32 offset;        // first byte in bits
+};
+
+struct bfont_kern
+{
+  Uint16 left;
+  Uint16 right;
+  Sint8 delta;
+};
+
+struct bfont
+{
+  int size;
+  int ascent;
+  int descent;
+  int height;
+  int lineskip;
+  int first;            // chars first..last have a glyph
+  int last;
+  int missing;          // a char drawn with the missing glyph box, 0 if none
+  const bfont_glyph* glyph;
+  const Uint8* bits;
+  const bfont_kern* kern;   // sorted by left, right
+  int nkern;
+};
+
+// draw string at x,y (top of line), clipped, return pen advance
+int bfont_draw(SDL_Surface* dst, const bfont* f, const char* string, int x, int y, SDL_Color c);
+// same value as TTF_SizeText width
+int bfont_width(const bfont* f, const char* string);
+int bfont_kerning(const bfont* f, Uint16 left, Uint16 right);
+// string decoded into n chars ch at pen offsets pen (max of them),
+// return width, same as bfont_width
+int bfont_layout(const bfont* f, const char* string, Uint16* ch, Sint16* pen, int max, int* n);
+// chars laid out by bfont_layout
+void bfont_draw_chars(SDL_Surface* dst, const bfont* f, const Uint16* ch, const Sint16* pen, int n, int x, int y, SDL_Color c);
+// FALSE if ch is drawn with the missing glyph box
+int bfont_has_glyph(const bfont* f, Uint16 ch);
+// same results as TTF_GlyphMetrics and TTF_RenderGlyph_Blended
+int bfont_glyph_metrics(const bfont* f, Uint16 ch, int* minx, int* maxx, int* miny, int* maxy, int* advance);
+SDL_Surface* bfont_render_glyph(const bfont* f, Uint16 ch, SDL_Color c);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Text coverage blending       */
+///////////////////////////////////
+// Glyphs are kept as 8 bit coverage masks (0 none, 255 all) and
+// blended in one colour into the surface. RGB565 rows go through a
+// vector kernel chosen at build time by the Makefile from PLATFORM:
+// BLEND_NEON (miyoo), BLEND_SSE2 (linux x86 host), else plain C. All
+// give the same pixels (make test, tests/blend_test.cpp). Other formats
+// are blended one pixel at a time.
+
+// mask rows are pitch bytes apart, clipped to the surface clip rect,
+// surfaces that must be locked are locked by the caller
+void blend_a8(SDL_Surface* dst, int x, int y, const Uint8* mask, int pitch, int w, int h, SDL_Color c);
+// n pixels of an RGB565 row
+void blend_a8_rgb565(Uint16* dst, const Uint8* mask, int n, Uint16 colour);
+
+// kernel built in: "neon", "sse2" or "c"
+const char* blend_kernel();
+
+#ifdef BENCHMARK
+// vector kernel against plain C on screen sized text rows
+void blend_bench(int frames);
+#endif
+
+#endif
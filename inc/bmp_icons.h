@@ -1,11 +1,11 @@
 #ifndef BMP_ICONS_H
 #define BMP_ICONS_H
 
-unsigned int bmp_icons_len = 3738;
+unsigned int bmp_icons_len = 4338;
 unsigned char bmp_icons[] = {
-  0x42, 0x4d, 0x9a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00,
-  0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e,
+  0x42, 0x4d, 0xf2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00,
+  0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x10,
   0x00, 0x00, 0x23, 0x2e, 0x00, 0x00, 0x23, 0x2e, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x47,
@@ -44,7 +44,12 @@ unsigned char bmp_icons[] = {
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -74,7 +79,12 @@ unsigned char bmp_icons[] = {
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -104,7 +114,12 @@ unsigned char bmp_icons[] = {
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -134,7 +149,12 @@ unsigned char bmp_icons[] = {
   0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -164,7 +184,12 @@ unsigned char bmp_icons[] = {
   0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -194,7 +219,12 @@ unsigned char bmp_icons[] = {
   0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
-  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
@@ -224,7 +254,12 @@ unsigned char bmp_icons[] = {
   0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0x41, 0x41, 0xe1, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
   0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1,
@@ -254,7 +289,12 @@ unsigned char bmp_icons[] = {
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
-  0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x41, 0x41, 0xe1, 0x41, 0x41, 0xe1,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
@@ -285,6 +325,11 @@ unsigned char bmp_icons[] = {
   0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
   0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
@@ -314,6 +359,11 @@ unsigned char bmp_icons[] = {
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
   0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
   0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff
+  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xff
 };
 #endif
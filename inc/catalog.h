@@ -0,0 +1,92 @@
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include "text_font.h"
+#include "glyph_cache.h"
+
+///////////////////////////////////
+/*  Localisation catalog         */
+///////////////////////////////////
+// English and Spanish are const tables, more languages are read from
+// lang.ini at startup ("[fr]" starts one, "exit= quitter" lines, the
+// keys are in catalog.cpp, missing ones stay in English). Month and
+// day names go as tables straight to the formatters. Texts are UTF-8.
+// Every string is decoded and laid out once for each font when the
+// language or the font is set, so layouts don't measure text and labels
+// are drawn from the runs without decoding it each frame.
+
+enum str_id
+{
+  // button hints, a space before the text
+  STR_EXIT,
+  STR_SET_TIME,
+  STR_ACCEPT,
+  STR_CANCEL,
+  STR_MOVE,
+  STR_MONTH,
+  STR_YEAR,
+  STR_BEGIN,
+  STR_SET_ALARM,
+  STR_EDIT,
+  STR_NEW,
+  STR_ON_OFF,
+  STR_DELETE,
+  STR_STOP,
+  STR_SNOOZE,
+  STR_START,
+  STR_PAUSE,
+  STR_LAP,
+  STR_RESET,
+  STR_MODE,
+  STR_SAVING_RTC,
+  STR_RTC_NOT_SAVED,
+  STR_ANALOG,
+  STR_DIGITAL,
+  // alarm
+  STR_NO_ALARMS,
+  STR_NEXT_ALARM,
+  STR_ALARM,
+  STR_ONCE,
+  STR_SNOOZE_MIN,     // printf format with one %d
+  STR_NO_SNOOZE,
+  // timer
+  STR_STOPWATCH,
+  STR_TIMER,
+  STR_TIME_UP,
+  STR_LAP_TITLE,
+  // world clock
+  STR_WORLD_CLOCK,
+  // 7 short day names from sunday, 12 upper case month names
+  STR_SUNDAY,
+  STR_JANUARY=STR_SUNDAY+7,
+  STR_COUNT=STR_JANUARY+12
+};
+
+#define CAT_MAX_LANGS   8
+#define CAT_TEXT        0       // font slots: hints, titles and names
+#define CAT_FONTS       1
+
+// built in languages, 0=english, 1=spanish
+void catalog_init();
+// languages of lang.ini added after them, FALSE if it can't be read
+int catalog_load(const char* path);
+void catalog_free();
+
+int catalog_count();
+// strings measured again in the new language
+void catalog_set(int lang);
+// "en", "es"... of the language set
+const char* catalog_code();
+// font of slot measured with every string, chars of any language
+// missing in it are written to stderr
+void catalog_font(int slot, text_font* f);
+
+const char* catalog_str(int id);
+// id and the strings after it, as STR_JANUARY for the 12 months
+const char* const* catalog_table(int id);
+int catalog_width(int id, int slot=CAT_TEXT);
+// string laid out in the font of slot, NULL if it didn't fit and has
+// to be drawn as text
+const text_run* catalog_run(int id, int slot=CAT_TEXT);
+
+#endif
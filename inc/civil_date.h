@@ -0,0 +1,184 @@
+#ifndef CIVIL_DATE_H
+#define CIVIL_DATE_H
+
+#include <stdint.h>
+
+///////////////////////////////////
+/*  Civil date arithmetic        */
+///////////////////////////////////
+// Proleptic gregorian calendar with 64 bit day counts (day 0 is
+// 1970-01-01), no libc and no time zones. Based on the days_from_civil
+// and civil_from_days algorithms by Howard Hinnant. C++11 constexpr,
+// so every function is a single expression.
+
+struct civil_date
+{
+  int64_t year;
+  unsigned month;     // 1..12
+  unsigned day;       // 1..31
+
+  constexpr civil_date(int64_t y, unsigned m, unsigned d) : year(y), month(m), day(d) {}
+};
+
+///////////////////////////////////
+/*  Year and month info          */
+///////////////////////////////////
+constexpr bool civil_is_leap(int64_t y)
+{
+  return y%4==0 && (y%100!=0 || y%400==0);
+}
+
+constexpr unsigned civil_days_in_month(int64_t y, unsigned m)
+{
+  return m==2 ? (civil_is_leap(y)?29:28) : ((m==4 || m==6 || m==9 || m==11)?30:31);
+}
+
+///////////////////////////////////
+/*  Date to day number           */
+///////////////////////////////////
+constexpr int64_t civil_era(int64_t y)
+{
+  return (y>=0?y:y-399)/400;
+}
+
+constexpr int64_t civil_doy(unsigned m, unsigned d)
+{
+  return (153*(m>2?m-3:m+9)+2)/5+d-1;     // march based day of year
+}
+
+constexpr int64_t civil_doe(int64_t yoe, int64_t doy)
+{
+  return yoe*365+yoe/4-yoe/100+doy;
+}
+
+constexpr int64_t civil_days_shifted(int64_t y, unsigned m, unsigned d)
+{
+  return civil_era(y)*146097+civil_doe(y-civil_era(y)*400,civil_doy(m,d))-719468;
+}
+
+constexpr int64_t days_from_civil(int64_t y, unsigned m, unsigned d)
+{
+  return civil_days_shifted(y-(m<=2?1:0),m,d);
+}
+
+constexpr int64_t days_from_civil(civil_date c)
+{
+  return days_from_civil(c.year,c.month,c.day);
+}
+
+///////////////////////////////////
+/*  Day number to date           */
+///////////////////////////////////
+constexpr int64_t civil_era_of(int64_t z)
+{
+  return (z>=0?z:z-146096)/146097;
+}
+
+constexpr int64_t civil_yoe(int64_t doe)
+{
+  return (doe-doe/1460+doe/36524-doe/146096)/365;
+}
+
+constexpr int64_t civil_mp(int64_t doy)
+{
+  return (5*doy+2)/153;
+}
+
+constexpr civil_date civil_from_parts(int64_t y, int64_t doy)
+{
+  return civil_date(y+(civil_mp(doy)>=10?1:0),
+                    (unsigned)(civil_mp(doy)<10?civil_mp(doy)+3:civil_mp(doy)-9),
+                    (unsigned)(doy-(153*civil_mp(doy)+2)/5+1));
+}
+
+constexpr civil_date civil_from_doe(int64_t era, int64_t doe)
+{
+  return civil_from_parts(civil_yoe(doe)+era*400,doe-(365*civil_yoe(doe)+civil_yoe(doe)/4-civil_yoe(doe)/100));
+}
+
+constexpr civil_date civil_from_shifted(int64_t z)
+{
+  return civil_from_doe(civil_era_of(z),z-civil_era_of(z)*146097);
+}
+
+constexpr civil_date civil_from_days(int64_t z)
+{
+  return civil_from_shifted(z+719468);
+}
+
+///////////////////////////////////
+/*  Weekday                      */
+///////////////////////////////////
+// 0=sunday .. 6=saturday, same as tm_wday
+constexpr unsigned civil_weekday(int64_t z)
+{
+  return (unsigned)(z>=-4?(z+4)%7:(z+5)%7+6);
+}
+
+// 1=monday .. 7=sunday
+constexpr unsigned civil_iso_weekday(int64_t z)
+{
+  return civil_weekday(z)==0?7:civil_weekday(z);
+}
+
+// 0..365, same as tm_yday
+constexpr unsigned civil_yearday(civil_date c)
+{
+  return (unsigned)(days_from_civil(c)-days_from_civil(c.year,1,1));
+}
+
+///////////////////////////////////
+/*  Add months/years             */
+///////////////////////////////////
+// day is clamped to the last day of the month (jan 31 + 1 = feb 28/29)
+constexpr int64_t civil_floor_div(int64_t a, int64_t b)
+{
+  return (a>=0?a:a-(b-1))/b;
+}
+
+constexpr civil_date civil_from_month_index(int64_t mi, unsigned d)
+{
+  return civil_date(civil_floor_div(mi,12),
+                    (unsigned)(mi-civil_floor_div(mi,12)*12+1),
+                    d<civil_days_in_month(civil_floor_div(mi,12),(unsigned)(mi-civil_floor_div(mi,12)*12+1))?d:
+                      civil_days_in_month(civil_floor_div(mi,12),(unsigned)(mi-civil_floor_div(mi,12)*12+1)));
+}
+
+constexpr civil_date civil_add_months(civil_date c, int64_t n)
+{
+  return civil_from_month_index(c.year*12+(c.month-1)+n,c.day);
+}
+
+constexpr civil_date civil_add_years(civil_date c, int64_t n)
+{
+  return civil_add_months(c,n*12);
+}
+
+///////////////////////////////////
+/*  ISO 8601 week                */
+///////////////////////////////////
+// thursday of the same week decides the year of the week
+constexpr int64_t civil_iso_thursday(int64_t z)
+{
+  return z-civil_iso_weekday(z)+4;
+}
+
+constexpr int64_t civil_iso_year(int64_t z)
+{
+  return civil_from_days(civil_iso_thursday(z)).year;
+}
+
+constexpr unsigned civil_iso_week(int64_t z)
+{
+  return (unsigned)((civil_iso_thursday(z)-days_from_civil(civil_iso_year(z),1,1))/7+1);
+}
+
+// known values, checked when compiling
+static_assert(days_from_civil(1970,1,1)==0,"civil epoch");
+static_assert(days_from_civil(2000,3,1)==11017,"civil leap day");
+static_assert(civil_from_days(-719162).year==1,"civil year 1");
+static_assert(civil_weekday(days_from_civil(2019,12,25))==3,"civil weekday");
+static_assert(civil_add_months(civil_date(2020,1,31),1).day==29,"civil month clamp");
+static_assert(civil_iso_week(days_from_civil(2021,1,3))==53,"civil iso week");
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef DIGIT_STRIP_H
+#define DIGIT_STRIP_H
+
+#include <SDL/SDL.h>
+#include "text_font.h"
+
+///////////////////////////////////
+/*  Digit sprite strips          */
+///////////////////////////////////
+// The big clock only shows 0-9 and ':'. Those 11 glyphs are rendered
+// once per (font, colour) into one strip surface and a time is drawn
+// with one blit per character. Digits share the widest advance and are
+// centred in it, so the time doesn't move when the digits change.
+
+struct digit_strip;
+
+// strip of font and colour, created on first use (NULL if it can't be)
+digit_strip* digitstrip_get(text_font* f, SDL_Color c);
+// draw to screen through the renderer, FALSE if string has other chars
+int digitstrip_draw(digit_strip* ds, const char* string, int x, int y);
+// width as drawn, 0 if string has other chars
+int digitstrip_width(digit_strip* ds, const char* string);
+void digitstrip_free();
+
+#endif
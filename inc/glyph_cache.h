@@ -0,0 +1,41 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <SDL/SDL.h>
+#include "text_font.h"
+
+///////////////////////////////////
+/*  Glyph atlas cache            */
+///////////////////////////////////
+// Every glyph is rasterized once per font into an 8 bit coverage
+// atlas, strings are drawn blending the cached masks in any colour.
+// Text is UTF-8 (UCS-2 chars, as SDL_ttf), chars the font lacks are
+// drawn with its missing glyph box. Fixed strings can be laid out once
+// into a run and drawn again without decoding or measuring.
+
+// decoded chars and the pen of each one from the start of the string
+struct text_run
+{
+  Uint16* ch;
+  Sint16* x;
+  int n;
+  int width;          // same as glyphcache_width
+};
+
+// draw string at x,y, return pen advance in pixels
+int glyphcache_draw(SDL_Surface* dst, text_font* f, const char* string, int x, int y, SDL_Color c);
+// same value as TTF_SizeText width
+int glyphcache_width(text_font* f, const char* string);
+int glyphcache_height(text_font* f);
+// run->ch and run->x have room for max chars, return chars in the run
+int glyphcache_layout(text_font* f, const char* string, text_run* run, int max);
+// same pixels as glyphcache_draw of the string laid out
+void glyphcache_draw_run(SDL_Surface* dst, text_font* f, const text_run* run, int x, int y, SDL_Color c);
+// FALSE if ch would be the missing glyph box
+int glyphcache_has_glyph(text_font* f, Uint16 ch);
+
+// hits: glyphs served from cache, misses: calls made to FreeType
+void glyphcache_stats(Uint32* hits, Uint32* misses);
+void glyphcache_free();
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Joystick codes               */
+///////////////////////////////////
+#ifdef PLATFORM_MIYOO
+
+#define GCW_BUTTON_UP           SDLK_UP
+#define GCW_BUTTON_DOWN         SDLK_DOWN
+#define GCW_BUTTON_LEFT         SDLK_LEFT
+#define GCW_BUTTON_RIGHT        SDLK_RIGHT
+#define GCW_BUTTON_A            SDLK_SPACE
+#define GCW_BUTTON_B            SDLK_LCTRL
+#define GCW_BUTTON_X            SDLK_LSHIFT
+#define GCW_BUTTON_Y            SDLK_LALT
+#define GCW_BUTTON_L1           101
+#define GCW_BUTTON_R1           116
+#define GCW_BUTTON_L2           SDLK_TAB
+#define GCW_BUTTON_R2           SDLK_BACKSPACE
+#define GCW_BUTTON_SELECT       305
+#define GCW_BUTTON_START        SDLK_RETURN
+#define GCW_BUTTON_L3           998
+#define GCW_BUTTON_R3           999
+#define GCW_BUTTON_POWER        320
+#define GCW_BUTTON_VOLUP        312
+#define GCW_BUTTON_VOLDOWN      311
+#define GCW_BUTTON_MENU         SDLK_ESCAPE
+
+#else
+
+#define GCW_BUTTON_UP           SDLK_UP
+#define GCW_BUTTON_DOWN         SDLK_DOWN
+#define GCW_BUTTON_LEFT         SDLK_LEFT
+#define GCW_BUTTON_RIGHT        SDLK_RIGHT
+#define GCW_BUTTON_A            SDLK_LCTRL
+#define GCW_BUTTON_B            SDLK_LALT
+#define GCW_BUTTON_X            SDLK_SPACE
+#define GCW_BUTTON_Y            SDLK_LSHIFT
+#define GCW_BUTTON_L1           SDLK_TAB
+#define GCW_BUTTON_R1           SDLK_BACKSPACE
+#define GCW_BUTTON_L2           SDLK_PAGEUP
+#define GCW_BUTTON_R2           SDLK_PAGEDOWN
+#define GCW_BUTTON_SELECT       SDLK_ESCAPE
+#define GCW_BUTTON_START        SDLK_RETURN
+#define GCW_BUTTON_L3           SDLK_KP_DIVIDE
+#define GCW_BUTTON_R3           SDLK_KP_PERIOD
+#define GCW_BUTTON_POWER        SDLK_HOME
+#define GCW_BUTTON_VOLUP        0 //SDLK_PAUSE
+//#define GCW_BUTTON_VOLDOWN      0
+
+#endif
+
+#define GCW_JOYSTICK_DEADZONE   1000
+
+///////////////////////////////////
+/*  Input                        */
+///////////////////////////////////
+// Keys are mapped to buttons with a table indexed by SDL key, built from
+// the GCW_BUTTON_* codes of the platform and keymap.ini. The buttons
+// down are one 32 bit word per frame, pressed and released are the bits
+// that changed since the last frame. Directions repeat while they are
+// held, faster the longer, timed on the monotonic clock and not by
+// frames.
+
+#define BTN_LEFT        0x00000001
+#define BTN_RIGHT       0x00000002
+#define BTN_UP          0x00000004
+#define BTN_DOWN        0x00000008
+#define BTN_A           0x00000010
+#define BTN_B           0x00000020
+#define BTN_X           0x00000040
+#define BTN_Y           0x00000080
+#define BTN_L1          0x00000100
+#define BTN_R1          0x00000200
+#define BTN_L2          0x00000400
+#define BTN_R2          0x00000800
+#define BTN_L3          0x00001000
+#define BTN_R3          0x00002000
+#define BTN_SELECT      0x00004000
+#define BTN_START       0x00008000
+#define BTN_POWER       0x00010000
+#define BTN_VOLUP       0x00020000
+#define BTN_VOLDOWN     0x00040000
+#define BTN_MENU        0x00080000
+#define BTN_J1_LEFT     0x00100000
+#define BTN_J1_RIGHT    0x00200000
+#define BTN_J1_UP       0x00400000
+#define BTN_J1_DOWN     0x00800000
+#define BTN_J2_LEFT     0x01000000
+#define BTN_J2_RIGHT    0x02000000
+#define BTN_J2_UP       0x04000000
+#define BTN_J2_DOWN     0x08000000
+#define BTN_COUNT       28
+
+#define BTN_REPEAT      (BTN_LEFT|BTN_RIGHT|BTN_UP|BTN_DOWN)
+
+#define INPUT_REPEAT_DELAY  400   // ms held before the first repeat
+#define INPUT_REPEAT_START  150   // ms between the first repeats
+#define INPUT_REPEAT_STEP   10    // ms less each repeat
+#define INPUT_REPEAT_MIN    30    // ms between repeats at full speed
+#define INPUT_REPEAT_FRAME  10    // most repeats given in one frame
+
+void input_init();
+// lines "Name keycode", names as the GCW_BUTTON_* codes: A, L1, Select...
+int input_load_keymap(const char* path);
+
+// read SDL events, once per frame
+void input_update();
+
+int input_held(Uint32 buttons);
+int input_pressed(Uint32 buttons);
+int input_released(Uint32 buttons);
+// presses plus repeats due this frame, of any of buttons
+int input_steps(Uint32 buttons);
+int input_repeated(Uint32 buttons);
+// any button pressed this frame
+int input_any();
+// monotonic ns the first of buttons pressed this frame went down, the
+// kernel event time when known, 0 if none of them was pressed
+Sint64 input_time(Uint32 buttons);
+Sint16 input_axis(int axis);
+
+#endif
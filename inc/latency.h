@@ -0,0 +1,41 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+///////////////////////////////////
+/*  Input latency                */
+///////////////////////////////////
+// Only compiled with LATENCY defined (make LATENCY=1), otherwise the
+// macros are empty. The first press of a frame is stamped when SDL
+// gives it, and with the evdev time the kernel gave it when there is
+// one. The first frame after it that changes the screen closes the
+// sample when SDL_UpdateRects returns. Press to display and receipt to
+// display times go to 1 ms histograms, saved with lat_save().
+
+#define LAT_BUCKETS     100     // ms, and one more for longer
+#define LAT_FRAMES      4       // frames waited for a change on screen
+
+#ifdef LATENCY
+
+#include <stdio.h>
+#include <SDL/SDL.h>
+
+// received: when SDL gave the event, kernel: evdev time or 0 (ns)
+void lat_input(Sint64 received, Sint64 kernel);
+// after the display update, updated: something changed on screen
+void lat_shown(int updated);
+// summary to stderr
+void lat_dump();
+// histograms to a text file, FALSE if it can't be written
+int lat_save(const char* path);
+
+#define LAT_INPUT(received,kernel)  lat_input(received,kernel)
+#define LAT_SHOWN(updated)          lat_shown(updated)
+
+#else
+
+#define LAT_INPUT(received,kernel)
+#define LAT_SHOWN(updated)
+
+#endif
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Idle power state             */
+///////////////////////////////////
+// After some time without input the clock goes idle: the backlight is
+// dimmed and the loop only draws a minimal face once a second or a
+// minute. Any input or a ringing alarm makes it active again in the
+// same frame. The backlight is the brightness file in sysfs, a regular
+// file works the same to try it on the build machine
+// (ODCLOCK_BACKLIGHT=/tmp/backlight ./odclock). Times are ns of
+// CLOCK_MONOTONIC.
+
+#define POWER_BACKLIGHT   "/sys/class/backlight/pwm-backlight/brightness"
+
+#define POWER_ACTIVE      0
+#define POWER_IDLE        1
+#define POWER_STATES      2
+
+// backlight NULL for POWER_BACKLIGHT, active from now
+void power_init(const char* backlight, Sint64 now);
+// backlight back to its level if idle
+void power_close();
+// the same from a signal handler, the state is left as it is
+void power_restore();
+
+// idle after timeout s without activity, 0 never, backlight at dim %
+// of its level while idle
+void power_config(int timeout, int dim);
+
+// once per frame, activity is input or something to be seen, return
+// the state after it
+int power_update(int activity, Sint64 now);
+int power_state();
+// ms until idle if there is no activity, SCHED_FOREVER if never
+Uint32 power_to_idle(Sint64 now);
+
+// s spent in each state up to now, times it went idle
+void power_stats(Sint64 now, double* seconds, Uint32* idles);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+///////////////////////////////////
+/*  Frame stage profiler         */
+///////////////////////////////////
+// Only compiled with PROFILE defined (make PROFILE=1), otherwise the
+// macros are empty. PROF_SCOPE(stage) times until the end of the block,
+// PROF_FRAME() closes the frame into a ring buffer of the last frames.
+// The overlay shows frame time, stages against a 16 ms budget, fps and
+// time sleeping.
+
+#define PROF_EVENTS       0
+#define PROF_UPDATE_MENU  1
+#define PROF_UPDATE_MODE  2
+#define PROF_DRAW_MENU    3
+#define PROF_DRAW_MODE    4
+#define PROF_RENDER       5
+#define PROF_SLEEP        6
+#define PROF_STAGES       7
+
+#ifdef PROFILE
+
+#include <SDL/SDL.h>
+#include "text_font.h"
+
+Uint32 prof_now_us();
+void prof_add(int stage, Uint32 us);
+void prof_frame();
+void prof_set_overlay(int overlay);
+int prof_get_overlay();
+// draw overlay to screen through the renderer
+void prof_draw_overlay(text_font* f, int x, int y);
+// averages per stage to stderr
+void prof_dump();
+
+struct prof_scope
+{
+  int stage;
+  Uint32 start;
+
+  prof_scope(int s) : stage(s), start(prof_now_us()) {}
+  ~prof_scope() { prof_add(stage,prof_now_us()-start); }
+};
+
+#define PROF_JOIN2(a,b)   a##b
+#define PROF_JOIN(a,b)    PROF_JOIN2(a,b)
+#define PROF_SCOPE(stage) prof_scope PROF_JOIN(prof_scope_,__LINE__)(stage)
+#define PROF_FRAME()      prof_frame()
+
+#else
+
+#define PROF_SCOPE(stage)
+#define PROF_FRAME()
+
+#endif
+
+#endif
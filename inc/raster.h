@@ -0,0 +1,39 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Software rasterizer          */
+///////////////////////////////////
+// Pixels, lines and boxes written straight to surface memory, with one
+// template instance per pixel size (RGB565, XRGB8888). The instance is
+// picked from the screen format by raster_init(), surfaces of other
+// sizes get it by their own format and depths other than 16/32 bits go
+// through SDL_FillRect. Colours are already mapped (SDL_MapRGB) and all
+// is clipped to the surface clip rect. Surfaces that must be locked are
+// locked by the caller.
+
+#define RASTER_FILL     0x01    // box inside
+#define RASTER_EDGE     0x02    // box border
+
+// box shapes, same values as draw_rectangle borders
+#define RASTER_SQUARE   0       // all fill
+#define RASTER_SINGLE   1       // 1 pixel border
+#define RASTER_ROUNDED  2       // 1 pixel border, corners cut
+
+void raster_init(SDL_Surface* screen);
+
+void raster_pixel(SDL_Surface* dst, int x, int y, Uint32 colour);
+// both ends drawn
+void raster_line(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 colour);
+void raster_span(SDL_Surface* dst, int x, int y, int w, Uint32 colour);
+// parts: RASTER_FILL|RASTER_EDGE, each pixel written once
+void raster_box(SDL_Surface* dst, int x, int y, int w, int h, int shape, Uint32 fill, Uint32 edge, int parts);
+
+#ifdef BENCHMARK
+// cases against the SDL_FillRect and floating point versions
+void raster_bench(SDL_Surface* dst, int frames);
+#endif
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <SDL/SDL.h>
+#include "text_font.h"
+#include "glyph_cache.h"
+
+///////////////////////////////////
+/*  Damage tracking renderer     */
+///////////////////////////////////
+// Draw calls to the screen are recorded between render_begin() and
+// render_end(). render_end() compares them with the previous frame,
+// redraws only the regions that changed (clipped) and pushes them with
+// SDL_UpdateRects. Every frame must begin with a fill of the whole
+// screen (background), so any region can be rebuilt from the list.
+
+void render_init(SDL_Surface* dst);
+void render_begin();
+void render_end();
+// force a full redraw in next frame
+void render_invalidate();
+
+// r==NULL is the whole screen, colour already mapped
+void render_fill(const SDL_Rect* r, Uint32 colour);
+// both ends drawn
+void render_line(int x0, int y0, int x1, int y1, Uint32 colour);
+void render_text(text_font* f, const char* string, int x, int y, SDL_Color c);
+// run from glyphcache_layout, must not change until render_end()
+void render_run(text_font* f, const text_run* run, int x, int y, SDL_Color c);
+// version must change when pixels of src change but pointer not
+void render_blit(SDL_Surface* src, const SDL_Rect* srcrect, int x, int y, Uint32 version=0);
+
+// debug: frame redrawn regions
+void render_set_flash(int flash);
+int render_get_flash();
+
+// frames: frames with changes, rects/pixels: pushed to display
+void render_stats(Uint32* frames, Uint32* rects, Uint32* pixels);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef RTC_H
+#define RTC_H
+
+///////////////////////////////////
+/*  Hardware clock writer        */
+///////////////////////////////////
+// Copies the system time to the RTC on a worker thread, so setting the
+// clock doesn't fork a shell in the middle of a frame. The time is
+// written with RTC_SET_TIME on the device at the start of a second, like
+// hwclock does, and hwclock is run when the ioctl can't be done. A
+// regular file as device gets the UTC time as text, to try it on the
+// build machine (ODCLOCK_RTC=/tmp/rtc ./odclock).
+
+#define RTC_DEVICE    "/dev/rtc0"
+
+#define RTC_IDLE      0
+#define RTC_BUSY      1
+#define RTC_DONE      2
+#define RTC_FAILED    3
+
+// device NULL for RTC_DEVICE, thread starts with the first write
+void rtc_init(const char* device);
+// waits for a write in progress
+void rtc_close();
+
+// write the system time, a write in progress is redone after it
+void rtc_write();
+// state of last write, the loop is woken when it changes
+int rtc_state();
+
+#endif
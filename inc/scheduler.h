@@ -0,0 +1,43 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <time.h>
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Frame scheduler              */
+///////////////////////////////////
+// Instead of a fixed frame rate, the main loop sleeps until the next
+// deadline (next second, midnight...) or until there is input.
+// SDL 1.2 has no SDL_WaitEventTimeout and its SDL_WaitEvent polls every
+// 10 ms, so the sleep is done in select() over the evdev input devices,
+// falling back to short SDL_Delay slices when they can't be opened.
+
+#define SCHED_FOREVER   0xFFFFFFFF
+
+void sched_init();
+void sched_close();
+
+// sleep up to timeout ms, or less if there is input or a request
+void sched_wait(Uint32 timeout);
+// ask for next frame in ms at most (animations, held buttons)
+void sched_request(Uint32 ms);
+// interrupt a sleep from a signal handler or thread
+void sched_wake();
+
+// timeouts to the next wall clock boundaries
+Uint32 sched_to_next_second();
+Uint32 sched_to_midnight();
+Uint32 sched_to_time(time_t t);
+
+// monotonic ns of the last key press read by the kernel since last
+// call, 0 if none (evdev event time)
+Sint64 sched_input_press();
+// monotonic ns of the last press of evdev key code, 0 if none (the
+// code is SDL keysym.scancode on the console)
+Sint64 sched_key_press(int code);
+
+// wakeups: times the loop woke up, frames: sched_wait calls
+void sched_stats(Uint32* wakeups, Uint32* frames, double* seconds);
+
+#endif
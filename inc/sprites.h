@@ -0,0 +1,26 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Sprite sheets                */
+///////////////////////////////////
+// Each image sheet is kept as one surface in screen format with an RLE
+// colour key (magenta), sprites are rects inside it. Sheets belong to
+// the caller and are freed with SDL_FreeSurface.
+
+struct sprite
+{
+  SDL_Surface* sheet;     // NULL if not loaded
+  SDL_Rect rect;
+};
+
+// src to screen format with magenta transparent, src is freed
+SDL_Surface* sprite_convert(SDL_Surface* src);
+// BMP sheet from rw (closed), NULL on error
+SDL_Surface* sprite_load_sheet(SDL_RWops* rw);
+// count cells of w x h, left to right, into table
+void sprite_slice(SDL_Surface* sheet, sprite* table, int count, int w, int h);
+
+#endif
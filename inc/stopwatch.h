@@ -0,0 +1,55 @@
+#ifndef STOPWATCH_H
+#define STOPWATCH_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  Stopwatch and countdown      */
+///////////////////////////////////
+// Times are ns of CLOCK_MONOTONIC, taken when the button event was
+// received, so they don't depend on the frame rate, on SDL_Delay or on
+// the wall clock being set. Frames only show the current value.
+
+#define STOPWATCH_LAPS    99
+#define STOPWATCH_NS      1000000000LL
+
+struct stopwatch
+{
+  int running;
+  Sint64 start;                 // time of last start
+  Sint64 elapsed;               // total before last start
+  int laps;
+  Sint64 lap[STOPWATCH_LAPS];   // total time at each lap
+};
+
+struct countdown
+{
+  int running;
+  int expired;
+  Sint64 duration;
+  Sint64 end;                   // time it reaches zero, while running
+  Sint64 left;                  // while paused
+};
+
+Sint64 mono_now();
+
+void stopwatch_reset(stopwatch* sw);
+void stopwatch_start(stopwatch* sw, Sint64 t);
+void stopwatch_stop(stopwatch* sw, Sint64 t);
+// FALSE if there is no room for more laps
+int stopwatch_lap(stopwatch* sw, Sint64 t);
+Sint64 stopwatch_time(const stopwatch* sw, Sint64 t);
+
+// stopped with the whole duration left
+void countdown_set(countdown* cd, Sint64 duration);
+void countdown_start(countdown* cd, Sint64 t);
+void countdown_pause(countdown* cd, Sint64 t);
+Sint64 countdown_left(const countdown* cd, Sint64 t);
+// TRUE once, when it reaches zero
+int countdown_check(countdown* cd, Sint64 t);
+
+// split ns in hours, minutes, seconds and hundredths, rounded up for
+// countdowns so zero is only shown at the end
+void stopwatch_split(Sint64 ns, int round_up, int* hours, int* min, int* sec, int* cs);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef TEXT_FONT_H
+#define TEXT_FONT_H
+
+///////////////////////////////////
+/*  Font type                    */
+///////////////////////////////////
+// Built with BITMAP_FONTS the fonts are the baked ones in inc/bfont_*.h
+// and SDL_ttf/FreeType are not linked, otherwise SDL_ttf fonts. The
+// few direct glyph calls go through these wrappers.
+
+#ifdef BITMAP_FONTS
+
+#include "bitmap_font.h"
+
+typedef const bfont text_font;
+
+inline int font_ascent(text_font* f)
+{
+  return f->ascent;
+}
+
+inline int font_lineskip(text_font* f)
+{
+  return f->lineskip;
+}
+
+inline int font_glyph_metrics(text_font* f, Uint16 ch, int* minx, int* maxx, int* miny, int* maxy, int* advance)
+{
+  return bfont_glyph_metrics(f,ch,minx,maxx,miny,maxy,advance);
+}
+
+inline SDL_Surface* font_render_glyph(text_font* f, Uint16 ch, SDL_Color c)
+{
+  return bfont_render_glyph(f,ch,c);
+}
+
+#else
+
+#include <SDL/SDL_ttf.h>
+
+typedef TTF_Font text_font;
+
+inline int font_ascent(text_font* f)
+{
+  return TTF_FontAscent(f);
+}
+
+inline int font_lineskip(text_font* f)
+{
+  return TTF_FontLineSkip(f);
+}
+
+inline int font_glyph_metrics(text_font* f, Uint16 ch, int* minx, int* maxx, int* miny, int* maxy, int* advance)
+{
+  return TTF_GlyphMetrics(f,ch,minx,maxx,miny,maxy,advance);
+}
+
+inline SDL_Surface* font_render_glyph(text_font* f, Uint16 ch, SDL_Color c)
+{
+  return TTF_RenderGlyph_Blended(f,ch,c);
+}
+
+#endif
+
+#endif
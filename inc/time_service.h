@@ -0,0 +1,45 @@
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <time.h>
+
+///////////////////////////////////
+/*  Time service                 */
+///////////////////////////////////
+// The clock is read once per frame with timesvc_update(), the broken
+// down time is only recomputed when the second changes. A time_text
+// keeps the texts shown for a time and only rebuilds the parts whose
+// fields changed, from digit pair tables instead of strftime.
+
+struct time_text
+{
+  char time[6];       // "HH:MM", 12h or 24h
+  char seconds[4];    // ":SS"
+  char ampm[3];       // "AM" or "PM"
+  char part[3][24];   // date parts in order, first two with a space
+  char date[72];      // whole date, upper case
+
+  // values the texts were built from
+  int valid;
+  int hour;
+  int min;
+  int sec;
+  int format_24;
+  int year;
+  int mon;
+  int mday;
+  int ord[3];
+  const char* const* months;
+};
+
+// read the clock, TRUE if the second changed since last call
+int timesvc_update();
+time_t timesvc_now();
+const tm* timesvc_tm();
+// use t instead of the system clock (benchmarks), 0 back to clock
+void timesvc_set_fixed(time_t t);
+
+// months: 12 upper case names, ord: 0=day, 1=month, 2=year
+void timesvc_format(time_text* tt, const tm* t, int format_24, const char* const* months, int ord1, int ord2, int ord3);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  UTF-8 decoding               */
+///////////////////////////////////
+// All texts are UTF-8. Fonts are looked up by UCS-2 code point, as
+// SDL_ttf does, so chars outside the BMP and broken sequences are
+// UTF8_BAD (shown as the missing glyph box).
+
+#define UTF8_BAD    0xFFFD
+
+// code point at *s, *s moved past it, 0 at the end of the string
+inline Uint16 utf8_next(const char** s)
+{
+  const Uint8* p=(const Uint8*)*s;
+  Uint32 c=p[0];
+  int n;
+  if(c<0x80)
+    n=0;
+  else if((c&0xE0)==0xC0)
+  {
+    c&=0x1F;
+    n=1;
+  }
+  else if((c&0xF0)==0xE0)
+  {
+    c&=0x0F;
+    n=2;
+  }
+  else if((c&0xF8)==0xF0)
+  {
+    c&=0x07;
+    n=3;
+  }
+  else
+  {
+    *s+=1;
+    return UTF8_BAD;
+  }
+
+  for(int i=1; i<=n; i++)
+  {
+    if((p[i]&0xC0)!=0x80)
+    {
+      *s+=i;            // not a continuation, next char starts there
+      return UTF8_BAD;
+    }
+    c=(c<<6)|(p[i]&0x3F);
+  }
+  if(p[0])
+    *s+=n+1;
+  // overlong forms, surrogates and outside the BMP
+  static const Uint32 shortest[4]={0,0x80,0x800,0x10000};
+  if(c<shortest[n] || (c>=0xD800 && c<=0xDFFF) || c>0xFFFF)
+    return UTF8_BAD;
+  return (Uint16)c;
+}
+
+#endif
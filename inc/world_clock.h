@@ -0,0 +1,48 @@
+#ifndef WORLD_CLOCK_H
+#define WORLD_CLOCK_H
+
+#include <time.h>
+#include <SDL/SDL.h>
+
+///////////////////////////////////
+/*  World clock                  */
+///////////////////////////////////
+// Each city zone is read once from its TZif file in the zoneinfo
+// directory into sorted arrays of transition times, the rule in the
+// file footer expanded into more transitions up to WORLD_LAST_YEAR.
+// The offset at a time is found by binary search and kept until the
+// next transition, so showing N cities is N compares a frame, without
+// changing TZ and calling tzset() for each one.
+
+#define WORLD_MAX         6
+#define WORLD_NONE        -1
+#define WORLD_ZONEINFO    "/usr/share/zoneinfo"
+#define WORLD_LAST_YEAR   2100
+
+// root NULL for WORLD_ZONEINFO, a local copy to try other files
+// (ODCLOCK_ZONEINFO=/tmp/zoneinfo ./odclock)
+void world_init(const char* root);
+void world_free();
+
+// zone as "Europe/Madrid", index or WORLD_NONE if there is no room,
+// the file is read later by world_load()
+int world_add(const char* zone);
+// cities.ini, "City Europe/Madrid" lines, FALSE if it can't be read
+int world_load_list(const char* path);
+// read the files of zones added since last call, cities that can be shown
+int world_load();
+
+int world_count();
+// last part of the zone name, '_' as spaces
+const char* world_city(int i);
+const char* world_zone(int i);
+// offset east of UTC in s and abbreviation at t, FALSE if the file
+// couldn't be read
+int world_offset(int i, time_t t, int* offset, const char** abbr);
+// broken down time of t at offset, no libc
+void world_tm(time_t t, int offset, tm* out);
+
+// lookups answered by the cache or by binary search
+void world_stats(Uint32* hits, Uint32* misses);
+
+#endif
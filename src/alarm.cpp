@@ -0,0 +1,343 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Alarms                                    */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "../inc/alarm.h"
+#include "../inc/civil_date.h"
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static alarm_entry alarms[ALARM_MAX];
+static int alarms_n=0;
+static int heap[ALARM_MAX];         // alarm indices, earliest first
+static int heap_pos[ALARM_MAX];     // place of each alarm in heap, -1 if out
+static int heap_n=0;
+static time_t last_check=0;
+
+///////////////////////////////////
+/*  Min-heap on next fire time   */
+///////////////////////////////////
+static int heap_earlier(int p, int q)
+{
+  return alarms[heap[p]].next<alarms[heap[q]].next;
+}
+
+static void heap_swap(int p, int q)
+{
+  int tmp=heap[p];
+  heap[p]=heap[q];
+  heap[q]=tmp;
+  heap_pos[heap[p]]=p;
+  heap_pos[heap[q]]=q;
+}
+
+static void heap_up(int p)
+{
+  while(p>0)
+  {
+    int parent=(p-1)/2;
+    if(!heap_earlier(p,parent))
+      break;
+    heap_swap(p,parent);
+    p=parent;
+  }
+}
+
+static void heap_down(int p)
+{
+  for(;;)
+  {
+    int c=2*p+1;
+    if(c>=heap_n)
+      break;
+    if(c+1<heap_n && heap_earlier(c+1,c))
+      c++;
+    if(!heap_earlier(c,p))
+      break;
+    heap_swap(p,c);
+    p=c;
+  }
+}
+
+static void heap_remove(int i)
+{
+  int p=heap_pos[i];
+  if(p<0)
+    return;
+  heap_pos[i]=-1;
+  heap_n--;
+  if(p!=heap_n)
+  {
+    int moved=heap[heap_n];
+    heap[p]=moved;
+    heap_pos[moved]=p;
+    heap_up(p);
+    heap_down(heap_pos[moved]);
+  }
+}
+
+// move alarm i where its next time says, in or out of the heap
+static void heap_update(int i)
+{
+  if(!alarms[i].next)
+  {
+    heap_remove(i);
+    return;
+  }
+  if(heap_pos[i]<0)
+  {
+    heap[heap_n]=i;
+    heap_pos[i]=heap_n;
+    heap_n++;
+  }
+  heap_up(heap_pos[i]);
+  heap_down(heap_pos[i]);
+}
+
+// all alarms at once, O(n)
+static void heap_build()
+{
+  heap_n=0;
+  for(int i=0; i<alarms_n; i++)
+  {
+    heap_pos[i]=-1;
+    if(alarms[i].next)
+    {
+      heap[heap_n]=i;
+      heap_pos[i]=heap_n;
+      heap_n++;
+    }
+  }
+  for(int p=heap_n/2-1; p>=0; p--)
+    heap_down(p);
+}
+
+///////////////////////////////////
+/*  Next fire time               */
+///////////////////////////////////
+static int64_t local_day(time_t t)
+{
+  tm lt;
+  localtime_r(&t,&lt);
+  return days_from_civil(lt.tm_year+1900,lt.tm_mon+1,lt.tm_mday);
+}
+
+// first time after now on an alarm day. fired: time it just rang, that
+// day is skipped, or the repeated hour when DST ends would ring twice
+static time_t next_fire(const alarm_entry* a, time_t now, time_t fired)
+{
+  int64_t day=local_day(now);
+  if(fired && local_day(fired)+1>day)
+    day=local_day(fired)+1;
+
+  // one week and one day: today can be too late for its own weekday
+  for(int d=0; d<8; d++)
+  {
+    if(a->days!=ALARM_ONCE && !(a->days&(1<<civil_weekday(day+d))))
+      continue;
+
+    civil_date c=civil_from_days(day+d);
+    tm t;
+    memset(&t,0,sizeof(tm));
+    t.tm_year=(int)(c.year-1900);
+    t.tm_mon=c.month-1;
+    t.tm_mday=c.day;
+    t.tm_hour=a->hour;
+    t.tm_min=a->min;
+    t.tm_isdst=-1;          // DST of that day, a skipped hour moves forward
+    time_t ft=mktime(&t);
+    if(ft!=(time_t)-1 && ft>now)
+      return ft;
+  }
+  return 0;
+}
+
+static void schedule(int i, time_t now)
+{
+  alarm_entry* a=&alarms[i];
+  a->snoozed=FALSE;
+  a->next=a->enabled?next_fire(a,now,0):0;
+  heap_update(i);
+}
+
+///////////////////////////////////
+/*  List                         */
+///////////////////////////////////
+int alarm_count()
+{
+  return alarms_n;
+}
+
+const alarm_entry* alarm_get(int i)
+{
+  if(i<0 || i>=alarms_n)
+    return NULL;
+  return &alarms[i];
+}
+
+int alarm_add(const alarm_entry* a, time_t now)
+{
+  if(alarms_n>=ALARM_MAX)
+    return ALARM_NONE;
+  int i=alarms_n++;
+  heap_pos[i]=-1;
+  alarms[i].next=0;
+  alarm_set(i,a,now);
+  return i;
+}
+
+void alarm_set(int i, const alarm_entry* a, time_t now)
+{
+  if(i<0 || i>=alarms_n)
+    return;
+  alarms[i].hour=a->hour;
+  alarms[i].min=a->min;
+  alarms[i].days=a->days&0x7f;
+  alarms[i].enabled=a->enabled;
+  alarms[i].snooze=a->snooze;
+  schedule(i,now);
+}
+
+void alarm_enable(int i, int enabled, time_t now)
+{
+  if(i<0 || i>=alarms_n)
+    return;
+  alarms[i].enabled=enabled;
+  schedule(i,now);
+}
+
+void alarm_remove(int i)
+{
+  if(i<0 || i>=alarms_n)
+    return;
+  heap_remove(i);
+  alarms_n--;
+  for(int j=i; j<alarms_n; j++)
+  {
+    alarms[j]=alarms[j+1];
+    heap_pos[j]=heap_pos[j+1];
+  }
+  // heap keeps its order, only the indices changed
+  for(int p=0; p<heap_n; p++)
+    if(heap[p]>i)
+      heap[p]--;
+}
+
+///////////////////////////////////
+/*  Check and snooze             */
+///////////////////////////////////
+int alarm_check(time_t now, int* changed)
+{
+  // clock went back, the times to come can be wrong
+  if(now<last_check)
+    alarm_time_changed(now);
+  last_check=now;
+
+  while(heap_n>0 && alarms[heap[0]].next<=now)
+  {
+    int i=heap[0];
+    alarm_entry* a=&alarms[i];
+    time_t due=a->next;
+    time_t fired=due;
+
+    if(a->snoozed)
+    {
+      a->snoozed=FALSE;
+      fired=0;              // regular time already skipped
+    }
+    else if(a->days==ALARM_ONCE)
+    {
+      a->enabled=FALSE;
+      if(changed)
+        *changed=TRUE;
+    }
+    a->next=a->enabled?next_fire(a,now,fired):0;
+    heap_update(i);
+
+    // device was off or suspended, or clock set forward from outside
+    if(now-due<=ALARM_LATE_MAX)
+      return i;
+  }
+  return ALARM_NONE;
+}
+
+void alarm_snooze(int i, time_t now)
+{
+  if(i<0 || i>=alarms_n || !alarms[i].snooze)
+    return;
+  alarms[i].next=now+alarms[i].snooze*60;
+  alarms[i].snoozed=TRUE;
+  heap_update(i);
+}
+
+// snoozes are dropped too
+void alarm_time_changed(time_t now)
+{
+  for(int i=0; i<alarms_n; i++)
+  {
+    alarms[i].snoozed=FALSE;
+    alarms[i].next=alarms[i].enabled?next_fire(&alarms[i],now,0):0;
+  }
+  heap_build();
+  last_check=now;
+}
+
+time_t alarm_next()
+{
+  if(heap_n==0)
+    return 0;
+  return alarms[heap[0]].next;
+}
+
+///////////////////////////////////
+/*  Load and save                */
+///////////////////////////////////
+// one line per alarm: Alarm hour min days enabled snooze
+int alarm_load(const char* path, time_t now)
+{
+  FILE* file=fopen(path,"r");
+  alarms_n=0;
+  heap_n=0;
+  last_check=now;
+  if(file==NULL)
+    return FALSE;
+
+  char str[80];
+  char var[50];
+  while(fgets(str,80,file)!=NULL && alarms_n<ALARM_MAX)
+  {
+    alarm_entry* a=&alarms[alarms_n];
+    memset(a,0,sizeof(alarm_entry));
+    if(sscanf(str,"%49s %d %d %d %d %d",var,&a->hour,&a->min,&a->days,&a->enabled,&a->snooze)!=6 || strcmp(var,"Alarm")!=0)
+      continue;
+    if(a->hour<0 || a->hour>23 || a->min<0 || a->min>59 || a->snooze<0 || a->snooze>60)
+      continue;
+    a->days&=0x7f;
+    a->enabled=a->enabled?TRUE:FALSE;
+    a->next=a->enabled?next_fire(a,now,0):0;
+    alarms_n++;
+  }
+  fclose(file);
+  heap_build();
+  return TRUE;
+}
+
+int alarm_save(const char* path)
+{
+  FILE* file=fopen(path,"wb");
+  if(file==NULL)
+    return FALSE;
+  for(int i=0; i<alarms_n; i++)
+    fprintf(file,"Alarm %d %d %d %d %d\n",alarms[i].hour,alarms[i].min,alarms[i].days,alarms[i].enabled,alarms[i].snooze);
+  fclose(file);
+  return TRUE;
+}
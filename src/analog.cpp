@@ -0,0 +1,204 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Analog clock face                         */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "../inc/analog.h"
+#include "../inc/raster.h"
+#include "../inc/render.h"
+
+#define ANALOG_SHIFT    14      // ANALOG_ONE=1<<ANALOG_SHIFT
+#define ANALOG_PI       3.14159265358979323846
+
+// hand lengths from the centre
+#define HAND_HOUR       30
+#define HAND_MIN        46
+#define HAND_SEC        52
+#define HAND_SEC_TAIL   10
+
+///////////////////////////////////
+/*  Sin table, at compile time   */
+///////////////////////////////////
+// Taylor series x - x^3/3! + x^5/5! ..., x in -pi..pi
+constexpr double series_sin(double x, double term, int n)
+{
+  return n>31?term:term+series_sin(x,-term*x*x/((n+1)*(n+2)),n+2);
+}
+
+constexpr double step_angle(int step)
+{
+  return 2*ANALOG_PI*(step<=ANALOG_STEPS/2?step:step-ANALOG_STEPS)/ANALOG_STEPS;
+}
+
+constexpr Sint16 round_fixed(double v)
+{
+  return (Sint16)(v<0?v*ANALOG_ONE-0.5:v*ANALOG_ONE+0.5);
+}
+
+constexpr Sint16 fixed_sin(int step)
+{
+  return round_fixed(series_sin(step_angle(step),step_angle(step),1));
+}
+
+// 0..n-1 as a template pack, split in halves to keep recursion short
+template<int... I> struct steps {};
+
+template<class A, class B> struct join_steps;
+template<int... A, int... B> struct join_steps<steps<A...>,steps<B...> >
+{
+  typedef steps<A...,(int)sizeof...(A)+B...> type;
+};
+
+template<int N> struct make_steps
+{
+  typedef typename join_steps<typename make_steps<N/2>::type,typename make_steps<N-N/2>::type>::type type;
+};
+template<> struct make_steps<0> { typedef steps<> type; };
+template<> struct make_steps<1> { typedef steps<0> type; };
+
+struct sin_table
+{
+  Sint16 v[ANALOG_STEPS];
+};
+
+template<int... I> constexpr sin_table build_table(steps<I...>)
+{
+  return sin_table{{fixed_sin(I)...}};
+}
+
+static constexpr sin_table sin_q14=build_table(make_steps<ANALOG_STEPS>::type());
+
+static_assert(sin_q14.v[ANALOG_STEPS/4]==ANALOG_ONE && sin_q14.v[ANALOG_STEPS/2]==0 &&
+              sin_q14.v[ANALOG_STEPS*3/4]==-ANALOG_ONE,"sin table");
+
+int analog_sin(int step)
+{
+  step%=ANALOG_STEPS;
+  if(step<0)
+    step+=ANALOG_STEPS;
+  return sin_q14.v[step];
+}
+
+int analog_cos(int step)
+{
+  return analog_sin(step+ANALOG_STEPS/4);
+}
+
+///////////////////////////////////
+/*  Geometry                     */
+///////////////////////////////////
+// step 0 is 12 o'clock, clockwise
+static void hand_point(int cx, int cy, int step, int len, int* x, int* y)
+{
+  *x=cx+((analog_sin(step)*len+ANALOG_ONE/2)>>ANALOG_SHIFT);
+  *y=cy-((analog_cos(step)*len+ANALOG_ONE/2)>>ANALOG_SHIFT);
+}
+
+// wide lines are copies moved across the longer axis
+static void line_offset(int dx, int dy, int* ox, int* oy)
+{
+  if(abs(dx)>abs(dy))
+  {
+    *ox=0;
+    *oy=1;
+  }
+  else
+  {
+    *ox=1;
+    *oy=0;
+  }
+}
+
+static int isqrt(int n)
+{
+  int r=0;
+  while((r+1)*(r+1)<=n)
+    r++;
+  return r;
+}
+
+static void fill_circle(SDL_Surface* dst, int cx, int cy, int r, Uint32 colour)
+{
+  for(int dy=-r; dy<=r; dy++)
+  {
+    int half=isqrt(r*r+r-dy*dy);
+    raster_span(dst,cx-half,cy+dy,2*half+1,colour);
+  }
+}
+
+///////////////////////////////////
+/*  Dial                         */
+///////////////////////////////////
+void analog_bake_dial(SDL_Surface* dst, Uint32 key, Uint32 face, Uint32 rim, Uint32 ticks)
+{
+  int c=ANALOG_SIZE/2;
+
+  SDL_FillRect(dst,NULL,key);
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return;
+
+  fill_circle(dst,c,c,ANALOG_RADIUS,rim);
+  fill_circle(dst,c,c,ANALOG_RADIUS-3,face);
+
+  // minutes, longer and wider at the hours
+  for(int m=0; m<60; m++)
+  {
+    int step=m*ANALOG_STEPS/60;
+    int x0,y0,x1,y1;
+    hand_point(c,c,step,(m%5)?ANALOG_RADIUS-8:ANALOG_RADIUS-13,&x0,&y0);
+    hand_point(c,c,step,ANALOG_RADIUS-5,&x1,&y1);
+    raster_line(dst,x0,y0,x1,y1,ticks);
+    if(m%5==0)
+    {
+      int ox,oy;
+      line_offset(x1-x0,y1-y0,&ox,&oy);
+      raster_line(dst,x0+ox,y0+oy,x1+ox,y1+oy,ticks);
+    }
+  }
+
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+}
+
+///////////////////////////////////
+/*  Hands                        */
+///////////////////////////////////
+static void draw_hand(int cx, int cy, int step, int len, int tail, int width, Uint32 colour)
+{
+  int x0,y0,x1,y1,ox,oy;
+  hand_point(cx,cy,step,len,&x1,&y1);
+  hand_point(cx,cy,step+ANALOG_STEPS/2,tail,&x0,&y0);
+  line_offset(x1-x0,y1-y0,&ox,&oy);
+  // 0, 1, -1...
+  for(int w=0; w<width; w++)
+  {
+    int k=(w&1)?(w+1)/2:-(w/2);
+    render_line(x0+k*ox,y0+k*oy,x1+k*ox,y1+k*oy,colour);
+  }
+}
+
+void analog_draw_hands(int cx, int cy, const tm* t, int ms, const analog_colours* c)
+{
+  // a whole turn is ANALOG_STEPS for each hand
+  int hour=(t->tm_hour%12)*60+t->tm_min;
+  int min=(t->tm_min*60+t->tm_sec)*ANALOG_STEPS/3600;
+  int sec=(t->tm_sec*1000+ms)*ANALOG_STEPS/60000;
+
+  draw_hand(cx,cy,hour,HAND_HOUR,0,3,c->hour);
+  draw_hand(cx,cy,min,HAND_MIN,0,2,c->min);
+  draw_hand(cx,cy,sec,HAND_SEC,HAND_SEC_TAIL,1,c->sec);
+
+  SDL_Rect cap={(Sint16)(cx-2),(Sint16)(cy-2),5,5};
+  render_fill(&cap,c->cap);
+}
+
+Uint32 analog_to_next_step(int ms)
+{
+  // second hand steps are 60000/ANALOG_STEPS ms
+  int step=ms*ANALOG_STEPS/60000;
+  int next=((step+1)*60000+ANALOG_STEPS-1)/ANALOG_STEPS;
+  return (Uint32)(next-ms);
+}
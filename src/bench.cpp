@@ -0,0 +1,152 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Frame time benchmark                      */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#ifdef BENCHMARK
+
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../inc/bench.h"
+
+#define BENCH_NAME_LEN  32
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static const char* section_names[BENCH_SECTIONS]=
+{
+  "update","menu","mode","render"
+};
+
+static char case_name[BENCH_NAME_LEN];
+static int case_full=0;
+static int case_open=0;
+static int cases_done=0;
+static long long* frame_ns=NULL;
+static int frames=0;
+static int frames_size=0;
+static long long section_sum[BENCH_SECTIONS];
+static long long section_max[BENCH_SECTIONS];
+static long long frame_start=0;
+static long long mark_last=0;
+
+///////////////////////////////////
+/*  Monotonic time in ns         */
+///////////////////////////////////
+static long long now_ns()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (long long)ts.tv_sec*1000000000LL+ts.tv_nsec;
+}
+
+static int compare_ns(const void* a, const void* b)
+{
+  long long x=*(const long long*)a;
+  long long y=*(const long long*)b;
+  return x<y?-1:(x>y?1:0);
+}
+
+///////////////////////////////////
+/*  Print finished case          */
+///////////////////////////////////
+static void print_case()
+{
+  if(!case_open)
+    return;
+  case_open=0;
+
+  double mean=0, p50=0, p99=0, max=0;
+  if(frames>0)
+  {
+    long long sum=0;
+    for(int f=0; f<frames; f++)
+      sum+=frame_ns[f];
+    qsort(frame_ns,frames,sizeof(long long),compare_ns);
+    mean=sum/1000.0/frames;
+    p50=frame_ns[(frames-1)*50/100]/1000.0;
+    p99=frame_ns[(frames-1)*99/100]/1000.0;
+    max=frame_ns[frames-1]/1000.0;
+  }
+
+  printf("%s\n    {\"name\":\"%s\",\"full_redraw\":%s,\"frames\":%d,",cases_done?",":"",case_name,case_full?"true":"false",frames);
+  printf("\"mean_us\":%.2f,\"p50_us\":%.2f,\"p99_us\":%.2f,\"max_us\":%.2f,\"sections\":{",mean,p50,p99,max);
+  for(int s=0; s<BENCH_SECTIONS; s++)
+  {
+    printf("%s\"%s\":{\"mean_us\":%.2f,\"max_us\":%.2f}",s?",":"",section_names[s],
+           frames>0?section_sum[s]/1000.0/frames:0.0,section_max[s]/1000.0);
+  }
+  printf("}}");
+  cases_done++;
+}
+
+///////////////////////////////////
+/*  Cases and frames             */
+///////////////////////////////////
+void bench_start()
+{
+  cases_done=0;
+  printf("{\n  \"cases\":[");
+}
+
+void bench_case(const char* name, int full_redraw)
+{
+  print_case();
+  strncpy(case_name,name,BENCH_NAME_LEN-1);
+  case_name[BENCH_NAME_LEN-1]=0;
+  case_full=full_redraw;
+  case_open=1;
+  frames=0;
+  memset(section_sum,0,sizeof(section_sum));
+  memset(section_max,0,sizeof(section_max));
+}
+
+void bench_frame_begin()
+{
+  frame_start=now_ns();
+  mark_last=frame_start;
+}
+
+void bench_mark(int section)
+{
+  long long now=now_ns();
+  long long t=now-mark_last;
+  mark_last=now;
+  if(section<0 || section>=BENCH_SECTIONS)
+    return;
+  section_sum[section]+=t;
+  if(t>section_max[section])
+    section_max[section]=t;
+}
+
+void bench_frame_end()
+{
+  long long t=now_ns()-frame_start;
+  if(frames>=frames_size)
+  {
+    int size=frames_size?frames_size*2:1024;
+    long long* p=(long long*)realloc(frame_ns,size*sizeof(long long));
+    if(!p)
+      return;
+    frame_ns=p;
+    frames_size=size;
+  }
+  frame_ns[frames++]=t;
+}
+
+void bench_finish()
+{
+  print_case();
+  printf("\n  ]\n}\n");
+  fflush(stdout);
+  free(frame_ns);
+  frame_ns=NULL;
+  frames_size=0;
+}
+
+#endif
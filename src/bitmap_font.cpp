@@ -0,0 +1,228 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Prerasterized bitmap fonts                */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include "../inc/bitmap_font.h"
+#include "../inc/blend.h"
+#include "../inc/utf8.h"
+
+///////////////////////////////////
+/*  Glyph and kerning lookup     */
+///////////////////////////////////
+// chars past the last one get the missing glyph box, as in SDL_ttf
+static const bfont_glyph* get_glyph(const bfont* f, Uint16 ch)
+{
+  if(ch<f->first)
+    return NULL;
+  if(ch>f->last)
+    return f->missing?&f->glyph[f->missing-f->first]:NULL;
+  return &f->glyph[ch-f->first];
+}
+
+int bfont_has_glyph(const bfont* f, Uint16 ch)
+{
+  return ch>=f->first && ch<=f->last && f->glyph[ch-f->first].provided;
+}
+
+int bfont_kerning(const bfont* f, Uint16 left, Uint16 right)
+{
+  int lo=0, hi=f->nkern-1;
+  Uint32 key=((Uint32)left<<16)|right;
+  while(lo<=hi)
+  {
+    int mid=(lo+hi)/2;
+    Uint32 k=((Uint32)f->kern[mid].left<<16)|f->kern[mid].right;
+    if(k==key)
+      return f->kern[mid].delta;
+    if(k<key)
+      lo=mid+1;
+    else
+      hi=mid-1;
+  }
+  return 0;
+}
+
+///////////////////////////////////
+/*  Draw one glyph               */
+///////////////////////////////////
+// rows widened from 4 to 8 bit coverage for the blend kernels
+static void draw_glyph(SDL_Surface* dst, const bfont* f, const bfont_glyph* g, int x, int y, SDL_Color c)
+{
+  const SDL_Rect* clip=&dst->clip_rect;
+  const Uint8* bits=f->bits+g->offset;
+  int pitch=(g->w+1)/2;
+  Uint8 row[256];
+
+  for(int gy=0; gy<g->h; gy++, bits+=pitch)
+  {
+    if(y+gy<clip->y || y+gy>=clip->y+clip->h)
+      continue;
+    for(int gx=0; gx<g->w; gx++)
+    {
+      int a=(gx&1)?(bits[gx>>1]&0x0f):(bits[gx>>1]>>4);
+      row[gx]=(Uint8)(a*17);
+    }
+    blend_a8(dst,x,y+gy,row,g->w,g->w,1,c);
+  }
+}
+
+///////////////////////////////////
+/*  Draw string                  */
+///////////////////////////////////
+int bfont_draw(SDL_Surface* dst, const bfont* f, const char* string, int x, int y, SDL_Color c)
+{
+  if(!dst || !f || !string)
+    return 0;
+  if(dst->format->BytesPerPixel!=2 && dst->format->BytesPerPixel!=4)
+    return 0;
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return 0;
+
+  int pen=0;
+  const char* p=string;
+  Uint16 ch, prev=0;
+  while((ch=utf8_next(&p))!=0)
+  {
+    const bfont_glyph* g=get_glyph(f,ch);
+    if(g)
+    {
+      if(prev)
+        pen+=bfont_kerning(f,prev,ch);
+      else if(g->minx<0)
+        pen-=g->minx;     // same start offset as TTF_RenderText
+      if(g->w && g->h)
+        draw_glyph(dst,f,g,x+pen+g->minx,y+f->ascent-g->maxy,c);
+      pen+=g->advance;
+      prev=ch;
+    }
+  }
+
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+  return pen;
+}
+
+///////////////////////////////////
+/*  String width                 */
+///////////////////////////////////
+int bfont_width(const bfont* f, const char* string)
+{
+  if(!f || !string)
+    return 0;
+
+  int n;
+  return bfont_layout(f,string,NULL,NULL,0,&n);
+}
+
+///////////////////////////////////
+/*  Laid out chars               */
+///////////////////////////////////
+// pens as bfont_draw moves them, the width as TTF_SizeText; ch and pen
+// may be NULL to get only the width
+int bfont_layout(const bfont* f, const char* string, Uint16* ch, Sint16* pen, int max, int* n)
+{
+  *n=0;
+  if(!f || !string)
+    return 0;
+
+  int x=0, start=0, minx=0, maxx=0, z;
+  const char* p=string;
+  Uint16 c, prev=0;
+  while((c=utf8_next(&p))!=0)
+  {
+    const bfont_glyph* g=get_glyph(f,c);
+    if(g)
+    {
+      int right=g->minx+g->w;
+      if(prev)
+        x+=bfont_kerning(f,prev,c);
+      else if(g->minx<0)
+        start=-g->minx;
+      z=x+g->minx;
+      if(minx>z)
+        minx=z;
+      z=x+(g->advance>right?g->advance:right);
+      if(maxx<z)
+        maxx=z;
+      if(ch && *n<max)
+      {
+        ch[*n]=c;
+        pen[*n]=(Sint16)(start+x);
+        (*n)++;
+      }
+      x+=g->advance;
+      prev=c;
+    }
+  }
+  return maxx-minx;
+}
+
+void bfont_draw_chars(SDL_Surface* dst, const bfont* f, const Uint16* ch, const Sint16* pen, int n, int x, int y, SDL_Color c)
+{
+  if(!dst || !f || n<=0)
+    return;
+  if(dst->format->BytesPerPixel!=2 && dst->format->BytesPerPixel!=4)
+    return;
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return;
+
+  for(int i=0; i<n; i++)
+  {
+    const bfont_glyph* g=get_glyph(f,ch[i]);
+    if(g && g->w && g->h)
+      draw_glyph(dst,f,g,x+pen[i]+g->minx,y+f->ascent-g->maxy,c);
+  }
+
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+}
+
+///////////////////////////////////
+/*  Single glyph                 */
+///////////////////////////////////
+int bfont_glyph_metrics(const bfont* f, Uint16 ch, int* minx, int* maxx, int* miny, int* maxy, int* advance)
+{
+  const bfont_glyph* g=get_glyph(f,ch);
+  if(!g)
+    return -1;
+  if(minx)
+    *minx=g->minx;
+  if(maxx)
+    *maxx=g->minx+g->w;
+  if(miny)
+    *miny=g->maxy-g->h;
+  if(maxy)
+    *maxy=g->maxy;
+  if(advance)
+    *advance=g->advance;
+  return 0;
+}
+
+// 32 bit surface with colour c and coverage in alpha
+SDL_Surface* bfont_render_glyph(const bfont* f, Uint16 ch, SDL_Color c)
+{
+  const bfont_glyph* g=get_glyph(f,ch);
+  if(!g || !g->w || !g->h)
+    return NULL;
+
+  SDL_Surface* s=SDL_CreateRGBSurface(SDL_SWSURFACE,g->w,g->h,32,0x00ff0000,0x0000ff00,0x000000ff,0xff000000);
+  if(!s)
+    return NULL;
+  Uint32 rgb=(c.r<<16)|(c.g<<8)|c.b;
+  int pitch=(g->w+1)/2;
+  for(int y=0; y<g->h; y++)
+  {
+    const Uint8* row=f->bits+g->offset+y*pitch;
+    Uint32* p=(Uint32*)((Uint8*)s->pixels+y*s->pitch);
+    for(int x=0; x<g->w; x++)
+    {
+      int a=(x&1)?(row[x>>1]&0x0f):(row[x>>1]>>4);
+      p[x]=((Uint32)(a*17)<<24)|rgb;
+    }
+  }
+  SDL_SetAlpha(s,SDL_SRCALPHA,SDL_ALPHA_OPAQUE);
+  return s;
+}
@@ -0,0 +1,269 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Text coverage blending                    */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "../inc/blend.h"
+#ifdef BENCHMARK
+#include "../inc/bench.h"
+#endif
+
+// asked for by the Makefile, the compiler must have it
+#if defined(BLEND_NEON) && !(defined(__ARM_NEON) || defined(__ARM_NEON__))
+#error "BLEND_NEON without NEON, see ARCHFLAGS in the Makefile"
+#endif
+#if defined(BLEND_SSE2) && !defined(__SSE2__)
+#error "BLEND_SSE2 without SSE2"
+#endif
+
+#if defined(BLEND_NEON)
+#include <arm_neon.h>
+#define BLEND_VECTOR  "neon"
+#elif defined(BLEND_SSE2)
+#include <emmintrin.h>
+#define BLEND_VECTOR  "sse2"
+#endif
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Plain C                      */
+///////////////////////////////////
+// each field moves (c-d)*a/256 towards the colour, with 255 taken as
+// 256 so full coverage gives the colour itself
+static inline Uint16 blend_pixel565(Uint16 d, int a, int cr, int cg, int cb)
+{
+  a+=a>>7;
+  int r=d>>11, g=(d>>5)&0x3F, b=d&0x1F;
+  r+=((cr-r)*a)>>8;
+  g+=((cg-g)*a)>>8;
+  b+=((cb-b)*a)>>8;
+  return (Uint16)((r<<11)|(g<<5)|b);
+}
+
+static void blend_c(Uint16* dst, const Uint8* mask, int n, Uint16 colour)
+{
+  int cr=colour>>11, cg=(colour>>5)&0x3F, cb=colour&0x1F;
+  for(int i=0; i<n; i++)
+  {
+    int a=mask[i];
+    if(a==255)
+      dst[i]=colour;
+    else if(a)
+      dst[i]=blend_pixel565(dst[i],a,cr,cg,cb);
+  }
+}
+
+///////////////////////////////////
+/*  NEON, 8 pixels at a time     */
+///////////////////////////////////
+#if defined(BLEND_VECTOR) && defined(BLEND_NEON)
+static void blend_vector(Uint16* dst, const Uint8* mask, int n, Uint16 colour)
+{
+  int16x8_t cr=vdupq_n_s16(colour>>11);
+  int16x8_t cg=vdupq_n_s16((colour>>5)&0x3F);
+  int16x8_t cb=vdupq_n_s16(colour&0x1F);
+  int16x8_t m6=vdupq_n_s16(0x3F);
+  int16x8_t m5=vdupq_n_s16(0x1F);
+
+  int i=0;
+  for(; i+8<=n; i+=8)
+  {
+    uint8x8_t m=vld1_u8(mask+i);
+    if(vget_lane_u64(vreinterpret_u64_u8(m),0)==0)
+      continue;     // between glyphs
+    int16x8_t a=vreinterpretq_s16_u16(vmovl_u8(m));
+    a=vaddq_s16(a,vshrq_n_s16(a,7));
+
+    int16x8_t d=vreinterpretq_s16_u16(vld1q_u16(dst+i));
+    int16x8_t r=vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(d),11));
+    int16x8_t g=vandq_s16(vshrq_n_s16(d,5),m6);
+    int16x8_t b=vandq_s16(d,m5);
+    r=vaddq_s16(r,vshrq_n_s16(vmulq_s16(vsubq_s16(cr,r),a),8));
+    g=vaddq_s16(g,vshrq_n_s16(vmulq_s16(vsubq_s16(cg,g),a),8));
+    b=vaddq_s16(b,vshrq_n_s16(vmulq_s16(vsubq_s16(cb,b),a),8));
+
+    int16x8_t p=vorrq_s16(vorrq_s16(vshlq_n_s16(r,11),vshlq_n_s16(g,5)),b);
+    vst1q_u16(dst+i,vreinterpretq_u16_s16(p));
+  }
+  blend_c(dst+i,mask+i,n-i,colour);
+}
+#endif
+
+///////////////////////////////////
+/*  SSE2, 8 pixels at a time     */
+///////////////////////////////////
+#if defined(BLEND_VECTOR) && defined(BLEND_SSE2)
+static void blend_vector(Uint16* dst, const Uint8* mask, int n, Uint16 colour)
+{
+  __m128i cr=_mm_set1_epi16(colour>>11);
+  __m128i cg=_mm_set1_epi16((colour>>5)&0x3F);
+  __m128i cb=_mm_set1_epi16(colour&0x1F);
+  __m128i m6=_mm_set1_epi16(0x3F);
+  __m128i m5=_mm_set1_epi16(0x1F);
+  __m128i zero=_mm_setzero_si128();
+
+  int i=0;
+  for(; i+8<=n; i+=8)
+  {
+    __m128i m=_mm_loadl_epi64((const __m128i*)(mask+i));
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(m,zero))==0xFFFF)
+      continue;     // between glyphs
+    __m128i a=_mm_unpacklo_epi8(m,zero);
+    a=_mm_add_epi16(a,_mm_srli_epi16(a,7));
+
+    __m128i d=_mm_loadu_si128((const __m128i*)(dst+i));
+    __m128i r=_mm_srli_epi16(d,11);
+    __m128i g=_mm_and_si128(_mm_srli_epi16(d,5),m6);
+    __m128i b=_mm_and_si128(d,m5);
+    r=_mm_add_epi16(r,_mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(cr,r),a),8));
+    g=_mm_add_epi16(g,_mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(cg,g),a),8));
+    b=_mm_add_epi16(b,_mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(cb,b),a),8));
+
+    __m128i p=_mm_or_si128(_mm_or_si128(_mm_slli_epi16(r,11),_mm_slli_epi16(g,5)),b);
+    _mm_storeu_si128((__m128i*)(dst+i),p);
+  }
+  blend_c(dst+i,mask+i,n-i,colour);
+}
+#endif
+
+///////////////////////////////////
+/*  RGB565 row                   */
+///////////////////////////////////
+void blend_a8_rgb565(Uint16* dst, const Uint8* mask, int n, Uint16 colour)
+{
+#ifdef BLEND_VECTOR
+  blend_vector(dst,mask,n,colour);
+#else
+  blend_c(dst,mask,n,colour);
+#endif
+}
+
+const char* blend_kernel()
+{
+#ifdef BLEND_VECTOR
+  return BLEND_VECTOR;
+#else
+  return "c";
+#endif
+}
+
+///////////////////////////////////
+/*  Any other format             */
+///////////////////////////////////
+static void blend_row_any(SDL_Surface* dst, Uint8* p, const Uint8* mask, int n, SDL_Color c)
+{
+  int bpp=dst->format->BytesPerPixel;
+  for(int i=0; i<n; i++, p+=bpp)
+  {
+    int a=mask[i];
+    if(a==0)
+      continue;
+    a+=a>>7;
+    Uint32 pixel=(bpp==2)?*(Uint16*)p:*(Uint32*)p;
+    Uint8 r,g,b;
+    SDL_GetRGB(pixel,dst->format,&r,&g,&b);
+    r+=((c.r-r)*a)>>8;
+    g+=((c.g-g)*a)>>8;
+    b+=((c.b-b)*a)>>8;
+    pixel=SDL_MapRGB(dst->format,r,g,b);
+    if(bpp==2)
+      *(Uint16*)p=(Uint16)pixel;
+    else
+      *(Uint32*)p=pixel;
+  }
+}
+
+///////////////////////////////////
+/*  Blend a mask in a surface    */
+///////////////////////////////////
+void blend_a8(SDL_Surface* dst, int x, int y, const Uint8* mask, int pitch, int w, int h, SDL_Color c)
+{
+  int bpp=dst->format->BytesPerPixel;
+  if(bpp!=2 && bpp!=4)
+    return;
+
+  const SDL_Rect* clip=&dst->clip_rect;
+  int x1=x, y1=y, x2=x+w, y2=y+h;
+  if(x1<clip->x)
+    x1=clip->x;
+  if(y1<clip->y)
+    y1=clip->y;
+  if(x2>clip->x+clip->w)
+    x2=clip->x+clip->w;
+  if(y2>clip->y+clip->h)
+    y2=clip->y+clip->h;
+  if(x1>=x2 || y1>=y2)
+    return;
+
+  int rgb565=(bpp==2 && dst->format->Rmask==0xF800 && dst->format->Gmask==0x07E0);
+  Uint16 colour=(Uint16)SDL_MapRGB(dst->format,c.r,c.g,c.b);
+  for(int py=y1; py<y2; py++)
+  {
+    const Uint8* m=mask+(py-y)*pitch+(x1-x);
+    Uint8* p=(Uint8*)dst->pixels+py*dst->pitch+x1*bpp;
+    if(rgb565)
+      blend_a8_rgb565((Uint16*)p,m,x2-x1,colour);
+    else
+      blend_row_any(dst,p,m,x2-x1,c);
+  }
+}
+
+#ifdef BENCHMARK
+///////////////////////////////////
+/*  Benchmark                    */
+///////////////////////////////////
+#define BLEND_BENCH_W   320
+#define BLEND_BENCH_H   240
+
+static void bench_rows(Uint16* pixels, const Uint8* mask, int frames, int vector)
+{
+  for(int f=0; f<frames; f++)
+  {
+    bench_frame_begin();
+    for(int y=0; y<BLEND_BENCH_H; y++)
+    {
+      if(vector)
+        blend_a8_rgb565(pixels+y*BLEND_BENCH_W,mask+y*BLEND_BENCH_W,BLEND_BENCH_W,0xFFE0);
+      else
+        blend_c(pixels+y*BLEND_BENCH_W,mask+y*BLEND_BENCH_W,BLEND_BENCH_W,0xFFE0);
+    }
+    bench_frame_end();
+  }
+}
+
+void blend_bench(int frames)
+{
+  Uint16* pixels=(Uint16*)malloc(BLEND_BENCH_W*BLEND_BENCH_H*sizeof(Uint16));
+  Uint8* mask=(Uint8*)malloc(BLEND_BENCH_W*BLEND_BENCH_H);
+  if(!pixels || !mask)
+  {
+    free(pixels);
+    free(mask);
+    return;
+  }
+
+  // text like: glyph cells of mixed coverage with gaps between them
+  srand(1);
+  for(int i=0; i<BLEND_BENCH_W*BLEND_BENCH_H; i++)
+  {
+    int gap=((i%BLEND_BENCH_W)%10)>=7;
+    mask[i]=gap?0:(Uint8)((rand()%3)?(rand()&0xFF):255);
+    pixels[i]=(Uint16)rand();
+  }
+
+  bench_case("blend_text_c",FALSE);
+  bench_rows(pixels,mask,frames,FALSE);
+#ifdef BLEND_VECTOR
+  bench_case("blend_text_" BLEND_VECTOR,FALSE);
+  bench_rows(pixels,mask,frames,TRUE);
+#endif
+
+  free(pixels);
+  free(mask);
+}
+#endif
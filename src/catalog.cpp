@@ -0,0 +1,286 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Localisation catalog                      */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../inc/catalog.h"
+#include "../inc/glyph_cache.h"
+#include "../inc/utf8.h"
+
+#define TRUE   1
+#define FALSE  0
+
+#define CAT_FILE_MAX    (64*1024)
+#define CAT_RUN_CHARS   2048        // laid out chars of all strings, per font
+
+///////////////////////////////////
+/*  Built in strings             */
+///////////////////////////////////
+// names of the strings in lang.ini, in str_id order
+static const char* const keys[]=
+{
+  "exit","set_time","accept","cancel","move","month","year","begin",
+  "set_alarm","edit","new","on_off","delete","stop","snooze","start",
+  "pause","lap","reset","mode","saving_rtc","rtc_not_saved","analog","digital",
+  "no_alarms","next_alarm","alarm","once","snooze_min","no_snooze",
+  "stopwatch","timer","time_up","lap_title",
+  "world_clock",
+  "sun","mon","tue","wed","thu","fri","sat",
+  "january","february","march","april","may","june","july","august",
+  "september","october","november","december"
+};
+
+static const char* const text_en[]=
+{
+  " exit"," set time"," accept"," cancel"," move"," month"," year"," begin",
+  " set alarm"," edit"," new"," on/off"," delete"," stop"," snooze"," start",
+  " pause"," lap"," reset"," mode"," saving RTC"," RTC not saved"," analog"," digital",
+  "NO ALARMS","NEXT","ALARM","ONCE","SNOOZE %d MIN","NO SNOOZE",
+  "STOPWATCH","TIMER","TIME UP","LAP",
+  "WORLD CLOCK",
+  "Sun","Mon","Tue","Wed","Thu","Fri","Sat",
+  "JANUARY","FEBRUARY","MARCH","APRIL","MAY","JUNE","JULY","AUGUST",
+  "SEPTEMBER","OCTOBER","NOVEMBER","DECEMBER"
+};
+
+static const char* const text_es[]=
+{
+  " salir"," ajustar"," aceptar"," cancelar"," mover"," mes"," año"," inicio",
+  " alarma"," editar"," nueva"," on/off"," borrar"," parar"," posponer"," iniciar",
+  " pausa"," vuelta"," reiniciar"," modo"," guardando RTC"," RTC no guardado"," analógico"," digital",
+  "SIN ALARMAS","PRÓXIMA","ALARMA","UNA VEZ","POSPONER %d MIN","SIN POSPONER",
+  "CRONÓMETRO","TEMPORIZADOR","TIEMPO","VUELTA",
+  "RELOJ MUNDIAL",
+  "Dom","Lun","Mar","Mié","Jue","Vie","Sáb",
+  "ENERO","FEBRERO","MARZO","ABRIL","MAYO","JUNIO","JULIO","AGOSTO",
+  "SEPTIEMBRE","OCTUBRE","NOVIEMBRE","DICIEMBRE"
+};
+
+static_assert(sizeof(keys)/sizeof(keys[0])==STR_COUNT,"catalog keys");
+static_assert(sizeof(text_en)/sizeof(text_en[0])==STR_COUNT,"english strings");
+static_assert(sizeof(text_es)/sizeof(text_es[0])==STR_COUNT,"spanish strings");
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+struct language
+{
+  char code[8];
+  const char* str[STR_COUNT];
+};
+
+static language langs[CAT_MAX_LANGS];
+static int langs_n=0;
+static int current=0;
+static char* file_text=NULL;        // strings of lang.ini point in it
+static text_font* fonts[CAT_FONTS];
+static text_run runs[CAT_FONTS][STR_COUNT];
+static Uint16 run_ch[CAT_FONTS][CAT_RUN_CHARS];
+static Sint16 run_x[CAT_FONTS][CAT_RUN_CHARS];
+static int pool_warned=FALSE;        // said once
+
+///////////////////////////////////
+/*  Runs                         */
+///////////////////////////////////
+static int count_chars(const char* s)
+{
+  int n=0;
+  while(utf8_next(&s))
+    n++;
+  return n;
+}
+
+// every string decoded and laid out once, strings that don't fit in
+// the pool are only measured and drawn as text
+static void measure(int slot)
+{
+  int used=0;
+  for(int i=0; i<STR_COUNT; i++)
+  {
+    text_run* r=&runs[slot][i];
+    const char* s=langs[current].str[i];
+    r->ch=&run_ch[slot][used];
+    r->x=&run_x[slot][used];
+    r->n=r->width=0;
+    if(!fonts[slot])
+      continue;
+    if(count_chars(s)>CAT_RUN_CHARS-used)
+    {
+      if(!pool_warned)
+        fprintf(stderr,"lang %s: more than %d chars in all, %s and others drawn as text\n",
+                langs[current].code,CAT_RUN_CHARS,keys[i]);
+      pool_warned=TRUE;
+      r->ch=NULL;
+      r->x=NULL;
+      r->width=glyphcache_width(fonts[slot],s);
+      continue;
+    }
+    used+=glyphcache_layout(fonts[slot],s,r,CAT_RUN_CHARS-used);
+  }
+}
+
+// chars of every language the font lacks, once at startup
+static void check_glyphs(int slot)
+{
+  for(int l=0; l<langs_n; l++)
+    for(int i=0; i<STR_COUNT; i++)
+    {
+      if(l>0 && langs[l].str[i]==text_en[i])
+        continue;
+      const char* p=langs[l].str[i];
+      Uint16 ch;
+      while((ch=utf8_next(&p))!=0)
+        if(!glyphcache_has_glyph(fonts[slot],ch))
+          fprintf(stderr,"lang %s: %s has U+%04X, not in font\n",langs[l].code,keys[i],ch);
+    }
+}
+
+///////////////////////////////////
+/*  Languages                    */
+///////////////////////////////////
+static language* add_language(const char* code, const char* const* text)
+{
+  if(langs_n>=CAT_MAX_LANGS)
+    return NULL;
+  language* l=&langs[langs_n++];
+  snprintf(l->code,8,"%s",code);
+  for(int i=0; i<STR_COUNT; i++)
+    l->str[i]=text[i];
+  return l;
+}
+
+void catalog_init()
+{
+  langs_n=0;
+  add_language("en",text_en);
+  add_language("es",text_es);
+  catalog_set(0);
+}
+
+// "%d" only where english has it, texts are given to printf
+static int same_format(const char* a, const char* b)
+{
+  for(;;)
+  {
+    a=strchr(a,'%');
+    b=strchr(b,'%');
+    if(!a || !b)
+      return a==b;
+    if(a[1]!=b[1])
+      return FALSE;
+    a+=2;
+    b+=2;
+  }
+}
+
+int catalog_load(const char* path)
+{
+  FILE* file=fopen(path,"rb");
+  if(file==NULL)
+    return FALSE;
+
+  // whole file, kept for the strings
+  long len=0;
+  if(fseek(file,0,SEEK_END)==0)
+    len=ftell(file);
+  if(len<=0 || len>CAT_FILE_MAX || fseek(file,0,SEEK_SET)!=0 ||
+     (file_text=(char*)malloc(len+1))==NULL || fread(file_text,1,len,file)!=(size_t)len)
+  {
+    fclose(file);
+    free(file_text);
+    file_text=NULL;
+    return FALSE;
+  }
+  fclose(file);
+  file_text[len]=0;
+
+  language* l=NULL;
+  char* line=file_text;
+  while(line)
+  {
+    char* next=strchr(line,'\n');
+    if(next)
+      *next++=0;
+    char* end=line+strlen(line);
+    if(end>line && end[-1]=='\r')
+      *--end=0;
+
+    char* eq=strchr(line,'=');
+    if(line[0]=='[' && end>line+1 && end[-1]==']')
+    {
+      // new language, english until it says otherwise
+      end[-1]=0;
+      l=add_language(line+1,text_en);
+    }
+    else if(l && eq && line[0]!='#')
+    {
+      *eq=0;
+      for(int i=0; i<STR_COUNT; i++)
+        if(strcmp(line,keys[i])==0 && same_format(eq+1,text_en[i]))
+          l->str[i]=eq+1;
+    }
+    line=next;
+  }
+  return TRUE;
+}
+
+void catalog_free()
+{
+  free(file_text);
+  file_text=NULL;
+  langs_n=0;
+}
+
+int catalog_count()
+{
+  return langs_n;
+}
+
+void catalog_set(int lang)
+{
+  current=(lang>=0 && lang<langs_n)?lang:0;
+  for(int s=0; s<CAT_FONTS; s++)
+    measure(s);
+}
+
+const char* catalog_code()
+{
+  return langs[current].code;
+}
+
+void catalog_font(int slot, text_font* f)
+{
+  fonts[slot]=f;
+  if(f)
+    check_glyphs(slot);
+  measure(slot);
+}
+
+///////////////////////////////////
+/*  Strings                      */
+///////////////////////////////////
+const char* catalog_str(int id)
+{
+  return langs[current].str[id];
+}
+
+const char* const* catalog_table(int id)
+{
+  return &langs[current].str[id];
+}
+
+int catalog_width(int id, int slot)
+{
+  return runs[slot][id].width;
+}
+
+const text_run* catalog_run(int id, int slot)
+{
+  const text_run* r=&runs[slot][id];
+  return r->ch?r:NULL;
+}
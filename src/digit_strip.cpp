@@ -0,0 +1,211 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Digit sprite strips                       */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <string.h>
+#include "../inc/digit_strip.h"
+#include "../inc/render.h"
+
+#define DIGITSTRIP_MAX    4
+#define DIGITSTRIP_CHARS  11    // 0-9 and ':'
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct digit_strip
+{
+  text_font* font;
+  Uint32 colour;
+  SDL_Surface* surface;
+  SDL_Rect rect[DIGITSTRIP_CHARS];      // glyph pixels in the strip
+  int dx[DIGITSTRIP_CHARS];             // glyph x from the pen
+  int dy[DIGITSTRIP_CHARS];             // glyph y from the top of the line
+  int advance[DIGITSTRIP_CHARS];
+};
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static digit_strip* strips[DIGITSTRIP_MAX];
+static int strips_next=0;
+
+static const char strip_chars[DIGITSTRIP_CHARS+1]="0123456789:";
+
+static int char_index(char ch)
+{
+  if(ch>='0' && ch<='9')
+    return ch-'0';
+  if(ch==':')
+    return 10;
+  return -1;
+}
+
+///////////////////////////////////
+/*  Render the 11 glyphs         */
+///////////////////////////////////
+static int build_strip(digit_strip* ds)
+{
+  text_font* f=ds->font;
+  SDL_Color c={(Uint8)(ds->colour>>16),(Uint8)(ds->colour>>8),(Uint8)ds->colour,0};
+  SDL_Surface* glyph[DIGITSTRIP_CHARS];
+  int minx[DIGITSTRIP_CHARS];
+  int maxy[DIGITSTRIP_CHARS];
+  int ascent=font_ascent(f);
+  int digit_advance=0;
+  int w=0, h=1;
+
+  for(int i=0; i<DIGITSTRIP_CHARS; i++)
+  {
+    int maxx=0, miny=0;
+    minx[i]=0;
+    maxy[i]=0;
+    ds->advance[i]=0;
+    font_glyph_metrics(f,strip_chars[i],&minx[i],&maxx,&miny,&maxy[i],&ds->advance[i]);
+    if(i<10 && ds->advance[i]>digit_advance)
+      digit_advance=ds->advance[i];
+
+    glyph[i]=font_render_glyph(f,strip_chars[i],c);
+    if(glyph[i])
+    {
+      w+=glyph[i]->w+1;
+      if(glyph[i]->h>h)
+        h=glyph[i]->h;
+    }
+  }
+
+  SDL_Surface* tmp=SDL_CreateRGBSurface(SDL_SWSURFACE,w>0?w:1,h,32,0x00ff0000,0x0000ff00,0x000000ff,0xff000000);
+  if(tmp)
+    SDL_FillRect(tmp,NULL,0);
+
+  // side by side, one pixel apart so no filtering bleeds between them
+  int x=0;
+  for(int i=0; i<DIGITSTRIP_CHARS; i++)
+  {
+    int centre=0;
+    if(i<10)
+    {
+      centre=(digit_advance-ds->advance[i])/2;
+      ds->advance[i]=digit_advance;
+    }
+    ds->dx[i]=centre+minx[i];
+    ds->dy[i]=ascent-maxy[i];
+    ds->rect[i].x=x;
+    ds->rect[i].y=0;
+    ds->rect[i].w=0;
+    ds->rect[i].h=0;
+    if(glyph[i])
+    {
+      ds->rect[i].w=glyph[i]->w;
+      ds->rect[i].h=glyph[i]->h;
+      if(tmp)
+      {
+        SDL_Rect dest=ds->rect[i];
+        SDL_SetAlpha(glyph[i],0,SDL_ALPHA_OPAQUE);      // copy RGBA as is
+        SDL_BlitSurface(glyph[i],NULL,tmp,&dest);
+      }
+      x+=glyph[i]->w+1;
+      SDL_FreeSurface(glyph[i]);
+    }
+  }
+
+  if(!tmp)
+    return 0;
+  ds->surface=SDL_DisplayFormatAlpha(tmp);
+  SDL_FreeSurface(tmp);
+  return ds->surface!=NULL;
+}
+
+///////////////////////////////////
+/*  Find or create strip         */
+///////////////////////////////////
+digit_strip* digitstrip_get(text_font* f, SDL_Color c)
+{
+  if(!f)
+    return NULL;
+
+  Uint32 colour=(c.r<<16)|(c.g<<8)|c.b;
+  for(int i=0; i<DIGITSTRIP_MAX; i++)
+    if(strips[i] && strips[i]->font==f && strips[i]->colour==colour)
+      return strips[i]->surface?strips[i]:NULL;
+
+  int slot=strips_next;
+  strips_next=(strips_next+1)%DIGITSTRIP_MAX;
+  if(strips[slot])
+  {
+    if(strips[slot]->surface)
+      SDL_FreeSurface(strips[slot]->surface);
+    delete strips[slot];
+  }
+
+  // failed strips are kept too, so they are not rebuilt every frame
+  digit_strip* ds=new digit_strip;
+  memset(ds,0,sizeof(digit_strip));
+  ds->font=f;
+  ds->colour=colour;
+  strips[slot]=ds;
+  if(!build_strip(ds))
+    return NULL;
+  return ds;
+}
+
+///////////////////////////////////
+/*  Draw                         */
+///////////////////////////////////
+int digitstrip_draw(digit_strip* ds, const char* string, int x, int y)
+{
+  if(!ds || !ds->surface)
+    return 0;
+  for(const char* p=string; *p; p++)
+    if(char_index(*p)<0)
+      return 0;
+
+  // like TTF_RenderText, first glyph is never cut on the left
+  int pen=x;
+  if(*string && ds->dx[char_index(*string)]<0)
+    pen-=ds->dx[char_index(*string)];
+
+  for(const char* p=string; *p; p++)
+  {
+    int i=char_index(*p);
+    if(ds->rect[i].w>0)
+      render_blit(ds->surface,&ds->rect[i],pen+ds->dx[i],y+ds->dy[i]);
+    pen+=ds->advance[i];
+  }
+  return 1;
+}
+
+int digitstrip_width(digit_strip* ds, const char* string)
+{
+  int w=0;
+  if(!ds)
+    return 0;
+  for(const char* p=string; *p; p++)
+  {
+    int i=char_index(*p);
+    if(i<0)
+      return 0;
+    w+=ds->advance[i];
+  }
+  return w;
+}
+
+///////////////////////////////////
+/*  Free all strips              */
+///////////////////////////////////
+void digitstrip_free()
+{
+  for(int i=0; i<DIGITSTRIP_MAX; i++)
+  {
+    if(strips[i])
+    {
+      if(strips[i]->surface)
+        SDL_FreeSurface(strips[i]->surface);
+      delete strips[i];
+      strips[i]=NULL;
+    }
+  }
+  strips_next=0;
+}
@@ -0,0 +1,536 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Glyph atlas cache                         */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <string.h>
+#include <stdlib.h>
+#include "../inc/glyph_cache.h"
+#include "../inc/blend.h"
+#include "../inc/utf8.h"
+
+#ifdef BITMAP_FONTS
+
+///////////////////////////////////
+/*  Baked fonts                  */
+///////////////////////////////////
+// glyphs are already rasterized at build time, they are blended
+// straight into the surface and there is nothing to cache
+
+static Uint32 cache_hits=0;
+
+int glyphcache_draw(SDL_Surface* dst, text_font* f, const char* string, int x, int y, SDL_Color c)
+{
+  if(!dst || !f || !string)
+    return 0;
+  cache_hits+=strlen(string);
+  return bfont_draw(dst,f,string,x,y,c);
+}
+
+int glyphcache_width(text_font* f, const char* string)
+{
+  return bfont_width(f,string);
+}
+
+int glyphcache_layout(text_font* f, const char* string, text_run* run, int max)
+{
+  run->width=bfont_layout(f,string,run->ch,run->x,max,&run->n);
+  return run->n;
+}
+
+void glyphcache_draw_run(SDL_Surface* dst, text_font* f, const text_run* run, int x, int y, SDL_Color c)
+{
+  cache_hits+=run->n;
+  bfont_draw_chars(dst,f,run->ch,run->x,run->n,x,y,c);
+}
+
+int glyphcache_has_glyph(text_font* f, Uint16 ch)
+{
+  return bfont_has_glyph(f,ch);
+}
+
+int glyphcache_height(text_font* f)
+{
+  if(!f)
+    return 0;
+  return f->height;
+}
+
+void glyphcache_stats(Uint32* hits, Uint32* misses)
+{
+  if(hits)
+    *hits=cache_hits;
+  if(misses)
+    *misses=0;
+}
+
+void glyphcache_free()
+{
+}
+
+#else
+
+#define GLYPHCACHE_FONTS      8
+#define GLYPHCACHE_PAGE       256       // chars in a page of glyphs
+#define GLYPHCACHE_PAGES      256       // pages for the whole UCS-2 range
+#define GLYPHCACHE_KERN_CHARS 256       // Latin-1 pairs in a table
+#define GLYPHCACHE_KERN_EXT   256       // other pairs, hashed
+#define GLYPHCACHE_ATLAS_W    256
+#define GLYPHCACHE_ATLAS_MAXH 2048
+#define GLYPHCACHE_KERN_UNK   -128
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct glyph_entry
+{
+  Sint16 minx;
+  Sint16 maxx;
+  Sint16 maxy;
+  Sint16 advance;
+  SDL_Rect rect;      // in the atlas
+  Uint8 loaded;       // metrics
+  Uint8 cached;       // rect
+};
+
+// glyphs of 256 chars, allocated when one of them is first used, so
+// Latin-1 texts take one page and other scripts only what they use
+struct glyph_page
+{
+  glyph_entry glyph[GLYPHCACHE_PAGE];
+};
+
+// coverage of every glyph, 8 bit, for any colour
+struct glyph_atlas
+{
+  Uint8* mask;        // GLYPHCACHE_ATLAS_W bytes a row
+  int h;
+  int pen_x;
+  int pen_y;
+  int row_h;
+};
+
+struct kern_pair
+{
+  Uint32 key;         // left<<16|right, 0 if empty
+  Sint8 delta;
+};
+
+struct font_entry
+{
+  TTF_Font* font;
+  int ascent;
+  int height;
+  int kerning;
+  glyph_page* page[GLYPHCACHE_PAGES];
+  Sint8* kern;        // 256x256 Latin-1 pair table, allocated on first use
+  kern_pair kern_ext[GLYPHCACHE_KERN_EXT];
+  glyph_atlas atlas;
+};
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static font_entry* cache_fonts[GLYPHCACHE_FONTS];
+static int cache_nextfont=0;
+static Uint32 cache_hits=0;
+static Uint32 cache_misses=0;
+
+///////////////////////////////////
+/*  Free one font entry          */
+///////////////////////////////////
+static void free_font(font_entry* fe)
+{
+  if(fe->atlas.mask)
+    free(fe->atlas.mask);
+  if(fe->kern)
+    free(fe->kern);
+  for(int i=0; i<GLYPHCACHE_PAGES; i++)
+    if(fe->page[i])
+      free(fe->page[i]);
+  delete fe;
+}
+
+///////////////////////////////////
+/*  Find or add font entry       */
+///////////////////////////////////
+static font_entry* find_font(TTF_Font* f)
+{
+  for(int i=0; i<GLYPHCACHE_FONTS; i++)
+    if(cache_fonts[i] && cache_fonts[i]->font==f)
+      return cache_fonts[i];
+
+  // not found, take next slot (round robin)
+  int slot=cache_nextfont;
+  cache_nextfont=(cache_nextfont+1)%GLYPHCACHE_FONTS;
+  if(cache_fonts[slot])
+    free_font(cache_fonts[slot]);
+
+  font_entry* fe=new font_entry;
+  memset(fe,0,sizeof(font_entry));
+  fe->font=f;
+  fe->ascent=TTF_FontAscent(f);
+  fe->height=TTF_FontHeight(f);
+  fe->kerning=TTF_GetFontKerning(f);
+  cache_misses+=3;
+  cache_fonts[slot]=fe;
+  return fe;
+}
+
+///////////////////////////////////
+/*  Glyph entry                  */
+///////////////////////////////////
+// a page that can't be allocated leaves the char without glyph
+static glyph_entry* get_entry(font_entry* fe, Uint16 ch)
+{
+  static glyph_entry none;
+  glyph_page** pg=&fe->page[ch/GLYPHCACHE_PAGE];
+  if(!*pg)
+  {
+    *pg=(glyph_page*)calloc(1,sizeof(glyph_page));
+    if(!*pg)
+    {
+      memset(&none,0,sizeof(none));
+      none.loaded=none.cached=1;
+      return &none;
+    }
+  }
+  return &(*pg)->glyph[ch%GLYPHCACHE_PAGE];
+}
+
+///////////////////////////////////
+/*  Glyph metrics                */
+///////////////////////////////////
+static glyph_entry* get_metrics(font_entry* fe, Uint16 ch)
+{
+  glyph_entry* ge=get_entry(fe,ch);
+  if(!ge->loaded)
+  {
+    int minx=0,maxx=0,miny=0,maxy=0,advance=0;
+    TTF_GlyphMetrics(fe->font,ch,&minx,&maxx,&miny,&maxy,&advance);
+    cache_misses++;
+    ge->minx=minx;
+    ge->maxx=maxx;
+    ge->maxy=maxy;
+    ge->advance=advance;
+    ge->loaded=1;
+  }
+  else
+    cache_hits++;
+  return ge;
+}
+
+///////////////////////////////////
+/*  Kerning of a pair            */
+///////////////////////////////////
+// SDL_ttf only takes kerning by glyph index, so measure the pair with
+// TTF_SizeUNICODE once and subtract the width without kerning
+static int measure_kerning(font_entry* fe, Uint16 a, Uint16 b)
+{
+  glyph_entry* ga=get_metrics(fe,a);
+  glyph_entry* gb=get_metrics(fe,b);
+  Uint16 pair[3]={a,b,0};
+  int w=0,h=0;
+  TTF_SizeUNICODE(fe->font,pair,&w,&h);
+  cache_misses++;
+
+  int minx=0, maxx=0;
+  if(ga->minx<minx)
+    minx=ga->minx;
+  if(ga->advance+gb->minx<minx)
+    minx=ga->advance+gb->minx;
+  maxx=(ga->advance>ga->maxx?ga->advance:ga->maxx);
+  if(ga->advance+(gb->advance>gb->maxx?gb->advance:gb->maxx)>maxx)
+    maxx=ga->advance+(gb->advance>gb->maxx?gb->advance:gb->maxx);
+
+  int d=w-(maxx-minx);
+  if(d<-127)
+    d=-127;
+  if(d>127)
+    d=127;
+  return d;
+}
+
+// Latin-1 pairs in a full table, others in a small hashed one where a
+// new pair takes the place of the old
+static int get_kerning(font_entry* fe, Uint16 a, Uint16 b)
+{
+  if(!fe->kerning)
+    return 0;
+
+  if(a>=GLYPHCACHE_KERN_CHARS || b>=GLYPHCACHE_KERN_CHARS)
+  {
+    Uint32 key=((Uint32)a<<16)|b;
+    kern_pair* kp=&fe->kern_ext[(key*2654435761u)>>24];
+    if(kp->key!=key)
+    {
+      kp->key=key;
+      kp->delta=(Sint8)measure_kerning(fe,a,b);
+    }
+    return kp->delta;
+  }
+
+  if(!fe->kern)
+  {
+    fe->kern=(Sint8*)malloc(GLYPHCACHE_KERN_CHARS*GLYPHCACHE_KERN_CHARS);
+    if(!fe->kern)
+      return 0;
+    memset(fe->kern,GLYPHCACHE_KERN_UNK,GLYPHCACHE_KERN_CHARS*GLYPHCACHE_KERN_CHARS);
+  }
+
+  Sint8* k=&fe->kern[(a<<8)|b];
+  if(*k==GLYPHCACHE_KERN_UNK)
+    *k=(Sint8)measure_kerning(fe,a,b);
+  return *k;
+}
+
+///////////////////////////////////
+/*  Atlas rows                   */
+///////////////////////////////////
+// room for more rows below pen_y, doubling the height
+static int atlas_reserve(glyph_atlas* at, int rows)
+{
+  int h=at->h?at->h:64;
+  while(at->pen_y+rows>h)
+  {
+    if(h>=GLYPHCACHE_ATLAS_MAXH)
+      return 0;
+    h*=2;
+  }
+  if(h==at->h)
+    return 1;
+
+  Uint8* m=(Uint8*)realloc(at->mask,GLYPHCACHE_ATLAS_W*h);
+  if(!m)
+    return 0;
+  memset(m+GLYPHCACHE_ATLAS_W*at->h,0,GLYPHCACHE_ATLAS_W*(h-at->h));
+  at->mask=m;
+  at->h=h;
+  return 1;
+}
+
+///////////////////////////////////
+/*  Rasterize glyph into atlas   */
+///////////////////////////////////
+// only the alpha of the blended glyph is kept
+static SDL_Rect* get_glyph(font_entry* fe, Uint16 ch)
+{
+  glyph_atlas* at=&fe->atlas;
+  glyph_entry* ge=get_entry(fe,ch);
+  SDL_Rect* r=&ge->rect;
+  if(ge->cached)
+  {
+    cache_hits++;
+    return r;
+  }
+
+  ge->cached=1;
+  SDL_Color white={255,255,255,0};
+  SDL_Surface* g=TTF_RenderGlyph_Blended(fe->font,ch,white);
+  cache_misses++;
+  if(!g)
+    return r;
+  if(g->w>GLYPHCACHE_ATLAS_W || g->format->BytesPerPixel!=4)
+  {
+    SDL_FreeSurface(g);
+    return r;
+  }
+
+  // next row?
+  if(at->pen_x+g->w>GLYPHCACHE_ATLAS_W)
+  {
+    at->pen_x=0;
+    at->pen_y+=at->row_h+1;
+    at->row_h=0;
+  }
+  if(!atlas_reserve(at,g->h) || (SDL_MUSTLOCK(g) && SDL_LockSurface(g)<0))
+  {
+    SDL_FreeSurface(g);
+    return r;
+  }
+
+  r->x=at->pen_x;
+  r->y=at->pen_y;
+  r->w=g->w;
+  r->h=g->h;
+  Uint32 amask=g->format->Amask;
+  int ashift=g->format->Ashift;
+  for(int y=0; y<g->h; y++)
+  {
+    const Uint32* src=(const Uint32*)((Uint8*)g->pixels+y*g->pitch);
+    Uint8* m=at->mask+(r->y+y)*GLYPHCACHE_ATLAS_W+r->x;
+    for(int x=0; x<g->w; x++)
+      m[x]=(Uint8)((src[x]&amask)>>ashift);
+  }
+  if(SDL_MUSTLOCK(g))
+    SDL_UnlockSurface(g);
+  SDL_FreeSurface(g);
+
+  at->pen_x+=r->w+1;
+  if(r->h>at->row_h)
+    at->row_h=r->h;
+  return r;
+}
+
+// ge: metrics of ch, x at the pen
+static void blend_glyph(SDL_Surface* dst, font_entry* fe, glyph_entry* ge, Uint16 ch, int x, int y, SDL_Color c)
+{
+  SDL_Rect* r=get_glyph(fe,ch);
+  if(r->w && r->h)
+  {
+    const Uint8* mask=fe->atlas.mask+r->y*GLYPHCACHE_ATLAS_W+r->x;
+    blend_a8(dst,x+ge->minx,y+fe->ascent-ge->maxy,mask,GLYPHCACHE_ATLAS_W,r->w,r->h,c);
+  }
+}
+
+///////////////////////////////////
+/*  Draw string                  */
+///////////////////////////////////
+int glyphcache_draw(SDL_Surface* dst, text_font* f, const char* string, int x, int y, SDL_Color c)
+{
+  if(!dst || !f || !string)
+    return 0;
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return 0;
+
+  font_entry* fe=find_font(f);
+  int pen=0;
+  const char* p=string;
+  Uint16 ch, prev=0;
+  while((ch=utf8_next(&p))!=0)
+  {
+    glyph_entry* ge=get_metrics(fe,ch);
+    if(prev)
+      pen+=get_kerning(fe,prev,ch);
+    else if(ge->minx<0)
+      pen-=ge->minx;    // same start offset as TTF_RenderText
+    blend_glyph(dst,fe,ge,ch,x+pen,y,c);
+    pen+=ge->advance;
+    prev=ch;
+  }
+
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+  return pen;
+}
+
+///////////////////////////////////
+/*  Laid out runs                */
+///////////////////////////////////
+// pens as glyphcache_draw moves them, the width as TTF_SizeText;
+// run->ch may be NULL to get only the width
+static void layout(font_entry* fe, const char* string, text_run* run, int max)
+{
+  int x=0, start=0, minx=0, maxx=0, z;
+  const char* p=string;
+  Uint16 ch, prev=0;
+  run->n=0;
+  while((ch=utf8_next(&p))!=0)
+  {
+    glyph_entry* ge=get_metrics(fe,ch);
+    if(prev)
+      x+=get_kerning(fe,prev,ch);
+    else if(ge->minx<0)
+      start=-ge->minx;
+    z=x+ge->minx;
+    if(minx>z)
+      minx=z;
+    z=x+(ge->advance>ge->maxx?ge->advance:ge->maxx);
+    if(maxx<z)
+      maxx=z;
+    if(run->ch && run->n<max)
+    {
+      run->ch[run->n]=ch;
+      run->x[run->n]=(Sint16)(start+x);
+      run->n++;
+    }
+    x+=ge->advance;
+    prev=ch;
+  }
+  run->width=maxx-minx;
+}
+
+int glyphcache_layout(text_font* f, const char* string, text_run* run, int max)
+{
+  run->n=run->width=0;
+  if(!f || !string)
+    return 0;
+  layout(find_font(f),string,run,max);
+  return run->n;
+}
+
+void glyphcache_draw_run(SDL_Surface* dst, text_font* f, const text_run* run, int x, int y, SDL_Color c)
+{
+  if(!dst || !f || run->n<=0)
+    return;
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return;
+
+  font_entry* fe=find_font(f);
+  for(int i=0; i<run->n; i++)
+    blend_glyph(dst,fe,get_metrics(fe,run->ch[i]),run->ch[i],x+run->x[i],y,c);
+
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+}
+
+///////////////////////////////////
+/*  String width                 */
+///////////////////////////////////
+int glyphcache_width(text_font* f, const char* string)
+{
+  if(!f || !string)
+    return 0;
+
+  text_run run={NULL,NULL,0,0};
+  layout(find_font(f),string,&run,0);
+  return run.width;
+}
+
+///////////////////////////////////
+/*  Font height                  */
+///////////////////////////////////
+int glyphcache_height(text_font* f)
+{
+  if(!f)
+    return 0;
+  return find_font(f)->height;
+}
+
+///////////////////////////////////
+/*  Glyph coverage               */
+///////////////////////////////////
+int glyphcache_has_glyph(text_font* f, Uint16 ch)
+{
+  if(!f)
+    return 0;
+  return TTF_GlyphIsProvided(f,ch)!=0;
+}
+
+///////////////////////////////////
+/*  Stats                        */
+///////////////////////////////////
+void glyphcache_stats(Uint32* hits, Uint32* misses)
+{
+  if(hits)
+    *hits=cache_hits;
+  if(misses)
+    *misses=cache_misses;
+}
+
+///////////////////////////////////
+/*  Free all                     */
+///////////////////////////////////
+void glyphcache_free()
+{
+  for(int f=0; f<GLYPHCACHE_FONTS; f++)
+  {
+    if(cache_fonts[f])
+      free_font(cache_fonts[f]);
+    cache_fonts[f]=NULL;
+  }
+}
+
+#endif
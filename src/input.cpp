@@ -0,0 +1,316 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Input                                     */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../inc/input.h"
+#include "../inc/latency.h"
+#include "../inc/profiler.h"
+#include "../inc/scheduler.h"
+
+#define TRUE   1
+#define FALSE  0
+
+#define INPUT_MS    1000000LL     // ns
+#define INPUT_STAMP_MS  1000      // older kernel times are another press
+
+///////////////////////////////////
+/*  Default keymap               */
+///////////////////////////////////
+struct key_button
+{
+  const char* name;
+  int key;
+  Uint32 buttons;
+};
+
+static const key_button default_keys[]=
+{
+  {"Up",GCW_BUTTON_UP,BTN_UP},
+  {"Down",GCW_BUTTON_DOWN,BTN_DOWN},
+  {"Left",GCW_BUTTON_LEFT,BTN_LEFT},
+  {"Right",GCW_BUTTON_RIGHT,BTN_RIGHT},
+  {"A",GCW_BUTTON_A,BTN_A},
+  {"B",GCW_BUTTON_B,BTN_B},
+  {"X",GCW_BUTTON_X,BTN_X},
+  {"Y",GCW_BUTTON_Y,BTN_Y},
+  {"L1",GCW_BUTTON_L1,BTN_L1},
+  {"R1",GCW_BUTTON_R1,BTN_R1},
+  {"L2",GCW_BUTTON_L2,BTN_L2},
+  {"R2",GCW_BUTTON_R2,BTN_R2},
+  {"L3",GCW_BUTTON_L3,BTN_L3},
+  {"R3",GCW_BUTTON_R3,BTN_R3},
+  {"Select",GCW_BUTTON_SELECT,BTN_SELECT},
+  {"Start",GCW_BUTTON_START,BTN_START},
+  {"Power",GCW_BUTTON_POWER,BTN_POWER},
+  // volume up and down can't be told apart
+  {"Volume",GCW_BUTTON_VOLUP,BTN_VOLUP|BTN_VOLDOWN},
+#ifdef GCW_BUTTON_MENU
+  {"Menu",GCW_BUTTON_MENU,BTN_MENU},
+#endif
+};
+
+#define DEFAULT_KEYS  (int)(sizeof(default_keys)/sizeof(key_button))
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static Uint32 keymap[SDLK_LAST];    // buttons of each key
+static Uint32 keys_down=0;          // keys, from events
+static Uint32 axes_down=0;          // sticks past the dead zone
+static Uint32 held=0;
+static Uint32 pressed=0;
+static Uint32 released=0;
+static Sint64 press_time=0;
+static Sint64 press_times[BTN_COUNT];   // ns of each press this frame
+static Sint16 axis[4];
+
+// repeat of each button
+static Sint64 repeat_next[BTN_COUNT];
+static int repeat_count[BTN_COUNT];
+static Uint8 steps[BTN_COUNT];
+
+static Sint64 now_ns()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (Sint64)ts.tv_sec*1000*INPUT_MS+ts.tv_nsec;
+}
+
+///////////////////////////////////
+/*  Keymap                       */
+///////////////////////////////////
+static void map_key(int key, Uint32 buttons)
+{
+  // unused codes are 0 or out of the SDL range
+  if(key>0 && key<SDLK_LAST)
+    keymap[key]|=buttons;
+}
+
+void input_init()
+{
+  memset(keymap,0,sizeof(keymap));
+  for(int i=0; i<DEFAULT_KEYS; i++)
+    map_key(default_keys[i].key,default_keys[i].buttons);
+  keys_down=axes_down=held=pressed=released=0;
+  memset(axis,0,sizeof(axis));
+}
+
+int input_load_keymap(const char* path)
+{
+  FILE* file=fopen(path,"r");
+  if(file==NULL)
+    return FALSE;
+
+  char str[50];
+  char var[50];
+  int key;
+  while(fgets(str,50,file)!=NULL)
+  {
+    if(sscanf(str,"%49s %d",var,&key)!=2)
+      continue;
+    for(int i=0; i<DEFAULT_KEYS; i++)
+    {
+      if(strcmp(var,default_keys[i].name)==0)
+      {
+        // button moves to the new key
+        for(int k=0; k<SDLK_LAST; k++)
+          keymap[k]&=~default_keys[i].buttons;
+        map_key(key,default_keys[i].buttons);
+      }
+    }
+  }
+  fclose(file);
+  return TRUE;
+}
+
+///////////////////////////////////
+/*  Sticks                       */
+///////////////////////////////////
+// axis 0/1 left stick, 2/3 right stick
+static void set_axis(int a, Sint16 value)
+{
+  static const Uint32 negative[4]={BTN_J1_LEFT,BTN_J1_UP,BTN_J2_LEFT,BTN_J2_UP};
+  static const Uint32 positive[4]={BTN_J1_RIGHT,BTN_J1_DOWN,BTN_J2_RIGHT,BTN_J2_DOWN};
+
+  axis[a]=value;
+  axes_down&=~(negative[a]|positive[a]);
+  if(value<-GCW_JOYSTICK_DEADZONE)
+    axes_down|=negative[a];
+  else if(value>GCW_JOYSTICK_DEADZONE)
+    axes_down|=positive[a];
+}
+
+///////////////////////////////////
+/*  Key repeat                   */
+///////////////////////////////////
+static void update_repeat(Sint64 now)
+{
+  for(int b=0; b<BTN_COUNT; b++)
+  {
+    Uint32 bit=1<<b;
+    steps[b]=0;
+    if(!(bit&BTN_REPEAT))
+      continue;
+    if(pressed&bit)
+    {
+      steps[b]=1;
+      repeat_next[b]=(press_times[b]?press_times[b]:now)+INPUT_REPEAT_DELAY*INPUT_MS;
+      repeat_count[b]=0;
+    }
+    if(!(held&bit))
+      continue;
+
+    // every repeat due since last frame, whatever the frame rate
+    while(now>=repeat_next[b] && steps[b]<INPUT_REPEAT_FRAME)
+    {
+      int interval=INPUT_REPEAT_START-repeat_count[b]*INPUT_REPEAT_STEP;
+      if(interval<INPUT_REPEAT_MIN)
+        interval=INPUT_REPEAT_MIN;
+      repeat_next[b]+=interval*INPUT_MS;
+      repeat_count[b]++;
+      steps[b]++;
+    }
+    if(now>=repeat_next[b])
+      repeat_next[b]=now;     // frames too slow, don't pile up
+
+    Sint64 wait=(repeat_next[b]-now)/INPUT_MS+1;
+    sched_request((Uint32)wait);
+  }
+}
+
+///////////////////////////////////
+/*  Read events                  */
+///////////////////////////////////
+// first time each of buttons went down this frame
+static void stamp(Uint32 buttons, Sint64 t)
+{
+  for(int b=0; b<BTN_COUNT; b++)
+    if((buttons&(1<<b)) && !press_times[b])
+      press_times[b]=t;
+}
+
+// time the kernel read the key if it's this press, else when SDL gave it
+static Sint64 key_time(int scancode, Sint64 polled)
+{
+  Sint64 t=sched_key_press(scancode);
+  if(t>0 && t<=polled && polled-t<INPUT_STAMP_MS*INPUT_MS)
+    return t;
+  return polled;
+}
+
+void input_update()
+{
+  PROF_SCOPE(PROF_EVENTS);
+  SDL_Event event;
+  Uint32 downs=0;
+  Uint32 previous=held;
+
+  press_time=0;
+  memset(press_times,0,sizeof(press_times));
+  while(SDL_PollEvent(&event))
+  {
+    switch(event.type)
+    {
+      case SDL_KEYDOWN:
+        if(!press_time)
+          press_time=now_ns();
+        if(event.key.keysym.sym<SDLK_LAST)
+        {
+          Uint32 buttons=keymap[event.key.keysym.sym];
+          keys_down|=buttons;
+          downs|=buttons;
+          stamp(buttons,key_time(event.key.keysym.scancode,now_ns()));
+        }
+        break;
+      case SDL_KEYUP:
+        if(event.key.keysym.sym<SDLK_LAST)
+          keys_down&=~keymap[event.key.keysym.sym];
+        break;
+      case SDL_JOYAXISMOTION:
+        if(event.jaxis.axis<4)
+        {
+          Uint32 before=axes_down;
+          set_axis(event.jaxis.axis,event.jaxis.value);
+          if((axes_down&~before) && !press_time)
+            press_time=now_ns();
+          stamp(axes_down&~before,now_ns());
+        }
+        break;
+    }
+  }
+
+  // a key down and up in the same frame is still a press
+  held=keys_down|axes_down;
+  Uint32 changed=held^previous;
+  Uint32 taps=downs&~held;
+  pressed=(changed&held)|taps;
+  released=(changed&previous)|taps;
+
+  update_repeat(now_ns());
+  LAT_INPUT(press_time,sched_input_press());
+}
+
+///////////////////////////////////
+/*  State of this frame          */
+///////////////////////////////////
+int input_held(Uint32 buttons)
+{
+  return (held&buttons)!=0;
+}
+
+int input_pressed(Uint32 buttons)
+{
+  return (pressed&buttons)!=0;
+}
+
+int input_released(Uint32 buttons)
+{
+  return (released&buttons)!=0;
+}
+
+int input_steps(Uint32 buttons)
+{
+  int n=0;
+  for(int b=0; b<BTN_COUNT; b++)
+  {
+    if(!(buttons&(1<<b)))
+      continue;
+    if(BTN_REPEAT&(1<<b))
+      n+=steps[b];
+    else if(pressed&(1<<b))
+      n++;
+  }
+  return n;
+}
+
+int input_repeated(Uint32 buttons)
+{
+  return input_steps(buttons)>0;
+}
+
+int input_any()
+{
+  return pressed!=0;
+}
+
+Sint64 input_time(Uint32 buttons)
+{
+  Sint64 t=0;
+  for(int b=0; b<BTN_COUNT; b++)
+    if((buttons&pressed&(1<<b)) && press_times[b] && (!t || press_times[b]<t))
+      t=press_times[b];
+  return t;
+}
+
+Sint16 input_axis(int a)
+{
+  if(a<0 || a>=4)
+    return 0;
+  return axis[a];
+}
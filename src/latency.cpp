@@ -0,0 +1,165 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Input latency                             */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#ifdef LATENCY
+
+#include <time.h>
+#include "../inc/latency.h"
+
+#define TRUE   1
+#define FALSE  0
+
+#define LAT_MS      1000000LL   // ns
+#define LAT_MAX_AGE 1000        // ms, press that changed nothing
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct lat_histogram
+{
+  Uint32 bucket[LAT_BUCKETS+1];
+  Uint32 count;
+  Sint64 sum;                 // ns
+  Sint64 min;
+  Sint64 max;
+};
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static lat_histogram hist_press;      // kernel (or receipt) to display
+static lat_histogram hist_loop;       // receipt to display
+static Uint32 hist_frames[LAT_FRAMES];
+static Uint32 lat_dropped=0;          // presses with no change on screen
+static Uint32 lat_kernel=0;           // samples with evdev time
+
+static int pending=FALSE;
+static Sint64 pending_press;
+static Sint64 pending_received;
+static int pending_frames;
+
+static Sint64 now_ns()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (Sint64)ts.tv_sec*1000*LAT_MS+ts.tv_nsec;
+}
+
+static void hist_add(lat_histogram* h, Sint64 ns)
+{
+  int b=(int)(ns/LAT_MS);
+  if(b<0)
+    b=0;
+  if(b>LAT_BUCKETS)
+    b=LAT_BUCKETS;
+  h->bucket[b]++;
+  if(h->count==0 || ns<h->min)
+    h->min=ns;
+  if(ns>h->max)
+    h->max=ns;
+  h->count++;
+  h->sum+=ns;
+}
+
+///////////////////////////////////
+/*  Record                       */
+///////////////////////////////////
+void lat_input(Sint64 received, Sint64 kernel)
+{
+  // first press waiting is kept, later ones show in the same frame
+  if(!received || pending)
+    return;
+  pending=TRUE;
+  pending_received=received;
+  pending_press=received;
+  pending_frames=0;
+  // kernel time of this press, not of one SDL already gave
+  if(kernel && kernel<=received && received-kernel<LAT_MAX_AGE*LAT_MS)
+  {
+    pending_press=kernel;
+    lat_kernel++;
+  }
+}
+
+void lat_shown(int updated)
+{
+  if(!pending)
+    return;
+  Sint64 now=now_ns();
+  if(updated)
+  {
+    hist_add(&hist_press,now-pending_press);
+    hist_add(&hist_loop,now-pending_received);
+    hist_frames[pending_frames]++;
+    pending=FALSE;
+    return;
+  }
+  pending_frames++;
+  if(pending_frames>=LAT_FRAMES || now-pending_received>LAT_MAX_AGE*LAT_MS)
+  {
+    lat_dropped++;
+    pending=FALSE;
+  }
+}
+
+///////////////////////////////////
+/*  Output                       */
+///////////////////////////////////
+// ms below which the given part of samples are
+static double hist_percentile(const lat_histogram* h, double part)
+{
+  Uint32 target=(Uint32)(h->count*part);
+  Uint32 n=0;
+  for(int b=0; b<=LAT_BUCKETS; b++)
+  {
+    n+=h->bucket[b];
+    if(n>target)
+      return b+1;
+  }
+  return LAT_BUCKETS+1;
+}
+
+static void hist_summary(FILE* f, const char* name, const lat_histogram* h)
+{
+  if(h->count==0)
+  {
+    fprintf(f,"%s: no samples\n",name);
+    return;
+  }
+  fprintf(f,"%s: %u samples, avg %.2f ms, min %.2f ms, max %.2f ms, p50 < %.0f ms, p95 < %.0f ms\n",
+          name,h->count,(double)h->sum/h->count/LAT_MS,(double)h->min/LAT_MS,(double)h->max/LAT_MS,
+          hist_percentile(h,0.5),hist_percentile(h,0.95));
+}
+
+void lat_dump()
+{
+  hist_summary(stderr,"latency press",&hist_press);
+  hist_summary(stderr,"latency loop",&hist_loop);
+  fprintf(stderr,"latency: %u with kernel time, %u without change on screen\n",lat_kernel,lat_dropped);
+}
+
+int lat_save(const char* path)
+{
+  FILE* f=fopen(path,"wb");
+  if(f==NULL)
+    return FALSE;
+
+  hist_summary(f,"# press",&hist_press);
+  hist_summary(f,"# loop",&hist_loop);
+  fprintf(f,"# %u with kernel time, %u without change on screen\n",lat_kernel,lat_dropped);
+  fprintf(f,"# frames waited:");
+  for(int i=0; i<LAT_FRAMES; i++)
+    fprintf(f," %u",hist_frames[i]);
+  fprintf(f,"\n# ms press loop (last row: longer)\n");
+  for(int b=0; b<=LAT_BUCKETS; b++)
+    if(hist_press.bucket[b] || hist_loop.bucket[b])
+      fprintf(f,"%d %u %u\n",b,hist_press.bucket[b],hist_loop.bucket[b]);
+  fclose(f);
+  return TRUE;
+}
+
+#endif
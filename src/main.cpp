@@ -18,71 +18,46 @@
 #include <fstream>
 #include <SDL/SDL.h>
 #include <SDL/SDL_image.h>
-#include <SDL/SDL_ttf.h>
 #include <SDL/SDL_mixer.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <limits.h>
 #include <libgen.h>
+#include <signal.h>
 
+#ifndef BITMAP_FONTS
+#include <SDL/SDL_ttf.h>
 #include "../inc/font_pixelberry.h"       // font are embedded in executable
 #include "../inc/font_atomicclockradio.h"
 #include "../inc/font_audiowide.h"
+#else
+#include "../inc/bfont_pixelberry.h"      // glyphs baked at build time (make fonts)
+#include "../inc/bfont_atomicclockradio.h"
+#include "../inc/bfont_audiowide.h"
+#endif
 #include "../inc/bmp_icons.h"
 #include "../inc/bmp_arrows.h"
 #include "../inc/bmp_buttons.h"
-
-///////////////////////////////////
-/*  Joystick codes               */
-///////////////////////////////////
-#ifdef PLATFORM_MIYOO
-
-#define GCW_BUTTON_UP           SDLK_UP
-#define GCW_BUTTON_DOWN         SDLK_DOWN
-#define GCW_BUTTON_LEFT         SDLK_LEFT
-#define GCW_BUTTON_RIGHT        SDLK_RIGHT
-#define GCW_BUTTON_A            SDLK_SPACE
-#define GCW_BUTTON_B            SDLK_LCTRL
-#define GCW_BUTTON_X            SDLK_LSHIFT
-#define GCW_BUTTON_Y            SDLK_LALT
-#define GCW_BUTTON_L1           101
-#define GCW_BUTTON_R1           116
-#define GCW_BUTTON_L2           SDLK_TAB
-#define GCW_BUTTON_R2           SDLK_BACKSPACE
-#define GCW_BUTTON_SELECT       305
-#define GCW_BUTTON_START        SDLK_RETURN
-#define GCW_BUTTON_L3           998
-#define GCW_BUTTON_R3           999
-#define GCW_BUTTON_POWER        320
-#define GCW_BUTTON_VOLUP        312
-#define GCW_BUTTON_VOLDOWN      311
-#define GCW_BUTTON_MENU         SDLK_ESCAPE
-
-#else
-
-#define GCW_BUTTON_UP           SDLK_UP
-#define GCW_BUTTON_DOWN         SDLK_DOWN
-#define GCW_BUTTON_LEFT         SDLK_LEFT
-#define GCW_BUTTON_RIGHT        SDLK_RIGHT
-#define GCW_BUTTON_A            SDLK_LCTRL
-#define GCW_BUTTON_B            SDLK_LALT
-#define GCW_BUTTON_X            SDLK_SPACE
-#define GCW_BUTTON_Y            SDLK_LSHIFT
-#define GCW_BUTTON_L1           SDLK_TAB
-#define GCW_BUTTON_R1           SDLK_BACKSPACE
-#define GCW_BUTTON_L2           SDLK_PAGEUP
-#define GCW_BUTTON_R2           SDLK_PAGEDOWN
-#define GCW_BUTTON_SELECT       SDLK_ESCAPE
-#define GCW_BUTTON_START        SDLK_RETURN
-#define GCW_BUTTON_L3           SDLK_KP_DIVIDE
-#define GCW_BUTTON_R3           SDLK_KP_PERIOD
-#define GCW_BUTTON_POWER        SDLK_HOME
-#define GCW_BUTTON_VOLUP        0 //SDLK_PAUSE
-//#define GCW_BUTTON_VOLDOWN      0
-
-#endif
-
-#define GCW_JOYSTICK_DEADZONE   1000
+#include "../inc/alarm.h"
+#include "../inc/analog.h"
+#include "../inc/bench.h"
+#include "../inc/blend.h"
+#include "../inc/catalog.h"
+#include "../inc/civil_date.h"
+#include "../inc/digit_strip.h"
+#include "../inc/glyph_cache.h"
+#include "../inc/input.h"
+#include "../inc/latency.h"
+#include "../inc/power.h"
+#include "../inc/profiler.h"
+#include "../inc/raster.h"
+#include "../inc/render.h"
+#include "../inc/rtc.h"
+#include "../inc/scheduler.h"
+#include "../inc/sprites.h"
+#include "../inc/stopwatch.h"
+#include "../inc/time_service.h"
+#include "../inc/world_clock.h"
 
 ///////////////////////////////////
 /*  Other defines                */
@@ -98,43 +73,32 @@
 #define MODE_CAL    2
 #define MODE_ALARM  3
 #define MODE_TIMER  4
+#define MODE_WORLD  5
+
+#define THEME_CLOCK 0
+#define THEME_ALARM 1
+
+#define HINTBAR_Y   228
+
+#define ALARM_FIELDS        10    // hour, minutes, 7 days, snooze
+#define ALARM_LINES         4     // alarms shown in the list
+#define ALARM_RING_SECONDS  300   // unattended alarm stops ringing
+#define TIMER_FRAME_MS      16    // running stopwatch or countdown shown
+#define TONE_HZ             880
+#define TONE_VOLUME         8000
+#define WORLD_ROW_H         30    // city name, day and zone, time on the right
+// years the clock can be set to, time_t is 32 bit on the devices
+#define EDIT_YEAR_FIRST     (sizeof(time_t)>4?1:1970)
+#define EDIT_YEAR_LAST      (sizeof(time_t)>4?9999:2037)
+#ifdef PLATFORM_MIYOO
+#define DEBUG_CHORD         BTN_MENU            // no sticks, menu is free
+#else
+#define DEBUG_CHORD         (BTN_L3|BTN_R3)     // both sticks pressed
+#endif
 
 ///////////////////////////////////
 /*  Structs                      */
 ///////////////////////////////////
-struct joystick_state
-{
-  int j1_left;
-  int j1_right;
-  int j1_up;
-  int j1_down;
-  int button_l3;
-  int j2_left;
-  int j2_right;
-  int j2_up;
-  int j2_down;
-  int button_r3;
-  int pad_left;
-  int pad_right;
-  int pad_up;
-  int pad_down;
-  int button_a;
-  int button_b;
-  int button_x;
-  int button_y;
-  int button_l1;
-  int button_l2;
-  int button_r1;
-  int button_r2;
-  int button_select;
-  int button_start;
-  int button_power;
-  int button_voldown;
-  int button_volup;
-  int escape;
-  int any;
-};
-
 struct settings
 {
   int format_24;
@@ -142,6 +106,51 @@ struct settings
   int date_ord2;
   int date_ord3;
   int mon_first;      // is monday first day of the week?
+  int analog;         // analog face instead of digits
+  int idle_timeout;   // s without input to go idle, 0 never
+  int idle_dim;       // % of the backlight while idle
+  int idle_seconds;   // idle face shows seconds, else updated each minute
+};
+
+struct layer_key
+{
+  int mode;
+  int lang;
+  int edit_mode;
+  int variant;
+  int theme;
+  int month;          // calendar: year*12+month
+  int today;          // calendar: cell of today
+};
+
+struct layer
+{
+  SDL_Surface* surface;
+  layer_key key;
+  int valid;
+  Uint32 version;
+};
+
+struct clock_theme
+{
+  SDL_Color top;
+  SDL_Color front;
+  SDL_Color button_shadow;
+  SDL_Color button;
+};
+
+struct month_layout
+{
+  int valid;
+  int year;
+  int mon;
+  int mon_first;
+  int cells;          // 28, 35 or 42
+  int first_day;      // day number of first cell
+  int today;          // cell of today, -1 if not in this month
+  Uint8 day[42];
+  Uint8 inmonth[42];
+  Uint8 sunday[42];
 };
 
 struct editpos
@@ -157,19 +166,19 @@ struct editpos
 ///////////////////////////////////
 SDL_Surface* screen;   		    // screen to work
 int done=FALSE;
-TTF_Font* font;                 // used font
-TTF_Font* font2;                // used font
-TTF_Font* font3;                // used font
+text_font* font;                // used font
+text_font* font2;               // used font
+text_font* font3;               // used font
 SDL_Joystick* joystick;         // used joystick
-joystick_state mainjoystick;
-Uint8* keys=SDL_GetKeyState(NULL);
-#define MAX_SECTIONS  2   // there are 4 sections: clock, calendar, alarm, timer
+#define MAX_SECTIONS  5   // there are 5 sections: clock, calendar, alarm, timer, world
 
-int lang=1; // 0=english, 1=spanish
+int lang=1; // catalog language, 0=english, 1=spanish
 
 // clock info
 tm actual_time;
 tm edit_time;
+time_text actual_text;
+time_text edit_text;
 int mode_app=MODE_CLOCK;
 int edit_mode=FALSE;
 settings clock_settings;
@@ -178,71 +187,72 @@ settings clock_previous;
 int editclock_index=0;
 editpos editclock_pos[7];
 
+// alarm info
+int alarm_index=0;              // selected in the list
+int alarm_ringing=ALARM_NONE;
+time_t alarm_ring_start;
+alarm_entry alarm_edit;         // copy being edited
+int alarm_edit_new=FALSE;
+int editalarm_index=0;
+time_text alarm_text;
+
+// timer info
+stopwatch timer_sw;
+countdown timer_cd;
+int timer_countdown=FALSE;      // countdown shown instead of stopwatch
+int timer_ringing=FALSE;
+Sint64 timer_ring_start;
+int edittimer_index=0;          // countdown minutes or seconds
+
 // calendar info
 tm actual_calendar;
+month_layout cal_layout;
+tm cal_today;
+time_t cal_midnight=0;
 
 // graphics
-SDL_Surface *img_icons[12];
-SDL_Surface *img_arrows[2];
-SDL_Surface *img_buttons[14];
+SDL_Color color_background={6,6,6,0};
+const clock_theme themes[2]=
+{
+  {{120,132,171,0},{62,55,92,0},{122,33,58,0},{225,65,65,0}},     // clock
+  {{225,65,65,0},{122,33,58,0},{164,164,164,0},{255,255,255,0}}   // alarm
+};
+layer layer_body;
+layer layer_hints;
+layer layer_cal;
+layer layer_dial;
+SDL_Surface *sheet_icons;
+SDL_Surface *sheet_arrows;
+SDL_Surface *sheet_buttons;
+sprite img_icons[14];
+sprite img_arrows[2];
+sprite img_buttons[14];
+// active and inactive icon of each section
+const int section_icons[MAX_SECTIONS][2]={{2,6},{3,7},{4,8},{5,9},{12,13}};
 //sonidos
 Mix_Chunk *sound_tone;
+Sint16* tone_samples=NULL;      // sound_tone doesn't own them
+int audio_ready=FALSE;          // audio device opened on first use
+
+// startup, ms from main() to each step
+timespec startup_begin;
+double startup_video=0;
+double startup_config=0;
+double startup_init=0;
+double startup_first_frame=0;
+int deferred_done=FALSE;
 
 ///////////////////////////////////
-/*  Messages                     */
+/*  Texts                        */
 ///////////////////////////////////
-const char* msg[2][9]=
-{
-  {
-    " exit",
-    " set time",
-    " accept",
-    " cancel",
-    " move",
-    " month",
-    " year",
-    " begin",
-    " set alarm"
-  },
-  {
-    " salir",
-    " ajustar",
-    " aceptar",
-    " cancelar",
-    " mover",
-    " mes",
-    " ano",
-    " inicio",
-    " alarma"
-  }
-};
-
-const char* daysname[2][7]=
-{
-  {
-    "Sun","Mon","Tue","Wed","Thu","Fri","Sat"
-  },
-  {
-    "Dom","Lun","Mar","Mie","Jue","Vie","Sab"
-  }
-};
+// languages are in the catalog (catalog.cpp and lang.ini)
 
-const char* monthsname[2][12]=
+// shown when there is no cities.ini
+const char* world_default[5]=
 {
-  {
-    "JANUARY","FEBRUARY","MARCH","APRIL","MAY","JUNE","JULY","AUGUST","SEPTEMBER","OCTOBER","NOVEMBER","DECEMBER"
-  },
-  {
-    "ENERO","FEBRERO","MARZO","ABRIL","MAYO","JUNIO","JULIO","AGOSTO","SEPTIEMBRE","OCTUBRE","NOVIEMBRE","DICIEMBRE"
-  }
+  "America/New_York","Europe/London","Europe/Madrid","Asia/Tokyo","Australia/Sydney"
 };
 
-///////////////////////////////////
-/*  Function declarations        */
-///////////////////////////////////
-void process_events();
-void process_joystick();
-
 ///////////////////////////////////
 /*  Debug Functions              */
 ///////////////////////////////////
@@ -282,32 +292,21 @@ void get_exe_dir(char *path)
 }
 
 ///////////////////////////////////
-/*  Replace string               */
+/*  Path of a config file        */
 ///////////////////////////////////
-void replace_string(char* string, const char* find, const char* replace)
+// directory is created when create is TRUE
+void config_path(char* path, const char* file, int create)
 {
-  char newcopy[80];
-  char *pos = strstr(string, find);
-
-  if (pos != NULL)
-  {
-    // Calculate sizes
-    int init = pos - string;                    // Initial size
-    int long_find = strlen(find);               // Size of text to replace
-    int long_replace = strlen(replace);         // New size
-    int rest = strlen(string) - init - long_find; // Total size
-
-    // Copy first substring
-    strncpy(newcopy, string, init);
-    newcopy[init] = '\0';
-
-    // Copy replace
-    strcat(newcopy, replace);
-
-    // Copy last substring
-    strcat(newcopy, pos + long_find);
-    strcpy(string, newcopy);
-  }
+#ifdef PLATFORM_MIYOO
+  get_exe_dir(path);
+  strcat(path,"/.config");
+#else
+  strcpy(path,"/usr/local/home/.odclock");
+#endif
+  if(create)
+    mkdir(path,0);
+  strcat(path,"/");
+  strcat(path,file);
 }
 
 ///////////////////////////////////
@@ -316,14 +315,9 @@ void replace_string(char* string, const char* find, const char* replace)
 void load_config()
 {
   FILE* config_file;
-#ifdef PLATFORM_MIYOO
   char path[500];
-  get_exe_dir((char*)&path);
-  strcat(path,"/.config/settings.ini");
+  config_path(path,"settings.ini",FALSE);
   config_file=fopen(path,"r");
-#else
-  config_file=fopen("/usr/local/home/.odclock/settings.ini","r");
-#endif
 
   if(config_file!=NULL)
   {
@@ -345,6 +339,14 @@ void load_config()
         clock_settings.date_ord3=val;
       if(strcmp(var,"Lang")==0)
         lang=val;
+      if(strcmp(var,"Analog")==0)
+        clock_settings.analog=val;
+      if(strcmp(var,"IdleTimeout")==0)
+        clock_settings.idle_timeout=val;
+      if(strcmp(var,"IdleBacklight")==0)
+        clock_settings.idle_dim=val;
+      if(strcmp(var,"IdleSeconds")==0)
+        clock_settings.idle_seconds=val;
     }
     fclose(config_file);
   }
@@ -355,26 +357,14 @@ void load_config()
 ///////////////////////////////////
 void save_config()
 {
-#ifdef PLATFORM_MIYOO
+  FILE* config_file;
   char path[500];
-  get_exe_dir((char*)&path);
-  strcat(path,"/.config");
-  mkdir(path,0);
-#else
-  mkdir("/usr/local/home/.odclock",0);
-#endif
-
-FILE* config_file;
-#ifdef PLATFORM_MIYOO
-  strcat(path,"/settings.ini");
+  config_path(path,"settings.ini",TRUE);
   config_file=fopen(path,"wb");
-#else
-  config_file=fopen("/usr/local/home/.odclock/settings.ini","wb");
-#endif
 
   if(config_file!=NULL)
   {
-    char line[20];
+    char line[32];
     sprintf(line,"FormatFull %d\n",clock_settings.format_24);
     fputs(line,config_file);
     sprintf(line,"MondayFirst %d\n",clock_settings.mon_first);
@@ -387,20 +377,83 @@ FILE* config_file;
     fputs(line,config_file);
     sprintf(line,"Lang %d\n",lang);
     fputs(line,config_file);
+    sprintf(line,"Analog %d\n",clock_settings.analog);
+    fputs(line,config_file);
+    sprintf(line,"IdleTimeout %d\n",clock_settings.idle_timeout);
+    fputs(line,config_file);
+    sprintf(line,"IdleBacklight %d\n",clock_settings.idle_dim);
+    fputs(line,config_file);
+    sprintf(line,"IdleSeconds %d\n",clock_settings.idle_seconds);
+    fputs(line,config_file);
 
     fclose(config_file);
   }
 }
 
+///////////////////////////////////
+/*  Load and save alarms         */
+///////////////////////////////////
+// alarms.ini, next to settings.ini, saved on every change
+void load_alarms()
+{
+  char path[500];
+  config_path(path,"alarms.ini",FALSE);
+  alarm_load(path,time(0));
+}
+
+void save_alarms()
+{
+  char path[500];
+  config_path(path,"alarms.ini",TRUE);
+  alarm_save(path);
+}
+
+///////////////////////////////////
+/*  Load keymap                  */
+///////////////////////////////////
+// keymap.ini, only to change the default keys
+void load_keymap()
+{
+  char path[500];
+  config_path(path,"keymap.ini",FALSE);
+  input_load_keymap(path);
+}
+
+///////////////////////////////////
+/*  Load languages               */
+///////////////////////////////////
+// lang.ini, languages added after english and spanish
+void load_catalog()
+{
+  char path[500];
+  config_path(path,"lang.ini",FALSE);
+  catalog_load(path);
+}
+
+///////////////////////////////////
+/*  Load world clock cities      */
+///////////////////////////////////
+// cities.ini, "City Europe/Madrid" lines, zone files are read after
+// the first frame
+void load_cities()
+{
+  world_init(getenv("ODCLOCK_ZONEINFO"));
+#ifndef BENCHMARK
+  char path[500];
+  config_path(path,"cities.ini",FALSE);
+  world_load_list(path);
+#endif
+  if(world_count()==0)
+    for(int i=0; i<5; i++)
+      world_add(world_default[i]);
+}
+
 ///////////////////////////////////
 /*  Draw a pixel in surface      */
 ///////////////////////////////////
 void putpixel(SDL_Surface *dst, int x, int y, Uint32 pixel)
 {
-    int byteperpixel = dst->format->BytesPerPixel;
-    Uint8 *p = (Uint8*)dst->pixels + y * dst->pitch + x * byteperpixel;
-    // Adress to pixel
-    *(Uint32 *)p = pixel;
+  raster_pixel(dst,x,y,pixel);
 }
 
 ///////////////////////////////////
@@ -408,55 +461,120 @@ void putpixel(SDL_Surface *dst, int x, int y, Uint32 pixel)
 ///////////////////////////////////
 void drawLine(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 pixel)
 {
-    int i;
-    double x = x1 - x0;
-    double y = y1 - y0;
-    double length = sqrt( x*x + y*y );
-    double addx = x / length;
-    double addy = y / length;
-    x = x0;
-    y = y0;
-
-    for ( i = 0; i < length; i += 1) {
-        putpixel(dst, x, y, pixel);
-        x += addx;
-        y += addy;
-    }
+  raster_line(dst,x0,y0,x1,y1,pixel);
 }
 
 ///////////////////////////////////
 /*  Print text in surface        */
 ///////////////////////////////////
-void draw_text(SDL_Surface* dst, TTF_Font* f, char* string, int x, int y, int fR, int fG, int fB)
+void draw_text(SDL_Surface* dst, text_font* f, char* string, int x, int y, int fR, int fG, int fB)
 {
   if(dst && string && f)
   {
     SDL_Color foregroundColor={(Uint8)fR,(Uint8)fG,(Uint8)fB};
-    SDL_Surface *textSurface=TTF_RenderText_Blended(f,string,foregroundColor);
-    if(textSurface)
-    {
-      SDL_Rect textLocation={(Sint16)x,(Sint16)y,0,0};
-      SDL_BlitSurface(textSurface,NULL,dst,&textLocation);
-      SDL_FreeSurface(textSurface);
-    }
+    if(dst==screen)
+      render_text(f,string,x,y,foregroundColor);        // drawn at end of frame if changed
+    else
+      glyphcache_draw(dst,f,string,x,y,foregroundColor);   // glyphs are rasterized only once
+  }
+}
+
+///////////////////////////////////
+/*  Print catalog string         */
+///////////////////////////////////
+// drawn from the run laid out when the language was set
+void draw_label(SDL_Surface* dst, int id, int x, int y, int fR, int fG, int fB)
+{
+  const text_run* run=catalog_run(id);
+  if(!run)
+  {
+    draw_text(dst,font,(char*)catalog_str(id),x,y,fR,fG,fB);
+    return;
+  }
+  SDL_Color foregroundColor={(Uint8)fR,(Uint8)fG,(Uint8)fB};
+  if(dst==screen)
+    render_run(font,run,x,y,foregroundColor);
+  else if(dst)
+    glyphcache_draw_run(dst,font,run,x,y,foregroundColor);
+}
+
+///////////////////////////////////
+/*  Print big digits in screen   */
+///////////////////////////////////
+// 0-9 and ':' from a prerendered strip, other text as usual
+void draw_digits(text_font* f, char* string, int x, int y, int fR, int fG, int fB)
+{
+  SDL_Color c={(Uint8)fR,(Uint8)fG,(Uint8)fB};
+  if(!digitstrip_draw(digitstrip_get(f,c),string,x,y))
+    draw_text(screen,f,string,x,y,fR,fG,fB);
+}
+
+///////////////////////////////////
+/*  Draw image in screen         */
+///////////////////////////////////
+void draw_image(SDL_Surface* dst, SDL_Surface* img, int x, int y)
+{
+  if(!img)
+    return;
+  if(dst==screen)
+    render_blit(img,NULL,x,y);
+  else
+  {
+    SDL_Rect dest={(Sint16)x,(Sint16)y,0,0};
+    SDL_BlitSurface(img,NULL,dst,&dest);
+  }
+}
+
+///////////////////////////////////
+/*  Draw sprite from its sheet   */
+///////////////////////////////////
+void draw_sprite(SDL_Surface* dst, sprite* spr, int x, int y)
+{
+  if(!spr->sheet)
+    return;
+  if(dst==screen)
+    render_blit(spr->sheet,&spr->rect,x,y);
+  else
+  {
+    SDL_Rect src=spr->rect;
+    SDL_Rect dest={(Sint16)x,(Sint16)y,0,0};
+    SDL_BlitSurface(spr->sheet,&src,dst,&dest);
   }
 }
 
 ///////////////////////////////////
 /*  Return text width             */
 ///////////////////////////////////
-int text_width(char* string,TTF_Font* f=font)
+int text_width(char* string,text_font* f=font)
 {
-  int nx=0,ny=0;
-  TTF_SizeText(f,string,&nx,&ny);
+  return glyphcache_width(f,string);
+}
+
+// width of a string as draw_digits() draws it
+int digits_width(text_font* f, char* string, int fR, int fG, int fB)
+{
+  SDL_Color c={(Uint8)fR,(Uint8)fG,(Uint8)fB};
+  digit_strip* ds=digitstrip_get(f,c);
+  int w=digitstrip_width(ds,string);
+  return (ds && w>0)?w:text_width(string,f);
+}
 
-  return nx;
+///////////////////////////////////
+/*  Fill a rect with a color     */
+///////////////////////////////////
+void fill_rect(SDL_Surface* dst, SDL_Rect* r, SDL_Color* c)
+{
+  Uint32 colour=SDL_MapRGB(dst->format,c->r,c->g,c->b);
+  if(dst==screen)
+    render_fill(r,colour);
+  else
+    SDL_FillRect(dst,r,colour);
 }
 
 ///////////////////////////////////
 /*  Draw a rectangle             */
 ///////////////////////////////////
-void draw_rectangle(int x, int y, int w, int h, SDL_Color* c, int border=BORDER_NO, SDL_Color* bc=NULL)
+void draw_rectangle(SDL_Surface* dst, int x, int y, int w, int h, SDL_Color* c, int border=BORDER_NO, SDL_Color* bc=NULL)
 {
   SDL_Rect dest;
 
@@ -472,6 +590,20 @@ void draw_rectangle(int x, int y, int w, int h, SDL_Color* c, int border=BORDER_
     bc=c;
   }
 
+  // baked layers: rows of spans, each pixel written once
+  if(dst!=screen)
+  {
+    Uint32 fill=c?SDL_MapRGB(dst->format,c->r,c->g,c->b):0;
+    Uint32 edge=bc?SDL_MapRGB(dst->format,bc->r,bc->g,bc->b):0;
+    int parts=(c?RASTER_FILL:0)|(bc?RASTER_EDGE:0);
+    if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+      return;
+    raster_box(dst,x,y,w,h,border,fill,edge,parts);
+    if(SDL_MUSTLOCK(dst))
+      SDL_UnlockSurface(dst);
+    return;
+  }
+
   switch(border)
   {
     case BORDER_NO:
@@ -480,7 +612,7 @@ void draw_rectangle(int x, int y, int w, int h, SDL_Color* c, int border=BORDER_
       dest.w=w;
       dest.h=h;
       if(c)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,c->r,c->g,c->b));
+        fill_rect(dst,&dest,c);
       break;
     case BORDER_SINGLE:
       dest.x=x;
@@ -488,13 +620,13 @@ void draw_rectangle(int x, int y, int w, int h, SDL_Color* c, int border=BORDER_
       dest.w=w;
       dest.h=h;
       if(bc)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,bc->r,bc->g,bc->b));
+        fill_rect(dst,&dest,bc);
       dest.x=x+1;
       dest.y=y+1;
       dest.w=w-2;
       dest.h=h-2;
       if(c)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,c->r,c->g,c->b));
+        fill_rect(dst,&dest,c);
       break;
     case BORDER_ROUNDED:
       dest.x=x+1;
@@ -502,140 +634,150 @@ void draw_rectangle(int x, int y, int w, int h, SDL_Color* c, int border=BORDER_
       dest.w=w-2;
       dest.h=h-2;
       if(bc)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,bc->r,bc->g,bc->b));
+        fill_rect(dst,&dest,bc);
       dest.x=x+2;
       dest.y=y;
       dest.w=w-4;
       dest.h=h;
       if(bc)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,bc->r,bc->g,bc->b));
+        fill_rect(dst,&dest,bc);
       dest.x=x;
       dest.y=y+2;
       dest.w=w;
       dest.h=h-4;
       if(bc)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,bc->r,bc->g,bc->b));
+        fill_rect(dst,&dest,bc);
       dest.x=x+2;
       dest.y=y+1;
       dest.w=w-4;
       dest.h=h-2;
       if(c)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,c->r,c->g,c->b));
+        fill_rect(dst,&dest,c);
       dest.x=x+1;
       dest.y=y+2;
       dest.w=w-2;
       dest.h=h-4;
       if(c)
-        SDL_FillRect(screen, &dest, SDL_MapRGB(screen->format,c->r,c->g,c->b));
+        fill_rect(dst,&dest,c);
       break;
   }
 }
 
+///////////////////////////////////
+/*  Cached layers                */
+///////////////////////////////////
+// static parts (clock body, button hints) are baked once in a surface
+// and drawn with one blit, until the key changes
+int layer_prepare(layer* l, int w, int h, layer_key* key)
+{
+  if(!l->surface)
+    l->surface=SDL_CreateRGBSurface(SDL_SWSURFACE,w,h,screen->format->BitsPerPixel,
+                                    screen->format->Rmask,screen->format->Gmask,screen->format->Bmask,screen->format->Amask);
+  if(!l->surface)
+    return FALSE;
+  if(l->valid && memcmp(&l->key,key,sizeof(layer_key))==0)
+    return FALSE;
+
+  l->key=*key;
+  l->valid=TRUE;
+  l->version++;
+  SDL_SetColorKey(l->surface,0,0);    // not RLE while drawing on it
+  return TRUE;
+}
+
+void draw_layer(layer* l, int x, int y)
+{
+  if(l->surface)
+    render_blit(l->surface,NULL,x,y,l->version);
+}
+
+void free_layer(layer* l)
+{
+  if(l->surface)
+    SDL_FreeSurface(l->surface);
+  l->surface=NULL;
+  l->valid=FALSE;
+}
+
 void draw_actualtime(int x, int y)
 {
-  time_t now=time(0);
-  tm* timeinfo;
-  timeinfo=localtime(&now);
-  actual_time=*timeinfo;
+  time_text* tt=&actual_text;
+  timesvc_format(tt,&actual_time,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
 
   // time
-  char timetext[20];
-  if(clock_settings.format_24)
-  {
-    strftime(timetext,20,"%H:%M",timeinfo);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
-  }
-  else
-  {
-    strftime(timetext,20,"%I:%M",timeinfo);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
-  }
+  draw_digits(font2,tt->time,x+17,y+40,255,255,0);
 
   // date
-  char datetext[80];
-  char formatdate[20];
-  formatdate[0]=0;
-  if(clock_settings.date_ord1==0)
-    strcat(formatdate,"%d ");
-  else if(clock_settings.date_ord1==1)
-    strcat(formatdate,"%B ");
-  else if(clock_settings.date_ord1==2)
-    strcat(formatdate,"%Y ");
-  if(clock_settings.date_ord2==0)
-    strcat(formatdate,"%d ");
-  else if(clock_settings.date_ord2==1)
-    strcat(formatdate,"%B ");
-  else if(clock_settings.date_ord2==2)
-    strcat(formatdate,"%Y ");
-  if(clock_settings.date_ord3==0)
-    strcat(formatdate,"%d");
-  else if(clock_settings.date_ord3==1)
-    strcat(formatdate,"%B");
-  else if(clock_settings.date_ord3==2)
-    strcat(formatdate,"%Y");
-//strftime(datetext,80,"%d %B %Y",timeinfo);
-  strftime(datetext,80,formatdate,timeinfo);
-  char* text=datetext;
-  while(*text)
-  {
-    *text=toupper((unsigned char)*text);
-    text++;
-  }
-  if(lang==1)
-    replace_string(datetext,monthsname[0][actual_time.tm_mon],monthsname[1][actual_time.tm_mon]);
-  int tw=text_width(datetext);
-  draw_text(screen,font,datetext,x+(150-tw)/2,y+80,255,255,0);
+  int tw=text_width(tt->date);
+  draw_text(screen,font,tt->date,x+(150-tw)/2,y+80,255,255,0);
 
   // AM/PM
-  char amtext[20];
   if(!clock_settings.format_24)
-  {
-    strftime(amtext,20,"%p",timeinfo);
-    draw_text(screen,font,amtext,x+120,y+56,128,128,0);
-  }
+    draw_text(screen,font,tt->ampm,x+120,y+56,128,128,0);
   else
     draw_text(screen,font,(char*)"24h",x+120,y+56,30,30,30);
 
   // seconds
-  char sectext[20];
-  strftime(sectext,20,":%S",timeinfo);
-  draw_text(screen,font,sectext,x+120,y+40,128,128,0);
+  draw_text(screen,font,tt->seconds,x+120,y+40,128,128,0);
 }
 
-void draw_alarmtime(int x, int y)
+///////////////////////////////////
+/*  Analog face                  */
+///////////////////////////////////
+// ms of the second read in this frame, for the sweep of the second hand
+int actual_ms()
 {
-  time_t now=time(0);
-  tm* timeinfo;
-  timeinfo=localtime(&now);
-  actual_time=*timeinfo;
+  timespec ts;
+  clock_gettime(CLOCK_REALTIME,&ts);
+  if(ts.tv_sec==timesvc_now())
+    return ts.tv_nsec/1000000;
+  return ts.tv_sec>timesvc_now()?999:0;
+}
 
-  // time
-  char timetext[20];
-  if(clock_settings.format_24)
-  {
-    strftime(timetext,20,"%H:%M",timeinfo);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
-  }
-  else
+// dial baked once, hands are lines: only their boxes are redrawn
+void draw_analog(int x, int y)
+{
+  SDL_PixelFormat* fmt=screen->format;
+  layer_key key={MODE_CLOCK,0,0,1,THEME_CLOCK,0,0};
+  if(layer_prepare(&layer_dial,ANALOG_SIZE,ANALOG_SIZE,&key))
   {
-    strftime(timetext,20,"%I:%M",timeinfo);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
+    const SDL_Color* rim=&themes[THEME_CLOCK].front;
+    Uint32 magenta=SDL_MapRGB(fmt,255,0,255);
+    analog_bake_dial(layer_dial.surface,magenta,SDL_MapRGB(fmt,23,17,26),SDL_MapRGB(fmt,rim->r,rim->g,rim->b),
+                     SDL_MapRGB(fmt,120,132,171));
+    SDL_SetColorKey(layer_dial.surface,SDL_SRCCOLORKEY|SDL_RLEACCEL,magenta);
   }
+  draw_layer(&layer_dial,x,y);
+
+  analog_colours c;
+  c.hour=SDL_MapRGB(fmt,255,255,0);
+  c.min=c.hour;
+  c.sec=SDL_MapRGB(fmt,225,65,65);
+  c.cap=SDL_MapRGB(fmt,120,132,171);
+  analog_draw_hands(x+ANALOG_SIZE/2,y+ANALOG_SIZE/2,&actual_time,actual_ms(),&c);
+
+  // date
+  time_text* tt=&actual_text;
+  timesvc_format(tt,&actual_time,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
+  draw_text(screen,font,tt->date,x+(ANALOG_SIZE-text_width(tt->date))/2,y+ANALOG_SIZE+6,255,255,0);
+}
+
+void draw_alarmtime(int x, int y)
+{
+  time_text* tt=&actual_text;
+  timesvc_format(tt,&actual_time,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
+
+  // time
+  draw_digits(font2,tt->time,x+17,y+40,255,255,0);
 
   // AM/PM
-  char amtext[20];
   if(!clock_settings.format_24)
-  {
-    strftime(amtext,20,"%p",timeinfo);
-    draw_text(screen,font,amtext,x+120,y+56,128,128,0);
-  }
+    draw_text(screen,font,tt->ampm,x+120,y+56,128,128,0);
   else
     draw_text(screen,font,(char*)"24h",x+120,y+56,30,30,30);
 
   // seconds
-  char sectext[20];
-  strftime(sectext,20,":%S",timeinfo);
-  draw_text(screen,font,sectext,x+120,y+40,128,128,0);
+  draw_text(screen,font,tt->seconds,x+120,y+40,128,128,0);
 }
 
 void set_clockeditarrows(int x, int y)
@@ -663,116 +805,31 @@ void set_clockeditarrows(int x, int y)
   editclock_pos[3].y2=editclock_pos[3].y+10;
 }
 
-void uppertext(char* text)
-{
-  while(*text)
-  {
-    *text=toupper((unsigned char)*text);
-    text++;
-  }
-}
-
 void draw_edittime(int x, int y)
 {
   set_clockeditarrows(x,y);
 
-  // time
-  char timetext[20];
-  if(clock_settings.format_24)
-  {
-    strftime(timetext,20,"%H:%M",&edit_time);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
-  }
-  else
-  {
-    strftime(timetext,20,"%I:%M",&edit_time);
-    draw_text(screen,font2,timetext,x+17,y+40,255,255,0);
-  }
-
-  // date
-  int w1,w2,w3;
-  char* text;
-  char datetext[80];
-  char formatdate[20];
-  formatdate[0]=0;
-  char tempwidth[20];
-  tempwidth[0]=0;
-
-  if(clock_settings.date_ord1==0)
-  {
-    strcat(formatdate,"%d ");
-    strftime(tempwidth,20,"%d ",&edit_time);
-  }
-  else if(clock_settings.date_ord1==1)
-  {
-    strcat(formatdate,"%B ");
-    strftime(tempwidth,20,"%B ",&edit_time);
-  }
-  else if(clock_settings.date_ord1==2)
-  {
-    strcat(formatdate,"%Y ");
-    strftime(tempwidth,20,"%Y ",&edit_time);
-  }
-  uppertext(tempwidth);
-  w1=text_width(tempwidth);
-
-  if(clock_settings.date_ord2==0)
-  {
-    strcat(formatdate,"%d ");
-    strftime(tempwidth,20,"%d ",&edit_time);
-  }
-  else if(clock_settings.date_ord2==1)
-  {
-    strcat(formatdate,"%B ");
-    strftime(tempwidth,20,"%B ",&edit_time);
-  }
-  else if(clock_settings.date_ord2==2)
-  {
-    strcat(formatdate,"%Y ");
-    strftime(tempwidth,20,"%Y ",&edit_time);
-  }
-  uppertext(tempwidth);
-  w2=text_width(tempwidth);
+  time_text* tt=&edit_text;
+  timesvc_format(tt,&edit_time,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
 
-  if(clock_settings.date_ord3==0)
-  {
-    strcat(formatdate,"%d");
-    strftime(tempwidth,20,"%d",&edit_time);
-  }
-  else if(clock_settings.date_ord3==1)
-  {
-    strcat(formatdate,"%B");
-    strftime(tempwidth,20,"%B",&edit_time);
-  }
-  else if(clock_settings.date_ord3==2)
-  {
-    strcat(formatdate,"%Y");
-    strftime(tempwidth,20,"%Y",&edit_time);
-  }
-  uppertext(tempwidth);
-  w3=text_width(tempwidth);
+  // time
+  draw_digits(font2,tt->time,x+17,y+40,255,255,0);
 
-  strftime(datetext,80,formatdate,&edit_time);
-  uppertext(datetext);
-  if(lang==1)
-    replace_string(datetext,monthsname[0][edit_time.tm_mon],monthsname[1][edit_time.tm_mon]);
-  int tw=text_width(datetext);
-  draw_text(screen,font,datetext,x+(150-tw)/2,y+80,255,255,0);
+  // date, and width of each part for the arrows
+  int w1=text_width(tt->part[0]);
+  int w2=text_width(tt->part[1]);
+  int w3=text_width(tt->part[2]);
+  int tw=text_width(tt->date);
+  draw_text(screen,font,tt->date,x+(150-tw)/2,y+80,255,255,0);
 
   // AM/PM
-  char amtext[20];
   if(!clock_settings.format_24)
-  {
-    strftime(amtext,20,"%p",&edit_time);
-    draw_text(screen,font,amtext,x+120,y+56,128,128,0);
-  }
+    draw_text(screen,font,tt->ampm,x+120,y+56,128,128,0);
   else
     draw_text(screen,font,(char*)"24h",x+120,y+56,30,30,30);
 
   // seconds
-  char sectext[20];
-  strftime(sectext,20,":%S",&edit_time);
-  draw_text(screen,font,sectext,x+120,y+40,128,128,0);
+  draw_text(screen,font,tt->seconds,x+120,y+40,128,128,0);
 
   // calculate date arrows position
   editclock_pos[4].x=x+((150-tw)/2)+(w1/2)-5;
@@ -792,133 +849,60 @@ void draw_edittime(int x, int y)
   SDL_Rect dest;
   dest.x=editclock_pos[editclock_index].x;
   dest.y=editclock_pos[editclock_index].y;
-  if(img_arrows[0])
-    SDL_BlitSurface(img_arrows[0],NULL,screen,&dest);
+  draw_sprite(screen,&img_arrows[0],dest.x,dest.y);
   dest.x=editclock_pos[editclock_index].x2;
   dest.y=editclock_pos[editclock_index].y2;
-  if(img_arrows[1])
-    SDL_BlitSurface(img_arrows[1],NULL,screen,&dest);
+  draw_sprite(screen,&img_arrows[1],dest.x,dest.y);
 }
 
 ///////////////////////////////////
-/*  Draw a clock at position x,y */
+/*  Bake clock body in surface   */
 ///////////////////////////////////
-void draw_clock(int x, int y)
+void bake_clock(SDL_Surface* dst, int theme)
 {
-// 100,80
+  const clock_theme* t=&themes[theme];
   SDL_Color color;
-  SDL_Color border;
+  SDL_Color key={255,0,255,0};
+
+  // magenta is transparent
+  fill_rect(dst,NULL,&key);
 
   // up
-  border.r=225;
-  border.g=65;
-  border.b=65;
-  color.r=120;
-  color.g=132;
-  color.b=171;
-  draw_rectangle(x,y,150,22,&color,BORDER_ROUNDED,&color);
+  color=t->top;
+  draw_rectangle(dst,0,0,150,22,&color,BORDER_ROUNDED,&color);
   // front
-  color.r=62;
-  color.g=55;
-  color.b=92;
-  draw_rectangle(x,y+20,150,90,&color,BORDER_SINGLE,&color);
+  color=t->front;
+  draw_rectangle(dst,0,20,150,90,&color,BORDER_SINGLE,&color);
   // inner
   color.r=23;
   color.g=17;
   color.b=26;
-  draw_rectangle(x+10,y+30,130,70,&color);
+  draw_rectangle(dst,10,30,130,70,&color);
   // inner shadows
   color.r=55;
   color.g=37;
   color.b=56;
-  draw_rectangle(x+10,y+30,2,70,&color);
-  draw_rectangle(x+10,y+30,130,2,&color);
+  draw_rectangle(dst,10,30,2,70,&color);
+  draw_rectangle(dst,10,30,130,2,&color);
   //button
-  color.r=122;
-  color.g=33;
-  color.b=58;
-  draw_rectangle(x+60,y+5,30,10,&color,BORDER_ROUNDED,&color);
-  color.r=225;
-  color.g=65;
-  color.b=65;
-  draw_rectangle(x+60,y+2,30,10,&color,BORDER_ROUNDED,&color);
+  color=t->button_shadow;
+  draw_rectangle(dst,60,5,30,10,&color,BORDER_ROUNDED,&color);
+  color=t->button;
+  draw_rectangle(dst,60,2,30,10,&color,BORDER_ROUNDED,&color);
+
+  SDL_SetColorKey(dst,SDL_SRCCOLORKEY|SDL_RLEACCEL,SDL_MapRGB(dst->format,255,0,255));
 }
 
 ///////////////////////////////////
 /*  Draw a clock at position x,y */
 ///////////////////////////////////
-void draw_alarm(int x, int y)
+void draw_clock(int x, int y, int theme=THEME_CLOCK)
 {
 // 100,80
-  SDL_Color color;
-
-  // up
-  color.r=225;
-  color.g=65;
-  color.b=65;
-  draw_rectangle(x,y,150,22,&color,BORDER_ROUNDED,&color);
-  // front
-  color.r=122;
-  color.g=33;
-  color.b=58;
-  draw_rectangle(x,y+20,150,90,&color,BORDER_SINGLE,&color);
-  // inner
-  color.r=23;
-  color.g=17;
-  color.b=26;
-  draw_rectangle(x+10,y+30,130,70,&color);
-  // inner shadows
-  color.r=55;
-  color.g=37;
-  color.b=56;
-  draw_rectangle(x+10,y+30,2,70,&color);
-  draw_rectangle(x+10,y+30,130,2,&color);
-  //button
-  color.r=164;
-  color.g=164;
-  color.b=164;
-  draw_rectangle(x+60,y+5,30,10,&color,BORDER_ROUNDED,&color);
-  color.r=255;
-  color.g=255;
-  color.b=255;
-  draw_rectangle(x+60,y+2,30,10,&color,BORDER_ROUNDED,&color);
-}
-
-///////////////////////////////////
-/*  Clear values from joystick   */
-/*  structure                    */
-///////////////////////////////////
-void clear_joystick_state()
-{
-  mainjoystick.j1_left=0;
-  mainjoystick.j1_right=0;
-  mainjoystick.j1_up=0;
-  mainjoystick.j1_down=0;
-  mainjoystick.button_l3=FALSE;
-  mainjoystick.j2_left=0;
-  mainjoystick.j2_right=0;
-  mainjoystick.j2_up=0;
-  mainjoystick.j2_down=0;
-  mainjoystick.button_r3=FALSE;
-  mainjoystick.pad_left=FALSE;
-  mainjoystick.pad_right=FALSE;
-  mainjoystick.pad_up=FALSE;
-  mainjoystick.pad_down=FALSE;
-  mainjoystick.button_a=FALSE;
-  mainjoystick.button_b=FALSE;
-  mainjoystick.button_x=FALSE;
-  mainjoystick.button_y=FALSE;
-  mainjoystick.button_l1=FALSE;
-  mainjoystick.button_l2=FALSE;
-  mainjoystick.button_r1=FALSE;
-  mainjoystick.button_r2=FALSE;
-  mainjoystick.button_select=FALSE;
-  mainjoystick.button_start=FALSE;
-  mainjoystick.button_power=FALSE;
-  mainjoystick.button_voldown=FALSE;
-  mainjoystick.button_volup=FALSE;
-  mainjoystick.escape=FALSE;
-  mainjoystick.any=FALSE;
+  layer_key key={0,0,0,0,theme,0,0};
+  if(layer_prepare(&layer_body,150,110,&key))
+    bake_clock(layer_body.surface,theme);
+  draw_layer(&layer_body,x,y);
 }
 
 ///////////////////////////////////
@@ -930,95 +914,295 @@ void load_imgalpha(const char* file, SDL_Surface *&dstsurface)
 
   tmpsurface=IMG_Load(file);
   if(tmpsurface)
-  {
-    dstsurface=SDL_CreateRGBSurface(SDL_SRCCOLORKEY, tmpsurface->w, tmpsurface->h, 16, 0,0,0,0);
-    SDL_BlitSurface(tmpsurface,NULL,dstsurface,NULL);
-    SDL_SetColorKey(dstsurface,SDL_SRCCOLORKEY,SDL_MapRGB(screen->format,255,0,255));
-    SDL_FreeSurface(tmpsurface);
-  }
+    dstsurface=sprite_convert(tmpsurface);
 }
 
 ///////////////////////////////////
 /*  Init the app                 */
 ///////////////////////////////////
-void init_game()
+void default_config()
 {
   clock_settings.format_24=TRUE;
   clock_settings.mon_first=TRUE;
   clock_settings.date_ord1=0;
   clock_settings.date_ord2=1;
   clock_settings.date_ord3=2;
+  clock_settings.analog=FALSE;
+  clock_settings.idle_timeout=120;
+  clock_settings.idle_dim=10;
+  clock_settings.idle_seconds=FALSE;
+}
 
-  time_t now=time(0);
-  tm* timeinfo;
-  timeinfo=localtime(&now);
-  actual_calendar=*timeinfo;
+// only what the first frame needs, the rest is in init_deferred()
+// or opened on first use
+void init_game()
+{
+  timesvc_update();
+  actual_time=*timesvc_tm();
+  actual_calendar=actual_time;
 
   mode_app=MODE_CLOCK;
   // Initalizations
   srand(time(NULL));
-  SDL_JoystickEventState(SDL_ENABLE);
-  joystick=SDL_JoystickOpen(0);
   SDL_ShowCursor(0);
 
-  Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, AUDIO_S16, MIX_DEFAULT_CHANNELS, 1024);
-
+#ifdef BITMAP_FONTS
+  font=&bfont_pixelberry;
+  font2=&bfont_atomicclockradio;
+#else
   TTF_Init();
   font=TTF_OpenFontRW(SDL_RWFromMem(font_pixelberry,font_pixelberry_len),1, 8);
   font2=TTF_OpenFontRW(SDL_RWFromMem(font_atomicclockradio,font_atomicclockradio_len),1, 28);
-  font3=TTF_OpenFontRW(SDL_RWFromMem(font_audiowide,font_audiowide_len),1, 18);
-
-  // Graphics
-  SDL_Rect rect;
-  SDL_Surface* tmpsurface;
-  SDL_RWops *rw;
-
-  rw = SDL_RWFromMem(bmp_icons, bmp_icons_len);
-  tmpsurface=SDL_LoadBMP_RW(rw,TRUE);
-  for(int f=0; f<12; f++)
-  {
-    rect.x=f*10;
-    rect.y=0;
-    rect.w=10;
-    rect.h=10;
-    img_icons[f]=SDL_CreateRGBSurface(SDL_SRCCOLORKEY, rect.w, rect.h, 16, 0,0,0,0);
-    SDL_BlitSurface(tmpsurface,&rect,img_icons[f],NULL);
-    SDL_SetColorKey(img_icons[f],SDL_SRCCOLORKEY,SDL_MapRGB(screen->format,255,0,255));
-  }
-  SDL_FreeSurface(tmpsurface);
-
-  rw = SDL_RWFromMem(bmp_arrows, bmp_arrows_len);
-  tmpsurface=SDL_LoadBMP_RW(rw,TRUE);
-  for(int f=0; f<2; f++)
-  {
-    rect.x=f*10;
-    rect.y=0;
-    rect.w=10;
-    rect.h=10;
-    img_arrows[f]=SDL_CreateRGBSurface(SDL_SRCCOLORKEY, rect.w, rect.h, 16, 0,0,0,0);
-    SDL_BlitSurface(tmpsurface,&rect,img_arrows[f],NULL);
-    SDL_SetColorKey(img_arrows[f],SDL_SRCCOLORKEY,SDL_MapRGB(screen->format,255,0,255));
-  }
-  SDL_FreeSurface(tmpsurface);
-
-  rw = SDL_RWFromMem(bmp_buttons, bmp_buttons_len);
-  tmpsurface=SDL_LoadBMP_RW(rw,TRUE);
-  for(int f=0; f<14; f++)
-  {
-    rect.x=f*10;
-    rect.y=0;
-    rect.w=10;
-    rect.h=10;
-    img_buttons[f]=SDL_CreateRGBSurface(SDL_SRCCOLORKEY, rect.w, rect.h, 16, 0,0,0,0);
-    SDL_BlitSurface(tmpsurface,&rect,img_buttons[f],NULL);
-    SDL_SetColorKey(img_buttons[f],SDL_SRCCOLORKEY,SDL_MapRGB(screen->format,255,0,255));
-  }
-  SDL_FreeSurface(tmpsurface);
+#endif
+  catalog_font(CAT_TEXT,font);            // widths of all texts, once
+  SDL_Color digits_color={255,255,0};
+  digitstrip_get(font2,digits_color);     // big clock digits, rendered once
+
+  stopwatch_reset(&timer_sw);
+  countdown_set(&timer_cd,5*60*STOPWATCH_NS);
+
+  // Graphics, one sheet per image, sprites are rects in it
+  sheet_icons=sprite_load_sheet(SDL_RWFromMem(bmp_icons, bmp_icons_len));
+  sprite_slice(sheet_icons,img_icons,14,10,10);
+  sheet_arrows=sprite_load_sheet(SDL_RWFromMem(bmp_arrows, bmp_arrows_len));
+  sprite_slice(sheet_arrows,img_arrows,2,10,10);
+  sheet_buttons=sprite_load_sheet(SDL_RWFromMem(bmp_buttons, bmp_buttons_len));
+  sprite_slice(sheet_buttons,img_buttons,14,10,10);
 
   // Load sounds
   //sound_tone=Mix_LoadWAV("media/tone.wav");
 }
 
+///////////////////////////////////
+/*  Init after first frame       */
+///////////////////////////////////
+void init_deferred()
+{
+  deferred_done=TRUE;
+  if(SDL_InitSubSystem(SDL_INIT_JOYSTICK)==0)
+  {
+    SDL_JoystickEventState(SDL_ENABLE);
+    joystick=SDL_JoystickOpen(0);
+  }
+  world_load();
+}
+
+///////////////////////////////////
+/*  Resources on first use       */
+///////////////////////////////////
+// calendar numbers
+void load_font3()
+{
+  if(!font3)
+#ifdef BITMAP_FONTS
+    font3=&bfont_audiowide;
+#else
+    font3=TTF_OpenFontRW(SDL_RWFromMem(font_audiowide,font_audiowide_len),1, 18);
+#endif
+}
+
+// only alarms make sound
+int init_audio()
+{
+  if(!audio_ready && SDL_InitSubSystem(SDL_INIT_AUDIO)==0)
+  {
+    if(Mix_OpenAudio(MIX_DEFAULT_FREQUENCY, AUDIO_S16, MIX_DEFAULT_CHANNELS, 1024)==0)
+      audio_ready=TRUE;
+    else
+      SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  }
+  return audio_ready;
+}
+
+///////////////////////////////////
+/*  Alarm sound                  */
+///////////////////////////////////
+// two short beeps in one second, synthesized for the opened format
+Mix_Chunk* make_tone()
+{
+  int freq, channels;
+  Uint16 format;
+  if(!Mix_QuerySpec(&freq,&format,&channels) || format!=AUDIO_S16SYS)
+    return NULL;
+
+  tone_samples=new Sint16[freq*channels];
+  for(int f=0; f<freq; f++)
+  {
+    double t=(double)f/freq;
+    double bt=(t<0.25)?t:t-0.25;      // time in the beep
+    Sint16 sample=0;
+    if(t<0.37 && bt<0.12)
+    {
+      double env=1;                   // 5 ms ramps, no clicks
+      if(bt<0.005)
+        env=bt/0.005;
+      else if(bt>0.115)
+        env=(0.12-bt)/0.005;
+      sample=(Sint16)(sin(2*M_PI*TONE_HZ*t)*env*TONE_VOLUME);
+    }
+    for(int c=0; c<channels; c++)
+      tone_samples[f*channels+c]=sample;
+  }
+
+  Mix_Chunk* chunk=Mix_QuickLoad_RAW((Uint8*)tone_samples,freq*channels*sizeof(Sint16));
+  if(!chunk)
+  {
+    delete[] tone_samples;
+    tone_samples=NULL;
+  }
+  return chunk;
+}
+
+void play_tone()
+{
+  if(init_audio())
+  {
+    if(!sound_tone)
+      sound_tone=make_tone();
+    if(sound_tone)
+      Mix_PlayChannel(0,sound_tone,-1);
+  }
+}
+
+void stop_tone()
+{
+  if(audio_ready)
+    Mix_HaltChannel(-1);
+}
+
+void start_ringing(int i, time_t now)
+{
+  alarm_ringing=i;
+  alarm_index=i;
+  alarm_ring_start=now;
+  mode_app=MODE_ALARM;
+  edit_mode=FALSE;
+  play_tone();
+}
+
+void stop_ringing()
+{
+  alarm_ringing=ALARM_NONE;
+  if(!timer_ringing)
+    stop_tone();
+}
+
+void stop_timer_ringing()
+{
+  timer_ringing=FALSE;
+  if(alarm_ringing==ALARM_NONE)
+    stop_tone();
+}
+
+// every frame, after reading the clock
+void check_alarms()
+{
+  time_t now=timesvc_now();
+  int changed=FALSE;
+  int i=alarm_check(now,&changed);
+  if(changed)
+    save_alarms();      // one shot alarm off, also after a restart
+  if(i!=ALARM_NONE)
+    start_ringing(i,now);
+  else if(alarm_ringing!=ALARM_NONE && now-alarm_ring_start>=ALARM_RING_SECONDS)
+    stop_ringing();
+
+  // countdown end, on the monotonic clock
+  if(countdown_check(&timer_cd,mono_now()))
+  {
+    timer_ringing=TRUE;
+    timer_ring_start=mono_now();
+    if(alarm_ringing==ALARM_NONE)
+    {
+      mode_app=MODE_TIMER;
+      edit_mode=FALSE;
+    }
+    play_tone();
+  }
+  else if(timer_ringing && mono_now()-timer_ring_start>=ALARM_RING_SECONDS*STOPWATCH_NS)
+    stop_timer_ringing();
+}
+
+///////////////////////////////////
+/*  Startup time                 */
+///////////////////////////////////
+double startup_ms()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (ts.tv_sec-startup_begin.tv_sec)*1000.0+(ts.tv_nsec-startup_begin.tv_nsec)/1000000.0;
+}
+
+void print_startup()
+{
+  fprintf(stderr,"startup: video %.1f ms, config %.1f ms, init %.1f ms, first frame %.1f ms\n",
+          startup_video,startup_config,startup_init,startup_first_frame);
+}
+
+///////////////////////////////////
+/*  Print performance counters   */
+///////////////////////////////////
+volatile sig_atomic_t stats_requested=FALSE;
+
+void stats_signal(int sig)
+{
+  stats_requested=TRUE;
+  sched_wake();
+}
+
+///////////////////////////////////
+/*  Quit on kill or Ctrl+C       */
+///////////////////////////////////
+volatile sig_atomic_t quit_requested=FALSE;
+
+// backlight back at once, the loop ends at the next frame and a
+// second signal kills
+void quit_signal(int sig)
+{
+  power_restore();
+  quit_requested=TRUE;
+  signal(sig,SIG_DFL);
+  sched_wake();
+}
+
+void dump_stats()
+{
+  print_startup();
+
+  Uint32 hits,misses;
+  glyphcache_stats(&hits,&misses);
+  fprintf(stderr,"glyph cache: %u hits, %u misses, %s blending\n",hits,misses,blend_kernel());
+
+  Uint32 frames,rects,pixels;
+  render_stats(&frames,&rects,&pixels);
+  fprintf(stderr,"render: %u frames updated, %u rects, %u pixels\n",frames,rects,pixels);
+
+  world_stats(&hits,&misses);
+  fprintf(stderr,"world clock: %u offsets cached, %u searched\n",hits,misses);
+
+  Uint32 wakeups,loops;
+  double seconds;
+  sched_stats(&wakeups,&loops,&seconds);
+  if(seconds<=0)
+    seconds=1;
+  fprintf(stderr,"scheduler: %u wakeups, %u frames in %.1f s (%.2f wakeups/s, %.2f frames/s)\n",wakeups,loops,seconds,wakeups/seconds,loops/seconds);
+
+  double spent[POWER_STATES];
+  Uint32 idles;
+  power_stats(mono_now(),spent,&idles);
+  fprintf(stderr,"power: %.1f s active, %.1f s idle, idle %u times\n",spent[POWER_ACTIVE],spent[POWER_IDLE],idles);
+#ifdef PROFILE
+  prof_dump();
+#endif
+#ifdef LATENCY
+  // histograms to latency.txt next to settings.ini
+  char path[500];
+  lat_dump();
+  config_path(path,"latency.txt",TRUE);
+  lat_save(path);
+#endif
+}
+
 ///////////////////////////////////
 /*  Finish app, free memory      */
 ///////////////////////////////////
@@ -1026,335 +1210,177 @@ void end_game()
 {
   SDL_FillRect(screen, NULL, 0x000000);
 
-  if(SDL_JoystickOpened(0))
+  if(joystick)
     SDL_JoystickClose(joystick);
 
   // Free graphics
-  for(int f=0; f<12; f++)
-    if(img_icons[f])
-      SDL_FreeSurface(img_icons[f]);
-  for(int f=0; f<2; f++)
-    if(img_arrows[f])
-      SDL_FreeSurface(img_arrows[f]);
+  free_layer(&layer_body);
+  free_layer(&layer_hints);
+  free_layer(&layer_cal);
+  free_layer(&layer_dial);
+  if(sheet_icons)
+    SDL_FreeSurface(sheet_icons);
+  if(sheet_arrows)
+    SDL_FreeSurface(sheet_arrows);
+  if(sheet_buttons)
+    SDL_FreeSurface(sheet_buttons);
+
+  dump_stats();
+  power_close();
+  rtc_close();
+  sched_close();
+
+  // Free text cache
+  digitstrip_free();
+  glyphcache_free();
+  world_free();
+  catalog_free();
 
   // Free sounds
-  Mix_HaltChannel(-1);
-  Mix_FreeChunk(sound_tone);
-  Mix_CloseAudio(); 
+  if(audio_ready)
+  {
+    Mix_HaltChannel(-1);
+    if(sound_tone)
+      Mix_FreeChunk(sound_tone);
+    Mix_CloseAudio();
+  }
+  if(tone_samples)
+    delete[] tone_samples;
   
   SDL_Quit();
 }
 
 ///////////////////////////////////
-/*  Process buttons events       */
+/*  Draw screen, console and     */
+/*  buttons                      */
 ///////////////////////////////////
-void process_events()
+void draw_mode_clock()
 {
-  SDL_Event event;
-  static int joy_pressed=FALSE;
-
-  while(SDL_PollEvent(&event))
+  if(!edit_mode && clock_settings.analog)
+    draw_analog(100,50);
+  else if(!edit_mode)
   {
-    switch(event.type)
-    {
-      case SDL_KEYDOWN:
-        switch(event.key.keysym.sym)
-        {
-          case GCW_BUTTON_LEFT:
-            mainjoystick.pad_left=TRUE;
-            break;
-          case GCW_BUTTON_RIGHT:
-            mainjoystick.pad_right=TRUE;
-            break;
-          case GCW_BUTTON_UP:
-            mainjoystick.pad_up=TRUE;
-            break;
-          case GCW_BUTTON_DOWN:
-            mainjoystick.pad_down=TRUE;
-            break;
-          case GCW_BUTTON_Y:
-            mainjoystick.button_y=TRUE;
-            break;
-          case GCW_BUTTON_X:
-            mainjoystick.button_x=TRUE;
-            break;
-          case GCW_BUTTON_B:
-            mainjoystick.button_b=TRUE;
-            break;
-          case GCW_BUTTON_A:
-            mainjoystick.button_a=TRUE;
-            break;
-          case GCW_BUTTON_L1:
-            mainjoystick.button_l1=TRUE;
-            break;
-          case GCW_BUTTON_L2:
-            mainjoystick.button_l2=TRUE;
-            break;
-          case GCW_BUTTON_R1:
-            mainjoystick.button_r1=TRUE;
-            break;
-          case GCW_BUTTON_R2:
-            mainjoystick.button_r2=TRUE;
-            break;
-          case GCW_BUTTON_L3:
-            mainjoystick.button_l3=TRUE;
-            break;
-          case GCW_BUTTON_R3:
-            mainjoystick.button_r3=TRUE;
-            break;
-          case GCW_BUTTON_SELECT:
-            mainjoystick.button_select=TRUE;
-            break;
-          case GCW_BUTTON_START:
-            mainjoystick.button_start=TRUE;
-            break;
-          // Volume Up and Volume Down can't be detected individual
-          case GCW_BUTTON_VOLUP:
-            mainjoystick.button_volup=TRUE;
-            mainjoystick.button_voldown=TRUE;
-            break;
-//          case GCW_BUTTON_VOLDOWN:
-//            mainjoystick.button_voldown=1;
-//            break;
-          case GCW_BUTTON_POWER:
-            mainjoystick.button_power=TRUE;
-            break;
-        }
-        mainjoystick.any=TRUE;
-        break;
-      case SDL_JOYAXISMOTION:
-        if(joy_pressed && SDL_JoystickGetAxis(joystick,0)>-GCW_JOYSTICK_DEADZONE && SDL_JoystickGetAxis(joystick,0)<GCW_JOYSTICK_DEADZONE && SDL_JoystickGetAxis(joystick,1)>-GCW_JOYSTICK_DEADZONE && SDL_JoystickGetAxis(joystick,1)<GCW_JOYSTICK_DEADZONE)
-        {
-          joy_pressed=FALSE;
-        }
-
-        if(!joy_pressed)
-        {
-            switch(event.jaxis.axis)
-            {
-              case 0:
-                if(event.jaxis.value<0)
-                {
-                  mainjoystick.j1_left=event.jaxis.value;
-                  mainjoystick.j1_right=0;
-                  if(event.jaxis.value<-GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                else
-                {
-                  mainjoystick.j1_right=event.jaxis.value;
-                  mainjoystick.j1_left=0;
-                  if(event.jaxis.value>GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                break;
-              case 1:
-                if(event.jaxis.value<0)
-                {
-                  mainjoystick.j1_up=event.jaxis.value;
-                  mainjoystick.j1_down=0;
-                  if(event.jaxis.value<-GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                else
-                {
-                  mainjoystick.j1_down=event.jaxis.value;
-                  mainjoystick.j1_up=0;
-                  if(event.jaxis.value>GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                break;
-              case 2:
-                if(event.jaxis.value<0)
-                {
-                  mainjoystick.j2_left=event.jaxis.value;
-                  mainjoystick.j2_right=0;
-                  if(event.jaxis.value<-GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                else
-                {
-                  mainjoystick.j2_right=event.jaxis.value;
-                  mainjoystick.j2_left=0;
-                  if(event.jaxis.value>GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                break;
-              case 3:
-                if(event.jaxis.value<0)
-                {
-                  mainjoystick.j2_up=event.jaxis.value;
-                  mainjoystick.j2_down=0;
-                  if(event.jaxis.value<-GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                else
-                {
-                  mainjoystick.j2_down=event.jaxis.value;
-                  mainjoystick.j2_up=0;
-                  if(event.jaxis.value>GCW_JOYSTICK_DEADZONE)
-                  {
-                    mainjoystick.any=TRUE;
-                    joy_pressed=TRUE;
-                  }
-                }
-                break;
-            }
-        }
-        break;
-      }
+    draw_clock(85,50);
+    draw_actualtime(85,50);
+  }
+  else
+  {
+    draw_clock(85,50);
+    draw_edittime(85,50);
   }
-}
 
-///////////////////////////////////
-/*  Process keyboard and joystick*/
-/*  (no events), and save in     */
-/*  mainjoystick variable        */
-///////////////////////////////////
-void process_joystick()
-{
-  SDL_Event event;
-  while(SDL_PollEvent(&event));
-
-  if(keys[GCW_BUTTON_B])
-    mainjoystick.button_b=TRUE;
-  if(keys[GCW_BUTTON_A])
-    mainjoystick.button_a=TRUE;
-  if(keys[GCW_BUTTON_Y])
-    mainjoystick.button_y=TRUE;
-  if(keys[GCW_BUTTON_X])
-    mainjoystick.button_x=TRUE;
-
-  if(keys[GCW_BUTTON_LEFT])
-    mainjoystick.pad_left=TRUE;
-  if(keys[GCW_BUTTON_RIGHT])
-    mainjoystick.pad_right=TRUE;
-  if(keys[GCW_BUTTON_UP])
-    mainjoystick.pad_up=TRUE;
-  if(keys[GCW_BUTTON_DOWN])
-    mainjoystick.pad_down=TRUE;
-
-  if(SDL_JoystickGetAxis(joystick,0)<-GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j1_left=SDL_JoystickGetAxis(joystick,0);
-  if(SDL_JoystickGetAxis(joystick,0)>GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j1_right=SDL_JoystickGetAxis(joystick,0);
-  if(SDL_JoystickGetAxis(joystick,1)<-GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j1_up=SDL_JoystickGetAxis(joystick,1);
-  if(SDL_JoystickGetAxis(joystick,1)>GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j1_down=SDL_JoystickGetAxis(joystick,1);
-  if(SDL_JoystickGetAxis(joystick,2)<-GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j2_left=SDL_JoystickGetAxis(joystick,2);
-  if(SDL_JoystickGetAxis(joystick,2)>GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j2_right=SDL_JoystickGetAxis(joystick,2);
-  if(SDL_JoystickGetAxis(joystick,3)<-GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j2_up=SDL_JoystickGetAxis(joystick,3);
-  if(SDL_JoystickGetAxis(joystick,3)>GCW_JOYSTICK_DEADZONE)
-    mainjoystick.j2_down=SDL_JoystickGetAxis(joystick,3);
-
-  /*if(keys[GCW_BUTTON_POWER])
-    mainjoystick.button_power=1;
-  if(keys[GCW_BUTTON_VOLUP])
-  {
-    mainjoystick.button_volup=1;
-    mainjoystick.button_voldown=1;
-  }
-  if(keys[GCW_BUTTON_VOLDOWN])
-  {
-    mainjoystick.button_volup=1;
-    mainjoystick.button_voldown=1;
-  }*/
-
-  if(keys[GCW_BUTTON_START])
-    mainjoystick.button_start=TRUE;
-  if(keys[GCW_BUTTON_SELECT])
-    mainjoystick.button_select=TRUE;
-
-  if(keys[GCW_BUTTON_L1])
-    mainjoystick.button_l1=TRUE;
-  if(keys[GCW_BUTTON_R1])
-    mainjoystick.button_r1=TRUE;
-  if(keys[GCW_BUTTON_L2])
-    mainjoystick.button_l2=TRUE;
-  if(keys[GCW_BUTTON_R2])
-    mainjoystick.button_r2=TRUE;
-
-  if(keys[GCW_BUTTON_L3])
-    mainjoystick.button_l3=TRUE;
-  if(keys[GCW_BUTTON_R3])
-    mainjoystick.button_r3=TRUE;
+  // last time set, until the RTC has it
+  int rtc=rtc_state();
+  if(rtc==RTC_BUSY || rtc==RTC_FAILED)
+  {
+    int id=rtc==RTC_BUSY?STR_SAVING_RTC:STR_RTC_NOT_SAVED;
+    draw_label(screen,id,160-catalog_width(id)/2,200,255,255,0);
+  }
 }
 
 ///////////////////////////////////
-/*  Draw screen, console and     */
-/*  buttons                      */
+/*  Clock buttons hints          */
 ///////////////////////////////////
-void draw_mode_clock()
+void draw_hints_clock(SDL_Surface* dst, int y)
 {
   SDL_Rect dest;
 
   if(!edit_mode)
   {
     // buttons in normal mode
-    draw_clock(85,50);
-    draw_actualtime(85,50);
-
     dest.x=75;
-    dest.y=230;
-    if(img_buttons[4])
-      SDL_BlitSurface(img_buttons[4],NULL,screen,&dest);
-    draw_text(screen,font,(char*)msg[lang][1],dest.x+10,dest.y,255,255,255);
+    dest.y=y;
+    draw_sprite(dst,&img_buttons[4],dest.x,dest.y);
+    draw_label(dst,STR_SET_TIME,dest.x+10,dest.y,255,255,255);
+
+    // the other face
+    dest.x+=20+catalog_width(STR_SET_TIME);
+    draw_sprite(dst,&img_buttons[9],dest.x,dest.y);
+    draw_label(dst,clock_settings.analog?STR_DIGITAL:STR_ANALOG,dest.x+10,dest.y,255,255,255);
   }
   else
   {
     // buttons in edit mode
-    draw_clock(85,50);
-    draw_edittime(85,50);
-
     dest.x=75;
-    dest.y=230;
-    if(img_buttons[6])
-      SDL_BlitSurface(img_buttons[6],NULL,screen,&dest);
-    draw_text(screen,font,(char*)msg[lang][2],dest.x+10,dest.y,255,255,255);
+    dest.y=y;
+    draw_sprite(dst,&img_buttons[6],dest.x,dest.y);
+    draw_label(dst,STR_ACCEPT,dest.x+10,dest.y,255,255,255);
 
-    dest.x=95+text_width((char*)msg[lang][2]);
-    if(img_buttons[7])
-      SDL_BlitSurface(img_buttons[7],NULL,screen,&dest);
-    draw_text(screen,font,(char*)msg[lang][3],dest.x+10,dest.y,255,255,255);
+    dest.x=95+catalog_width(STR_ACCEPT);
+    draw_sprite(dst,&img_buttons[7],dest.x,dest.y);
+    draw_label(dst,STR_CANCEL,dest.x+10,dest.y,255,255,255);
 
     if(editclock_index>=4 && editclock_index<=6)
     {
-      dest.x=95+text_width((char*)msg[lang][2])+20+text_width((char*)msg[lang][2]);
-      if(img_buttons[2])
-        SDL_BlitSurface(img_buttons[2],NULL,screen,&dest);
+      dest.x=95+catalog_width(STR_ACCEPT)+20+catalog_width(STR_ACCEPT);
+      draw_sprite(dst,&img_buttons[2],dest.x,dest.y);
       dest.x+=10;
-      if(img_buttons[3])
-        SDL_BlitSurface(img_buttons[3],NULL,screen,&dest);
-      draw_text(screen,font,(char*)msg[lang][4],dest.x+10,dest.y,255,255,255);
+      draw_sprite(dst,&img_buttons[3],dest.x,dest.y);
+      draw_label(dst,STR_MOVE,dest.x+10,dest.y,255,255,255);
     }
   }
 }
 
+///////////////////////////////////
+/*  Set date fields of a tm      */
+///////////////////////////////////
+// FALSE if the date is out of years first..last
+int set_tm_date(tm* t, civil_date c, int64_t first=1, int64_t last=9999)
+{
+  if(c.year<first || c.year>last)
+    return FALSE;
+  t->tm_year=(int)(c.year-1900);
+  t->tm_mon=c.month-1;
+  t->tm_mday=c.day;
+  t->tm_wday=civil_weekday(days_from_civil(c));
+  t->tm_yday=civil_yearday(c);
+  return TRUE;
+}
+
+civil_date tm_date(const tm* t)
+{
+  return civil_date(t->tm_year+1900,t->tm_mon+1,t->tm_mday);
+}
+
+///////////////////////////////////
+/*  Move edited time             */
+///////////////////////////////////
+// plain arithmetic instead of mktime, hours/minutes/seconds carry
+// into the date like before
+void step_edit_time(int seconds)
+{
+  int64_t t=days_from_civil(tm_date(&edit_time))*86400+edit_time.tm_hour*3600+edit_time.tm_min*60+edit_time.tm_sec+seconds;
+  int64_t z=civil_floor_div(t,86400);
+  int secs=(int)(t-z*86400);
+
+  if(set_tm_date(&edit_time,civil_from_days(z),EDIT_YEAR_FIRST,EDIT_YEAR_LAST))
+  {
+    edit_time.tm_hour=secs/3600;
+    edit_time.tm_min=(secs/60)%60;
+    edit_time.tm_sec=secs%60;
+  }
+}
+
+// order: 0=day, 1=month, 2=year (as date_ord)
+void step_edit_date(int order, int dir)
+{
+  civil_date c=tm_date(&edit_time);
+
+  switch(order)
+  {
+    case 0:
+      c=civil_from_days(days_from_civil(c)+dir);
+      break;
+    case 1:
+      c=civil_add_months(c,dir);
+      break;
+    case 2:
+      c=civil_add_years(c,dir);
+      break;
+  }
+  set_tm_date(&edit_time,c,EDIT_YEAR_FIRST,EDIT_YEAR_LAST);
+}
+
 ///////////////////////////////////
 /*  Check buttons, update actions*/
 ///////////////////////////////////
@@ -1364,7 +1390,7 @@ void update_mode_clock()
   if(!edit_mode)
   {
     // actions in normal mode
-    if(mainjoystick.button_select)
+    if(input_pressed(BTN_SELECT))
     {
       edit_mode=TRUE;
       edit_time.tm_year=actual_time.tm_year;
@@ -1377,159 +1403,78 @@ void update_mode_clock()
 
       clock_previous=clock_settings;
     }
+    if(input_pressed(BTN_Y))
+      clock_settings.analog=!clock_settings.analog;
   }
   else
   {
     // actions in edit mode
-    if(mainjoystick.button_b)
+    if(input_pressed(BTN_B))
     {
       edit_mode=FALSE;
       clock_settings.date_ord1=clock_previous.date_ord1;
       clock_settings.date_ord2=clock_previous.date_ord2;
       clock_settings.date_ord3=clock_previous.date_ord3;
     }
-    if(mainjoystick.button_a)
+    if(input_pressed(BTN_A))
     {
       time_t t=mktime(&edit_time);
-      
-      if(t!=(time_t)(-1))
+
+      if(t==(time_t)(-1) || stime(&t)!=0)
+        fprintf(stderr,"clock: can't set the time to %04d-%02d-%02d %02d:%02d:%02d\n",edit_time.tm_year+1900,
+                edit_time.tm_mon+1,edit_time.tm_mday,edit_time.tm_hour,edit_time.tm_min,edit_time.tm_sec);
+      else
       {
-        stime(&t);
-        system("hwclock --systohc --utc");
+        rtc_write();      // on a thread, hwclock took a whole frame or more
+        alarm_time_changed(t);
+        actual_calendar=edit_time;
       }
-      actual_calendar=edit_time;
       edit_mode=FALSE;
     }
-    if(mainjoystick.pad_right)
+    if(input_repeated(BTN_RIGHT))
     {
       editclock_index++;
       if(editclock_index>6)
         editclock_index=0;
     }
-    if(mainjoystick.pad_left)
+    if(input_repeated(BTN_LEFT))
     {
       editclock_index--;
       if(editclock_index<0)
         editclock_index=6;
     }
-    if(mainjoystick.pad_down)
-    {
-      switch(editclock_index)
-      {
-        case 0:
-          edit_time.tm_hour-=1;
-          mktime(&edit_time);
-          break;
-        case 1:
-          edit_time.tm_min-=1;
-          mktime(&edit_time);
-          break;
-        case 2:
-          edit_time.tm_sec-=1;
-          mktime(&edit_time);
-          break;
-        case 3:
-          clock_settings.format_24=!clock_settings.format_24;
-          mktime(&edit_time);
-          break;
-        case 4:
-          if(clock_settings.date_ord1==0)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0 && edit_time.tm_mday==1))
-              edit_time.tm_mday-=1;
-          if(clock_settings.date_ord1==1)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0))
-              edit_time.tm_mon-=1;
-          if(clock_settings.date_ord1==2)
-            if(edit_time.tm_year>0)
-              edit_time.tm_year-=1;
-          mktime(&edit_time);
-          break;
-        case 5:
-          if(clock_settings.date_ord2==0)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0 && edit_time.tm_mday==1))
-              edit_time.tm_mday-=1;
-          if(clock_settings.date_ord2==1)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0))
-              edit_time.tm_mon-=1;
-          if(clock_settings.date_ord2==2)
-            if(edit_time.tm_year>0)
-              edit_time.tm_year-=1;
-          mktime(&edit_time);
-          break;
-        case 6:
-          if(clock_settings.date_ord3==0)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0 && edit_time.tm_mday==1))
-              edit_time.tm_mday-=1;
-          if(clock_settings.date_ord3==1)
-            if(!(edit_time.tm_year==0 && edit_time.tm_mon==0))
-              edit_time.tm_mon-=1;
-          if(clock_settings.date_ord3==2)
-            if(edit_time.tm_year>0)
-              edit_time.tm_year-=1;
-          mktime(&edit_time);
-          break;
-      }
-    }
-    if(mainjoystick.pad_up)
+    // held up/down repeat, one step per repeat
+    int dir=input_steps(BTN_UP)-input_steps(BTN_DOWN);
+    if(dir)
     {
       switch(editclock_index)
       {
         case 0:
-          edit_time.tm_hour+=1;
-          mktime(&edit_time);
+          step_edit_time(dir*3600);
           break;
         case 1:
-          edit_time.tm_min+=1;
-          mktime(&edit_time);
+          step_edit_time(dir*60);
           break;
         case 2:
-          edit_time.tm_sec+=1;
-          mktime(&edit_time);
+          step_edit_time(dir);
           break;
         case 3:
-          clock_settings.format_24=!clock_settings.format_24;
-          mktime(&edit_time);
+          if(input_pressed(BTN_UP|BTN_DOWN))
+            clock_settings.format_24=!clock_settings.format_24;
           break;
         case 4:
-          if(clock_settings.date_ord1==0)
-            if(!(edit_time.tm_year==(2037-1900) && edit_time.tm_mon==11 && edit_time.tm_mday==31))
-              edit_time.tm_mday+=1;
-          if(clock_settings.date_ord1==1)
-            if(!(edit_time.tm_year==(2037-1900) && edit_time.tm_mon==11))
-              edit_time.tm_mon+=1;
-          if(clock_settings.date_ord1==2)
-            if(edit_time.tm_year<(2037-1900))
-              edit_time.tm_year+=1;
-          mktime(&edit_time);
+          step_edit_date(clock_settings.date_ord1,dir);
           break;
         case 5:
-          if(clock_settings.date_ord2==0)
-            if(!(edit_time.tm_year==(2037-1900) && edit_time.tm_mon==11 && edit_time.tm_mday==31))
-              edit_time.tm_mday+=1;
-          if(clock_settings.date_ord2==1)
-            if(!(edit_time.tm_year==(2037-1900) && edit_time.tm_mon==11))
-              edit_time.tm_mon+=1;
-          if(clock_settings.date_ord2==2)
-            if(edit_time.tm_year<(2037-1900))
-              edit_time.tm_year+=1;
-          mktime(&edit_time);
+          step_edit_date(clock_settings.date_ord2,dir);
           break;
         case 6:
-          if(clock_settings.date_ord3==0)
-            if(!(edit_time.tm_year==(2038-1900) && edit_time.tm_mon==11 && edit_time.tm_mday==31))
-              edit_time.tm_mday+=1;
-          if(clock_settings.date_ord3==1)
-            if(!(edit_time.tm_year==(2037-1900) && edit_time.tm_mon==11))
-              edit_time.tm_mon+=1;
-          if(clock_settings.date_ord3==2)
-            if(edit_time.tm_year<(2037-1900))
-              edit_time.tm_year+=1;
-          mktime(&edit_time);
+          step_edit_date(clock_settings.date_ord3,dir);
           break;
       }
     }
     int tmp;
-    if(mainjoystick.button_l2)
+    if(input_pressed(BTN_L2))
     {
       switch(editclock_index)
       {
@@ -1547,7 +1492,7 @@ void update_mode_clock()
           break;
       }
     }
-    if(mainjoystick.button_r2)
+    if(input_pressed(BTN_R2))
     {
       switch(editclock_index)
       {
@@ -1569,33 +1514,77 @@ void update_mode_clock()
 }
 
 ///////////////////////////////////
-/*  Draw calendar                */
+/*  Calculate month layout       */
 ///////////////////////////////////
-void draw_mode_cal()
+// only when month or first day of week change, not every frame
+void calc_month_layout()
 {
-  tm tmptime;
-  tmptime=actual_calendar;
-  tmptime.tm_mday=1;
-  tmptime.tm_isdst=-1;
-  mktime(&tmptime);
-
-  if(clock_settings.mon_first && tmptime.tm_wday!=1)
-  {
-    int d=tmptime.tm_wday;
-    if(d==0)
-      d=6;
-    else
-      d--;
-    tmptime.tm_mday-=d;   // begin from first day of the week (monday begin)
-    tmptime.tm_isdst=-1;
-    mktime(&tmptime);
-  }
-  else if(!clock_settings.mon_first && tmptime.tm_wday!=0)
+  month_layout* ml=&cal_layout;
+
+  ml->year=actual_calendar.tm_year;
+  ml->mon=actual_calendar.tm_mon;
+  ml->mon_first=clock_settings.mon_first;
+
+  // first day of the month, days of this and previous month
+  int64_t y=ml->year+1900;
+  unsigned m=ml->mon+1;
+  int wday=civil_weekday(days_from_civil(y,m,1));
+  int days=civil_days_in_month(y,m);
+  civil_date prev=civil_add_months(civil_date(y,m,1),-1);
+  int prevdays=civil_days_in_month(prev.year,prev.month);
+
+  // begin from first day of the week (monday or sunday)
+  int offset=wday;
+  if(ml->mon_first)
+    offset=(wday+6)%7;
+
+  ml->cells=((offset+days+6)/7)*7;
+  for(int f=0; f<ml->cells; f++)
   {
-    tmptime.tm_mday-=tmptime.tm_wday; // begin from first day of the week (sunday begins)
-    tmptime.tm_isdst=-1;
-    mktime(&tmptime);
+    int d=f-offset+1;
+    ml->inmonth[f]=TRUE;
+    if(d<1)
+    {
+      d+=prevdays;
+      ml->inmonth[f]=FALSE;
+    }
+    else if(d>days)
+    {
+      d-=days;
+      ml->inmonth[f]=FALSE;
+    }
+    ml->day[f]=d;
+    ml->sunday[f]=((f+(ml->mon_first?1:0))%7==0);
   }
+  ml->first_day=ml->day[0];
+  ml->valid=TRUE;
+}
+
+///////////////////////////////////
+/*  Today cell in layout         */
+///////////////////////////////////
+void calc_month_today()
+{
+  month_layout* ml=&cal_layout;
+
+  ml->today=-1;
+  if(cal_today.tm_year!=ml->year || cal_today.tm_mon!=ml->mon)
+    return;
+  for(int f=0; f<ml->cells; f++)
+    if(ml->inmonth[f] && ml->day[f]==cal_today.tm_mday)
+      ml->today=f;
+}
+
+///////////////////////////////////
+/*  Bake calendar in surface     */
+///////////////////////////////////
+// surface origin is screen 48,14
+void bake_calendar(SDL_Surface* dst)
+{
+  load_font3();
+  month_layout* ml=&cal_layout;
+
+  fill_rect(dst,NULL,&color_background);
 
   // cells 32x24
   SDL_Color col,bor;
@@ -1605,32 +1594,23 @@ void draw_mode_cal()
   bor.r=55;
   bor.g=37;
   bor.b=56;
-  //draw_rectangle(48,24,224,168,&col,BORDER_SINGLE,&bor);
+  //draw_rectangle(dst,0,10,224,168,&col,BORDER_SINGLE,&bor);
 
-  int inmonth;
-  if(tmptime.tm_mday==1)
-    inmonth=1;
-  else
-    inmonth=0;
-  int x=48, y=24, tday=0;
+  int x=0, y=10;
 
   // print days name
   int fday;
-  if(clock_settings.mon_first)
+  if(ml->mon_first)
     fday=1;
   else
     fday=0;
   for(int f=0; f<7; f++)
   {
-    SDL_Color ccc;
-    ccc.r=55;
-    ccc.g=37;
-    ccc.b=56;
-    draw_rectangle(x+(32*f),y,32,11,&ccc);
-    if((clock_settings.mon_first && f==6) || (!clock_settings.mon_first && f==0))
-      draw_text(screen,font,(char*)daysname[lang][fday],x+(32*f)+16-text_width((char*)daysname[lang][fday])/2,y+1,225,65,65);
+    draw_rectangle(dst,x+(32*f),y,32,11,&bor);
+    if((ml->mon_first && f==6) || (!ml->mon_first && f==0))
+      draw_label(dst,STR_SUNDAY+fday,x+(32*f)+16-catalog_width(STR_SUNDAY+fday)/2,y+1,225,65,65);
     else
-      draw_text(screen,font,(char*)daysname[lang][fday],x+(32*f)+16-text_width((char*)daysname[lang][fday])/2,y+1,120,132,171);
+      draw_label(dst,STR_SUNDAY+fday,x+(32*f)+16-catalog_width(STR_SUNDAY+fday)/2,y+1,120,132,171);
     fday++;
     if(fday>6)
       fday=0;
@@ -1638,295 +1618,1155 @@ void draw_mode_cal()
 
   y=y+11;
   // print days
-  while(inmonth!=2 || (inmonth==2 && x!=48))
+  for(int f=0; f<ml->cells; f++)
   {
-    draw_rectangle(x,y,32,28,&col);
+    draw_rectangle(dst,x,y,32,28,&col);
     SDL_Color ccc;
     ccc.r=col.r-5;
     ccc.g=col.g-5;
     ccc.b=col.b-5;
-    draw_rectangle(x+31,y,1,28,&ccc);
+    draw_rectangle(dst,x+31,y,1,28,&ccc);
 
     char num[20];
-    sprintf(num,"%d",tmptime.tm_mday);
+    sprintf(num,"%d",ml->day[f]);
     int tx=x+16-text_width(num,font3)/2;
     int ty=y+5;
 
-    if(inmonth==1)
+    if(ml->inmonth[f])
     {
-      if(tmptime.tm_year==actual_time.tm_year && tmptime.tm_mon==actual_time.tm_mon && tmptime.tm_mday==actual_time.tm_mday)
-        draw_text(screen,font3,num,tx,ty,65,171,65);
-      else if(tmptime.tm_wday==0)
-        draw_text(screen,font3,num,tx,ty,225,65,65);
+      if(f==ml->today)
+        draw_text(dst,font3,num,tx,ty,65,171,65);
+      else if(ml->sunday[f])
+        draw_text(dst,font3,num,tx,ty,225,65,65);
       else
-        draw_text(screen,font3,num,tx,ty,23,17,26);
+        draw_text(dst,font3,num,tx,ty,23,17,26);
     }
     else
-      draw_text(screen,font3,num,tx,ty,120,132,171);
-
-    tmptime.tm_mday++;
-    tmptime.tm_isdst=-1;  // this avoid day jumps when reading lightsaving day
-    mktime(&tmptime);
-
-    if(tmptime.tm_mon==actual_calendar.tm_mon && inmonth==0)
-      inmonth=1;
-    if(tmptime.tm_mon!=actual_calendar.tm_mon && inmonth==1)
-      inmonth=2;
+      draw_text(dst,font3,num,tx,ty,120,132,171);
 
     x+=32;
-    if(x>30+(32*7))
+    if(x>=32*7)
     {
-      x=48;
+      x=0;
       y+=24;
     }
   }
 
   // name
-  char monthtext[20];
-  strftime(monthtext,20,"%B %Y",&actual_calendar);
-  uppertext(monthtext);
-  if(lang==1)
-    replace_string(monthtext,monthsname[0][actual_calendar.tm_mon],monthsname[1][actual_calendar.tm_mon]);
-  draw_text(screen,font,monthtext,160-text_width(monthtext)/2,14,255,255,255);
-
-  // buttons
-  SDL_Rect dest;
-  dest.y=230;
-  dest.x=75;//+text_width((char*)msg[lang][2])+20+text_width((char*)msg[lang][2]);
-  if(img_buttons[10])
-    SDL_BlitSurface(img_buttons[10],NULL,screen,&dest);
-  dest.x+=10;
-  if(img_buttons[11])
-    SDL_BlitSurface(img_buttons[11],NULL,screen,&dest);
-  draw_text(screen,font,(char*)msg[lang][5],dest.x+10,229,255,255,255);
-  dest.x=dest.x+10+text_width((char*)msg[lang][5])+10;
-
-  if(img_buttons[12])
-    SDL_BlitSurface(img_buttons[12],NULL,screen,&dest);
-  dest.x+=10;
-  if(img_buttons[13])
-    SDL_BlitSurface(img_buttons[13],NULL,screen,&dest);
-  draw_text(screen,font,(char*)msg[lang][6],dest.x+10,229,255,255,255);
-  dest.x=dest.x+10+text_width((char*)msg[lang][6])+10;
-
-  if(img_buttons[9])
-    SDL_BlitSurface(img_buttons[9],NULL,screen,&dest);
-  draw_text(screen,font,(char*)msg[lang][7],dest.x+10,229,255,255,255);
+  char monthtext[32];
+  snprintf(monthtext,32,"%s %d",catalog_str(STR_JANUARY+ml->mon),ml->year+1900);
+  draw_text(dst,font,monthtext,112-text_width(monthtext)/2,0,255,255,255);
 }
 
 ///////////////////////////////////
-/*  Update calendar              */
+/*  Draw calendar                */
 ///////////////////////////////////
-void update_mode_cal()
+void draw_mode_cal()
 {
-  if(mainjoystick.button_y)
-    clock_settings.mon_first=!clock_settings.mon_first;
-  if(mainjoystick.pad_left)
-  {
-    if(!(actual_calendar.tm_mon==0 && actual_calendar.tm_year==0))
-    {
-      actual_calendar.tm_mon--;
-      mktime(&actual_calendar);
-    }
-  }
-  if(mainjoystick.pad_right)
-  {
-    if(!(actual_calendar.tm_mon==11 && actual_calendar.tm_year==(2037-1900)))
-    {
-      actual_calendar.tm_mon++;
-      mktime(&actual_calendar);
-    }
-  }
-  if(mainjoystick.pad_down)
+  // today mark only changes at midnight
+  time_t now=timesvc_now();
+  if(now>=cal_midnight)
   {
-    if(actual_calendar.tm_year>0)
-    {
-      actual_calendar.tm_year--;
-      mktime(&actual_calendar);
-    }
+    localtime_r(&now,&cal_today);
+    tm midnight=cal_today;
+    midnight.tm_mday++;
+    midnight.tm_hour=0;
+    midnight.tm_min=0;
+    midnight.tm_sec=0;
+    midnight.tm_isdst=-1;
+    cal_midnight=mktime(&midnight);
+    calc_month_today();
   }
-  if(mainjoystick.pad_up)
+
+  month_layout* ml=&cal_layout;
+  if(!ml->valid || ml->year!=actual_calendar.tm_year || ml->mon!=actual_calendar.tm_mon || ml->mon_first!=clock_settings.mon_first)
   {
-    if(actual_calendar.tm_year<(2037-1900))    // if bigger, program crash
-    {
-      actual_calendar.tm_year++;
-      mktime(&actual_calendar);
-    }
+    calc_month_layout();
+    calc_month_today();
   }
+
+  layer_key key={MODE_CAL,lang,0,ml->mon_first,0,ml->year*12+ml->mon,ml->today};
+  if(layer_prepare(&layer_cal,224,170,&key))
+    bake_calendar(layer_cal.surface);
+  draw_layer(&layer_cal,48,14);
 }
 
 ///////////////////////////////////
-/*  Draw alarm                   */
+/*  Calendar buttons hints       */
 ///////////////////////////////////
-void draw_mode_alarm()
+void draw_hints_cal(SDL_Surface* dst, int y)
 {
   SDL_Rect dest;
+  dest.y=y;
+  dest.x=75;//+catalog_width(STR_ACCEPT)+20+catalog_width(STR_ACCEPT);
+  draw_sprite(dst,&img_buttons[10],dest.x,dest.y);
+  dest.x+=10;
+  draw_sprite(dst,&img_buttons[11],dest.x,dest.y);
+  draw_label(dst,STR_MONTH,dest.x+10,y-1,255,255,255);
+  dest.x=dest.x+10+catalog_width(STR_MONTH)+10;
 
-  draw_alarm(85,50);
-  draw_alarmtime(85,50);
+  draw_sprite(dst,&img_buttons[12],dest.x,dest.y);
+  dest.x+=10;
+  draw_sprite(dst,&img_buttons[13],dest.x,dest.y);
+  draw_label(dst,STR_YEAR,dest.x+10,y-1,255,255,255);
+  dest.x=dest.x+10+catalog_width(STR_YEAR)+10;
 
-  if(!edit_mode)
-  {
-    dest.x=75;
-    dest.y=230;
-    if(img_buttons[4])
-      SDL_BlitSurface(img_buttons[4],NULL,screen,&dest);
-    draw_text(screen,font,(char*)msg[lang][8],dest.x+10,dest.y,255,255,255);
-  }
+  draw_sprite(dst,&img_buttons[9],dest.x,dest.y);
+  draw_label(dst,STR_BEGIN,dest.x+10,y-1,255,255,255);
 }
 
 ///////////////////////////////////
-/*  Update alarm                 */
+/*  Update calendar              */
 ///////////////////////////////////
-void update_mode_alarm()
+void update_mode_cal()
 {
+  civil_date c=tm_date(&actual_calendar);
+
+  if(input_pressed(BTN_Y))
+    clock_settings.mon_first=!clock_settings.mon_first;
+  c=civil_add_months(c,input_steps(BTN_RIGHT)-input_steps(BTN_LEFT));
+  c=civil_add_years(c,input_steps(BTN_UP)-input_steps(BTN_DOWN));
+
+  // years 1..9999, without mktime
+  set_tm_date(&actual_calendar,c);
 }
 
 ///////////////////////////////////
-/*  Draw timer                   */
+/*  Alarm time text              */
 ///////////////////////////////////
-void draw_mode_timer()
+void alarm_time_string(char* string, int hour, int min)
 {
+  if(clock_settings.format_24)
+    sprintf(string,"%02d:%02d",hour,min);
+  else
+    sprintf(string,"%2d:%02d %s",(hour+11)%12+1,min,hour<12?"AM":"PM");
 }
 
-///////////////////////////////////
-/*  Update timer                 */
-///////////////////////////////////
-void update_mode_timer()
+// weekday shown in day field f, first day of week as calendar
+int alarm_field_day(int f)
 {
+  return (f-2+clock_settings.mon_first)%7;
 }
 
 ///////////////////////////////////
-/*  Update menu icons            */
+/*  Draw one alarm in a line     */
 ///////////////////////////////////
-void update_menu()
+// field: edited field, -1 if not in edit mode
+void draw_alarm_line(const alarm_entry* a, int y, int selected, int field)
 {
-  clear_joystick_state();
-  //process_joystick();
-  process_events();   // only process events 1 time for frame
+  char text[16];
+  int on=a->enabled || field>=0;
+
+  if(selected && field<0)
+    draw_text(screen,font,(char*)">",40,y,255,255,0);
+  alarm_time_string(text,a->hour,a->min);
+  if(on)
+    draw_text(screen,font,text,50,y,selected?255:225,selected?255:225,selected?0:225);
+  else
+    draw_text(screen,font,text,50,y,90,90,90);
 
-  if(mainjoystick.button_start)
-    done=TRUE;
-  if(mainjoystick.button_r1)
+  if(a->days==ALARM_ONCE && field<0)
   {
-    edit_mode=FALSE;
-    mode_app++;
-    if(mode_app>MAX_SECTIONS)
-      mode_app=MODE_CLOCK;
+    draw_label(screen,STR_ONCE,110,y,90,90,90);
+    return;
   }
-  if(mainjoystick.button_l1)
+  for(int f=2; f<9; f++)
   {
-    edit_mode=FALSE;
-    mode_app--;
-    if(mode_app<MODE_CLOCK)
-      mode_app=MAX_SECTIONS;
+    int day=alarm_field_day(f);
+    int x=110+(f-2)*24;
+    if(!(a->days&(1<<day)))
+      draw_label(screen,STR_SUNDAY+day,x,y,60,60,60);
+    else if(on)
+      draw_label(screen,STR_SUNDAY+day,x,y,225,65,65);
+    else
+      draw_label(screen,STR_SUNDAY+day,x,y,122,33,58);
+    if(f==field)
+    {
+      draw_sprite(screen,&img_arrows[0],x+3,y-11);
+      draw_sprite(screen,&img_arrows[1],x+3,y+9);
+    }
   }
-  if(mainjoystick.button_x)
-  {
-    lang++;
-    if(lang>1)
-      lang=0;
+}
+
+///////////////////////////////////
+/*  Draw alarm                   */
+///////////////////////////////////
+void draw_editalarm(int x, int y)
+{
+  set_clockeditarrows(x,y);
+
+  tm t=actual_time;
+  t.tm_hour=alarm_edit.hour;
+  t.tm_min=alarm_edit.min;
+  time_text* tt=&alarm_text;
+  timesvc_format(tt,&t,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
+
+  // time
+  draw_digits(font2,tt->time,x+17,y+40,255,255,0);
+
+  // AM/PM
+  if(!clock_settings.format_24)
+    draw_text(screen,font,tt->ampm,x+120,y+56,128,128,0);
+  else
+    draw_text(screen,font,(char*)"24h",x+120,y+56,30,30,30);
+
+  // hour and minutes arrows as clock edit
+  if(editalarm_index<2)
+  {
+    draw_sprite(screen,&img_arrows[0],editclock_pos[editalarm_index].x,editclock_pos[editalarm_index].y);
+    draw_sprite(screen,&img_arrows[1],editclock_pos[editalarm_index].x2,editclock_pos[editalarm_index].y2);
+  }
+
+  draw_alarm_line(&alarm_edit,180,TRUE,editalarm_index);
+
+  // snooze
+  char text[24];
+  if(alarm_edit.snooze)
+    snprintf(text,24,catalog_str(STR_SNOOZE_MIN),alarm_edit.snooze);
+  else
+    snprintf(text,24,"%s",catalog_str(STR_NO_SNOOZE));
+  draw_text(screen,font,text,110,204,225,225,225);
+  if(editalarm_index==ALARM_FIELDS-1)
+  {
+    draw_sprite(screen,&img_arrows[0],110+text_width(text)/2-5,193);
+    draw_sprite(screen,&img_arrows[1],110+text_width(text)/2-5,213);
   }
 }
 
+void draw_mode_alarm()
+{
+  draw_clock(85,50,THEME_ALARM);
+  if(edit_mode)
+  {
+    draw_editalarm(85,50);
+    return;
+  }
+  draw_alarmtime(85,50);
+
+  // ringing or next alarm, in place of the date
+  char text[48];
+  char time[16];
+  time_t next=alarm_next();
+  if(alarm_ringing!=ALARM_NONE)
+  {
+    const alarm_entry* a=alarm_get(alarm_ringing);
+    alarm_time_string(time,a->hour,a->min);
+    snprintf(text,48,"%s %s",catalog_str(STR_ALARM),time);
+  }
+  else if(next)
+  {
+    tm t;
+    localtime_r(&next,&t);
+    alarm_time_string(time,t.tm_hour,t.tm_min);
+    snprintf(text,48,"%s %s %s",catalog_str(STR_NEXT_ALARM),catalog_str(STR_SUNDAY+t.tm_wday),time);
+  }
+  else
+    snprintf(text,48,"%s",catalog_str(STR_NO_ALARMS));
+  draw_text(screen,font,text,85+(150-text_width(text))/2,130,255,255,0);
+
+  // list around the selected alarm
+  int count=alarm_count();
+  int first=alarm_index-1;
+  if(first>count-ALARM_LINES)
+    first=count-ALARM_LINES;
+  if(first<0)
+    first=0;
+  for(int i=first; i<count && i<first+ALARM_LINES; i++)
+    draw_alarm_line(alarm_get(i),168+(i-first)*14,i==alarm_index,-1);
+}
+
 ///////////////////////////////////
-/*  Draw menu icons              */
+/*  Alarm buttons hints          */
 ///////////////////////////////////
-void draw_menu()
+void draw_hints_alarm(SDL_Surface* dst, int y)
 {
-  // only clean screen in this process
-  SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format,6,6,6));
+  SDL_Rect dest;
+  dest.x=75;
+  dest.y=y;
+
+  if(alarm_ringing!=ALARM_NONE)
+  {
+    draw_sprite(dst,&img_buttons[6],dest.x,dest.y);
+    draw_label(dst,STR_STOP,dest.x+10,dest.y,255,255,255);
+    dest.x+=20+catalog_width(STR_STOP);
+    draw_sprite(dst,&img_buttons[7],dest.x,dest.y);
+    draw_label(dst,STR_SNOOZE,dest.x+10,dest.y,255,255,255);
+  }
+  else if(!edit_mode)
+  {
+    draw_sprite(dst,&img_buttons[4],dest.x,dest.y);
+    draw_label(dst,STR_EDIT,dest.x+10,dest.y,255,255,255);
+    dest.x+=20+catalog_width(STR_EDIT);
+    draw_sprite(dst,&img_buttons[9],dest.x,dest.y);
+    draw_label(dst,STR_NEW,dest.x+10,dest.y,255,255,255);
+    dest.x+=20+catalog_width(STR_NEW);
+    draw_sprite(dst,&img_buttons[6],dest.x,dest.y);
+    draw_label(dst,STR_ON_OFF,dest.x+10,dest.y,255,255,255);
+  }
+  else
+  {
+    draw_sprite(dst,&img_buttons[6],dest.x,dest.y);
+    draw_label(dst,STR_ACCEPT,dest.x+10,dest.y,255,255,255);
+    dest.x+=20+catalog_width(STR_ACCEPT);
+    draw_sprite(dst,&img_buttons[7],dest.x,dest.y);
+    draw_label(dst,STR_CANCEL,dest.x+10,dest.y,255,255,255);
+    if(!alarm_edit_new)
+    {
+      dest.x+=20+catalog_width(STR_CANCEL);
+      draw_sprite(dst,&img_buttons[9],dest.x,dest.y);
+      draw_label(dst,STR_DELETE,dest.x+10,dest.y,255,255,255);
+    }
+  }
+}
+
+///////////////////////////////////
+/*  Update alarm                 */
+///////////////////////////////////
+void update_mode_alarm()
+{
+  time_t now=timesvc_now();
+
+  if(alarm_ringing!=ALARM_NONE)
+  {
+    // A stops it, B rings again after the snooze minutes
+    if(input_pressed(BTN_B))
+      alarm_snooze(alarm_ringing,now);
+    if(input_pressed(BTN_A) || input_pressed(BTN_B))
+      stop_ringing();
+    return;
+  }
+
+  int count=alarm_count();
+  if(!edit_mode)
+  {
+    // actions in list
+    alarm_index+=input_steps(BTN_DOWN)-input_steps(BTN_UP);
+    if(alarm_index>count-1)
+      alarm_index=count-1;
+    if(alarm_index<0)
+      alarm_index=0;
+    if(input_pressed(BTN_A) && count>0)
+    {
+      alarm_enable(alarm_index,!alarm_get(alarm_index)->enabled,now);
+      save_alarms();
+    }
+    if(input_pressed(BTN_SELECT) && count>0)
+    {
+      alarm_edit=*alarm_get(alarm_index);
+      alarm_edit_new=FALSE;
+      editalarm_index=0;
+      edit_mode=TRUE;
+    }
+    else if(input_pressed(BTN_Y) && count<ALARM_MAX)
+    {
+      alarm_edit.hour=7;
+      alarm_edit.min=0;
+      alarm_edit.days=ALARM_ONCE;
+      alarm_edit.enabled=TRUE;
+      alarm_edit.snooze=5;
+      alarm_edit_new=TRUE;
+      editalarm_index=0;
+      edit_mode=TRUE;
+    }
+    return;
+  }
+
+  // actions in edit mode
+  if(input_pressed(BTN_B))
+    edit_mode=FALSE;
+  if(input_pressed(BTN_A))
+  {
+    alarm_edit.enabled=TRUE;
+    if(alarm_edit_new)
+    {
+      int i=alarm_add(&alarm_edit,now);
+      if(i!=ALARM_NONE)
+        alarm_index=i;
+    }
+    else
+      alarm_set(alarm_index,&alarm_edit,now);
+    save_alarms();
+    edit_mode=FALSE;
+  }
+  if(input_pressed(BTN_Y) && !alarm_edit_new)
+  {
+    alarm_remove(alarm_index);
+    if(alarm_index>=alarm_count() && alarm_index>0)
+      alarm_index--;
+    save_alarms();
+    edit_mode=FALSE;
+  }
+  if(input_repeated(BTN_RIGHT))
+    editalarm_index=(editalarm_index+1)%ALARM_FIELDS;
+  if(input_repeated(BTN_LEFT))
+    editalarm_index=(editalarm_index+ALARM_FIELDS-1)%ALARM_FIELDS;
+
+  int dir=input_steps(BTN_UP)-input_steps(BTN_DOWN);
+  if(dir)
+  {
+    switch(editalarm_index)
+    {
+      case 0:
+        alarm_edit.hour=((alarm_edit.hour+dir)%24+24)%24;
+        break;
+      case 1:
+        alarm_edit.min=((alarm_edit.min+dir)%60+60)%60;
+        break;
+      case ALARM_FIELDS-1:
+        alarm_edit.snooze+=dir*5;
+        if(alarm_edit.snooze<0)
+          alarm_edit.snooze=0;
+        if(alarm_edit.snooze>30)
+          alarm_edit.snooze=30;
+        break;
+      default:
+        if(input_pressed(BTN_UP|BTN_DOWN))
+          alarm_edit.days^=1<<alarm_field_day(editalarm_index);
+        break;
+    }
+  }
+}
+
+///////////////////////////////////
+/*  Draw timer                   */
+///////////////////////////////////
+// big MM:SS, hundredths and hours in place of seconds and AM/PM
+void draw_timertime(int x, int y, Sint64 ns, int round_up)
+{
+  char text[16];
+  int hours, min, sec, cs;
+  stopwatch_split(ns,round_up,&hours,&min,&sec,&cs);
+
+  sprintf(text,"%02d:%02d",min,sec);
+  draw_digits(font2,text,x+17,y+40,255,255,0);
+  sprintf(text,".%02d",cs);
+  draw_text(screen,font,text,x+120,y+40,128,128,0);
+  if(hours)
+  {
+    sprintf(text,"%dh",hours);
+    draw_text(screen,font,text,x+120,y+56,128,128,0);
+  }
+}
+
+void draw_mode_timer()
+{
+  Sint64 now=mono_now();
+  int x=85, y=50;
+  int title;
+
+  draw_clock(x,y);
+  if(timer_countdown)
+  {
+    draw_timertime(x,y,countdown_left(&timer_cd,now),TRUE);
+    title=timer_ringing?STR_TIME_UP:STR_TIMER;
+
+    // minutes and seconds set while it is stopped at the start
+    if(!timer_cd.running && timer_cd.left==timer_cd.duration)
+    {
+      set_clockeditarrows(x,y);
+      draw_sprite(screen,&img_arrows[0],editclock_pos[edittimer_index].x,editclock_pos[edittimer_index].y);
+      draw_sprite(screen,&img_arrows[1],editclock_pos[edittimer_index].x2,editclock_pos[edittimer_index].y2);
+    }
+  }
+  else
+  {
+    draw_timertime(x,y,stopwatch_time(&timer_sw,now),FALSE);
+    title=STR_STOPWATCH;
+
+    // last laps, newest first, with time from the previous one
+    for(int i=0; i<ALARM_LINES && i<timer_sw.laps; i++)
+    {
+      int l=timer_sw.laps-1-i;
+      Sint64 split=timer_sw.lap[l]-(l>0?timer_sw.lap[l-1]:0);
+      int h1, m1, s1, c1, h2, m2, s2, c2;
+      char text[64];
+      stopwatch_split(timer_sw.lap[l],FALSE,&h1,&m1,&s1,&c1);
+      stopwatch_split(split,FALSE,&h2,&m2,&s2,&c2);
+      snprintf(text,64,"%s %d  %02d:%02d:%02d.%02d  +%02d:%02d.%02d",catalog_str(STR_LAP_TITLE),l+1,h1,m1,s1,c1,h2*60+m2,s2,c2);
+      draw_text(screen,font,text,160-text_width(text)/2,168+i*14,i==0?255:164,i==0?255:164,i==0?0:164);
+    }
+  }
+  draw_label(screen,title,x+(150-catalog_width(title))/2,y+80,255,255,0);
+}
+
+///////////////////////////////////
+/*  Timer buttons hints          */
+///////////////////////////////////
+int timer_hints_variant()
+{
+  if(timer_ringing)
+    return 1;
+  if(timer_countdown)
+    return timer_cd.running?2:3;
+  return timer_sw.running?4:5;
+}
+
+void draw_hints_timer(SDL_Surface* dst, int y)
+{
+  SDL_Rect dest;
+  dest.x=75;
+  dest.y=y;
+
+  // A, B and Y texts
+  int a, b=-1, sy=-1;
+  if(timer_ringing)
+    a=STR_STOP;
+  else if(timer_countdown)
+  {
+    a=timer_cd.running?STR_PAUSE:STR_START;
+    b=STR_RESET;
+    sy=STR_MODE;
+  }
+  else
+  {
+    a=timer_sw.running?STR_STOP:STR_START;
+    b=timer_sw.running?STR_LAP:STR_RESET;
+    sy=STR_MODE;
+  }
 
+  draw_sprite(dst,&img_buttons[6],dest.x,dest.y);
+  draw_label(dst,a,dest.x+10,dest.y,255,255,255);
+  dest.x+=20+catalog_width(a);
+  if(b>=0)
+  {
+    draw_sprite(dst,&img_buttons[7],dest.x,dest.y);
+    draw_label(dst,b,dest.x+10,dest.y,255,255,255);
+    dest.x+=20+catalog_width(b);
+  }
+  if(sy>=0)
+  {
+    draw_sprite(dst,&img_buttons[9],dest.x,dest.y);
+    draw_label(dst,sy,dest.x+10,dest.y,255,255,255);
+  }
+}
+
+///////////////////////////////////
+/*  Update timer                 */
+///////////////////////////////////
+void update_mode_timer()
+{
+  // when each button was received, not when the frame runs
+  Sint64 now=mono_now();
+  Sint64 ta=input_time(BTN_A)?input_time(BTN_A):now;
+  Sint64 tb=input_time(BTN_B)?input_time(BTN_B):now;
+
+  if(timer_ringing)
+  {
+    if(input_pressed(BTN_A) || input_pressed(BTN_B))
+    {
+      stop_timer_ringing();
+      countdown_set(&timer_cd,timer_cd.duration);
+    }
+    return;
+  }
+
+  if(input_pressed(BTN_Y))
+  {
+    timer_countdown=!timer_countdown;
+    return;
+  }
+
+  if(!timer_countdown)
+  {
+    // A start/stop, B lap while running and reset when stopped
+    if(input_pressed(BTN_A))
+    {
+      if(timer_sw.running)
+        stopwatch_stop(&timer_sw,ta);
+      else
+        stopwatch_start(&timer_sw,ta);
+    }
+    else if(input_pressed(BTN_B))
+    {
+      if(timer_sw.running)
+        stopwatch_lap(&timer_sw,tb);
+      else
+        stopwatch_reset(&timer_sw);
+    }
+    return;
+  }
+
+  if(input_pressed(BTN_A))
+  {
+    if(timer_cd.running)
+      countdown_pause(&timer_cd,ta);
+    else
+      countdown_start(&timer_cd,ta);
+  }
+  else if(input_pressed(BTN_B))
+    countdown_set(&timer_cd,timer_cd.duration);
+
+  // duration only set from the start
+  if(timer_cd.running || timer_cd.left!=timer_cd.duration)
+    return;
+  if(input_pressed(BTN_LEFT|BTN_RIGHT))
+    edittimer_index=!edittimer_index;
+  int min=(int)(timer_cd.duration/(60*STOPWATCH_NS));
+  int sec=(int)(timer_cd.duration/STOPWATCH_NS%60);
+  int dir=input_steps(BTN_UP)-input_steps(BTN_DOWN);
+  if(dir)
+  {
+    if(edittimer_index==0)
+      min=((min+dir)%100+100)%100;
+    else
+      sec=((sec+dir)%60+60)%60;
+    countdown_set(&timer_cd,(min*60+sec)*STOPWATCH_NS);
+  }
+}
+
+///////////////////////////////////
+/*  Draw world clock             */
+///////////////////////////////////
+// one line for each city, offsets from the zone tables, not from TZ
+void draw_mode_world()
+{
+  load_font3();
+  world_load();       // only reads zones not tried yet
+
+  draw_label(screen,STR_WORLD_CLOCK,160-catalog_width(STR_WORLD_CLOCK)/2,12,255,255,0);
+
+  time_t now=timesvc_now();
+  SDL_Color line=themes[THEME_CLOCK].front;
+  for(int i=0; i<world_count(); i++)
+  {
+    int y=32+i*WORLD_ROW_H;
+    char text[48];
+    char time[16];
+    int offset;
+    const char* abbr;
+
+    draw_text(screen,font,(char*)world_city(i),40,y+2,255,255,255);
+    if(world_offset(i,now,&offset,&abbr))
+    {
+      tm t;
+      world_tm(now,offset,&t);
+      alarm_time_string(time,t.tm_hour,t.tm_min);
+      draw_text(screen,font3,time,280-text_width(time,font3),y+2,255,255,0);
+
+      // day, zone name and offset, "+0330" names say the same as the offset
+      char utc[16];
+      int h=abs(offset)/3600, m=abs(offset)/60%60;
+      if(m)
+        snprintf(utc,16,"UTC%c%d:%02d",offset<0?'-':'+',h,m);
+      else
+        snprintf(utc,16,"UTC%c%d",offset<0?'-':'+',h);
+      const char* name=(abbr[0]=='+' || abbr[0]=='-')?"":abbr;
+      snprintf(text,48,"%s  %s%s%s",catalog_str(STR_SUNDAY+t.tm_wday),name,name[0]?"  ":"",utc);
+      draw_text(screen,font,text,40,y+14,164,164,164);
+    }
+    else
+    {
+      // zone file missing or broken
+      draw_text(screen,font3,(char*)"--:--",280-text_width((char*)"--:--",font3),y+2,90,90,90);
+      draw_text(screen,font,(char*)world_zone(i),40,y+14,90,90,90);
+    }
+
+    if(i<world_count()-1)
+    {
+      SDL_Rect r={40,(Sint16)(y+WORLD_ROW_H-4),240,1};
+      fill_rect(screen,&r,&line);
+    }
+  }
+}
+
+///////////////////////////////////
+/*  Debug buttons                */
+///////////////////////////////////
+// buttons no mode uses, all of them held and one just pressed
+int debug_chord()
+{
+  for(Uint32 b=DEBUG_CHORD; b; b&=b-1)
+    if(!input_held(b&(~b+1)))
+      return FALSE;
+  return input_pressed(DEBUG_CHORD);
+}
+
+///////////////////////////////////
+/*  Update menu icons            */
+///////////////////////////////////
+void update_menu()
+{
+  PROF_SCOPE(PROF_UPDATE_MENU);
+
+  if(input_pressed(BTN_START))
+    done=TRUE;
+  if(input_pressed(BTN_R1))
+  {
+    edit_mode=FALSE;
+    mode_app++;
+    if(mode_app>MAX_SECTIONS)
+      mode_app=MODE_CLOCK;
+  }
+  if(input_pressed(BTN_L1))
+  {
+    edit_mode=FALSE;
+    mode_app--;
+    if(mode_app<MODE_CLOCK)
+      mode_app=MAX_SECTIONS;
+  }
+  if(input_pressed(BTN_X))
+  {
+    lang++;
+    if(lang>=catalog_count())
+      lang=0;
+    catalog_set(lang);
+  }
+  // debug: frame redrawn regions
+  if(debug_chord())
+  {
+#ifdef PROFILE
+    // off -> redrawn regions -> profiler overlay -> off
+    if(prof_get_overlay())
+      prof_set_overlay(FALSE);
+    else if(render_get_flash())
+    {
+      render_set_flash(FALSE);
+      prof_set_overlay(TRUE);
+    }
+    else
+      render_set_flash(TRUE);
+#else
+    render_set_flash(!render_get_flash());
+#endif
+  }
+}
+
+///////////////////////////////////
+/*  Menu buttons hints           */
+///////////////////////////////////
+void draw_hints_menu(SDL_Surface* dst, int y)
+{
   // menu icons
   SDL_Rect dest;
-  
+
   dest.x=0;
-  dest.y=230;
-  if(img_buttons[0])
-    SDL_BlitSurface(img_buttons[0],NULL,screen,&dest);
+  dest.y=y;
+  draw_sprite(dst,&img_buttons[0],dest.x,dest.y);
 
-  dest.x+=15;
+  // close together, R1 ends before the mode hints at 75
+  dest.x+=12;
   for(int f=0; f<MAX_SECTIONS; f++)
   {
     if(f==(mode_app-1))
-      SDL_BlitSurface(img_icons[f+2],NULL,screen,&dest);
+      draw_sprite(dst,&img_icons[section_icons[f][0]],dest.x,dest.y);
     else
-      SDL_BlitSurface(img_icons[f+6],NULL,screen,&dest);
+      draw_sprite(dst,&img_icons[section_icons[f][1]],dest.x,dest.y);
     dest.x+=10;
   }
 
-  dest.x+=5;
-  if(img_buttons[1])
-    SDL_BlitSurface(img_buttons[1],NULL,screen,&dest);
+  dest.x+=2;
+  draw_sprite(dst,&img_buttons[1],dest.x,dest.y);
 
   // lang message
-  dest.x=310-text_width((char*)msg[lang][0])-25;
-  dest.y=230;
-  SDL_BlitSurface(img_buttons[8],NULL,screen,&dest);
+  dest.x=310-catalog_width(STR_EXIT)-25;
+  dest.y=y;
+  draw_sprite(dst,&img_buttons[8],dest.x,dest.y);
   dest.x+=10;
-  if(lang)
-    SDL_BlitSurface(img_icons[10],NULL,screen,&dest);
+  // flags of the built in languages, code of the others
+  if(lang==1)
+    draw_sprite(dst,&img_icons[10],dest.x,dest.y);
+  else if(lang==0)
+    draw_sprite(dst,&img_icons[11],dest.x,dest.y);
   else
-    SDL_BlitSurface(img_icons[11],NULL,screen,&dest);
+    draw_text(dst,font,(char*)catalog_code(),dest.x,y,255,255,255);
 
   // menu message
-  dest.x=310-text_width((char*)msg[lang][0]);
-  dest.y=230;
-  if(img_buttons[5])
-    SDL_BlitSurface(img_buttons[5],NULL,screen,&dest);
-  draw_text(screen,font,(char*)msg[lang][0],320-text_width((char*)msg[lang][0]),230,255,255,255);
+  dest.x=310-catalog_width(STR_EXIT);
+  dest.y=y;
+  draw_sprite(dst,&img_buttons[5],dest.x,dest.y);
+  draw_label(dst,STR_EXIT,320-catalog_width(STR_EXIT),y,255,255,255);
 }
 
+///////////////////////////////////
+/*  Bake hint bar in surface     */
+///////////////////////////////////
+void bake_hintbar(SDL_Surface* dst)
+{
+  int y=230-HINTBAR_Y;
+
+  fill_rect(dst,NULL,&color_background);
+  draw_hints_menu(dst,y);
+  switch(mode_app)
+  {
+    case MODE_CLOCK:
+      draw_hints_clock(dst,y);
+      break;
+    case MODE_CAL:
+      draw_hints_cal(dst,y);
+      break;
+    case MODE_ALARM:
+      draw_hints_alarm(dst,y);
+      break;
+    case MODE_TIMER:
+      draw_hints_timer(dst,y);
+      break;
+  }
+}
+
+///////////////////////////////////
+/*  Draw menu icons              */
+///////////////////////////////////
+void draw_menu()
+{
+  PROF_SCOPE(PROF_DRAW_MENU);
+  // only clean screen in this process
+  fill_rect(screen,NULL,&color_background);
+
+  // button hints, baked once for each mode, language and edit state
+  layer_key key={mode_app,lang,edit_mode,0,0,0,0};
+  if(mode_app==MODE_CLOCK && edit_mode && editclock_index>=4 && editclock_index<=6)
+    key.variant=1;    // date fields show "move"
+  if(mode_app==MODE_CLOCK && !edit_mode)
+    key.variant=clock_settings.analog;
+  if(mode_app==MODE_ALARM && alarm_ringing!=ALARM_NONE)
+    key.variant=1;    // stop and snooze
+  if(mode_app==MODE_ALARM && edit_mode && !alarm_edit_new)
+    key.variant=2;    // delete
+  if(mode_app==MODE_TIMER)
+    key.variant=timer_hints_variant();
+  if(layer_prepare(&layer_hints,320,240-HINTBAR_Y,&key))
+    bake_hintbar(layer_hints.surface);
+  draw_layer(&layer_hints,0,HINTBAR_Y);
+}
+
+///////////////////////////////////
+/*  Idle face                    */
+///////////////////////////////////
+// time and date dimmed on black, nothing else is drawn while idle
+void draw_idle()
+{
+  SDL_Color black={0,0,0,0};
+  fill_rect(screen,NULL,&black);
+
+  time_text* tt=&actual_text;
+  timesvc_format(tt,&actual_time,clock_settings.format_24,catalog_table(STR_JANUARY),clock_settings.date_ord1,clock_settings.date_ord2,clock_settings.date_ord3);
+  int tw=digits_width(font2,tt->time,128,128,0);
+  draw_digits(font2,tt->time,160-tw/2,96,128,128,0);
+  if(clock_settings.idle_seconds)
+    draw_text(screen,font,tt->seconds,160+tw/2+4,96,90,90,0);
+  if(!clock_settings.format_24)
+    draw_text(screen,font,tt->ampm,160+tw/2+4,112,90,90,0);
+  draw_text(screen,font,tt->date,160-text_width(tt->date)/2,136,90,90,90);
+}
+
+///////////////////////////////////
+/*  Time until next frame        */
+///////////////////////////////////
+Uint32 frame_timeout()
+{
+  Uint32 timeout;
+  if(power_state()==POWER_IDLE)
+  {
+    if(clock_settings.idle_seconds)
+      timeout=sched_to_next_second();
+    else
+      timeout=sched_to_time((timesvc_now()/60+1)*60);
+  }
+  else switch(mode_app)
+  {
+    case MODE_CLOCK:
+      if(edit_mode)
+        timeout=SCHED_FOREVER;        // edited time only changes with input
+      else if(clock_settings.analog)
+        timeout=analog_to_next_step(actual_ms());   // sweep of the second hand
+      else
+        timeout=sched_to_next_second();
+      break;
+    case MODE_CAL:
+      timeout=sched_to_midnight();    // today mark
+      break;
+    case MODE_WORLD:
+      timeout=sched_to_time((timesvc_now()/60+1)*60);   // minutes shown
+      break;
+    case MODE_TIMER:
+      if(timer_sw.running || timer_cd.running)
+        timeout=TIMER_FRAME_MS;       // hundredths, accuracy doesn't depend on it
+      else
+        timeout=SCHED_FOREVER;
+      break;
+    default:
+      timeout=sched_to_next_second();
+      break;
+  }
+
+  // go idle without input
+  Uint32 idle=power_to_idle(mono_now());
+  if(idle<timeout)
+    timeout=idle;
+
+  // countdown ends in any mode
+  if(timer_cd.running)
+  {
+    Sint64 left=countdown_left(&timer_cd,mono_now())/1000000+1;
+    if(left<timeout)
+      timeout=(Uint32)left;
+  }
+
+  // wake up for the next alarm in any mode
+  time_t next=alarm_next();
+  if(next)
+  {
+    Uint32 t=sched_to_time(next);
+    if(t<timeout)
+      timeout=t;
+  }
+  return timeout;
+}
+
+///////////////////////////////////
+/*  Update and draw active mode  */
+///////////////////////////////////
+void update_mode()
+{
+  PROF_SCOPE(PROF_UPDATE_MODE);
+  // ringing alarm stays on screen until stopped
+  if(alarm_ringing!=ALARM_NONE)
+  {
+    mode_app=MODE_ALARM;
+    edit_mode=FALSE;
+  }
+  else if(timer_ringing)
+    mode_app=MODE_TIMER;
+  switch(mode_app)
+  {
+    case MODE_CLOCK:
+      update_mode_clock();
+      break;
+    case MODE_CAL:
+      update_mode_cal();
+      break;
+    case MODE_ALARM:
+      update_mode_alarm();
+      break;
+    case MODE_TIMER:
+      update_mode_timer();
+      break;
+  }
+}
+
+void draw_mode()
+{
+  PROF_SCOPE(PROF_DRAW_MODE);
+  switch(mode_app)
+  {
+    case MODE_CLOCK:
+      draw_mode_clock();
+      break;
+    case MODE_CAL:
+      draw_mode_cal();
+      break;
+    case MODE_ALARM:
+      draw_mode_alarm();
+      break;
+    case MODE_TIMER:
+      draw_mode_timer();
+      break;
+    case MODE_WORLD:
+      draw_mode_world();
+      break;
+  }
+}
+
+#ifdef BENCHMARK
+///////////////////////////////////
+/*  Benchmark                    */
+///////////////////////////////////
+#define BENCH_TIME    1577880000    // 2020-01-01 12:00:00 UTC
+
+// same steps as the main loop, with a new second every frame
+void bench_run_case(const char* name, int mode, int edit, int full, int frames)
+{
+  mode_app=mode;
+  edit_mode=edit;
+  editclock_index=0;
+  timesvc_set_fixed(BENCH_TIME);
+  timesvc_update();
+  actual_time=*timesvc_tm();
+  edit_time=actual_time;
+  edit_time.tm_isdst=-1;
+  render_invalidate();
+
+  bench_case(name,full);
+  for(int f=0; f<frames; f++)
+  {
+    timesvc_set_fixed(BENCH_TIME+f);
+    bench_frame_begin();
+
+    timesvc_update();
+    actual_time=*timesvc_tm();
+    if(edit_mode && mode_app==MODE_CLOCK)
+      step_edit_time(1);
+    else if(edit_mode && mode_app==MODE_ALARM)
+      alarm_edit.min=(alarm_edit.min+1)%60;
+    input_update();
+    update_menu();
+    update_mode();
+    bench_mark(BENCH_UPDATE);
+
+    if(full)
+      render_invalidate();
+    render_begin();
+    draw_menu();
+    bench_mark(BENCH_MENU);
+    draw_mode();
+    bench_mark(BENCH_MODE);
+    render_end();
+    bench_mark(BENCH_RENDER);
+
+    bench_frame_end();
+  }
+}
+
+void run_benchmark(int frames)
+{
+  world_load();       // zone files out of the frames
+  bench_start();
+  for(int full=0; full<2; full++)
+  {
+    bench_run_case("clock",MODE_CLOCK,FALSE,full,frames);
+    bench_run_case("clock_edit",MODE_CLOCK,TRUE,full,frames);
+    clock_settings.analog=TRUE;
+    bench_run_case("clock_analog",MODE_CLOCK,FALSE,full,frames);
+    clock_settings.analog=FALSE;
+    bench_run_case("calendar",MODE_CAL,FALSE,full,frames);
+    bench_run_case("alarm",MODE_ALARM,FALSE,full,frames);
+    alarm_edit.hour=7;
+    alarm_edit.min=0;
+    alarm_edit.days=0x3E;       // monday to friday
+    alarm_edit.enabled=TRUE;
+    alarm_edit.snooze=5;
+    alarm_edit_new=TRUE;
+    editalarm_index=0;
+    bench_run_case("alarm_edit",MODE_ALARM,TRUE,full,frames);
+    // stopwatch running with laps, the list redrawn every frame
+    timer_countdown=FALSE;
+    stopwatch_reset(&timer_sw);
+    stopwatch_start(&timer_sw,mono_now()-90*STOPWATCH_NS);
+    for(int l=0; l<3; l++)
+      stopwatch_lap(&timer_sw,mono_now()-(60-l*20)*STOPWATCH_NS);
+    bench_run_case("timer",MODE_TIMER,FALSE,full,frames);
+    stopwatch_reset(&timer_sw);
+    bench_run_case("world",MODE_WORLD,FALSE,full,frames);
+  }
+  raster_bench(screen,frames);
+  blend_bench(frames);
+  bench_finish();
+  timesvc_set_fixed(0);
+}
+#endif
+
 ///////////////////////////////////
 /*  Init                         */
 ///////////////////////////////////
 int main(int argc, char *argv[])
 {
-  if(SDL_Init(SDL_INIT_JOYSTICK | SDL_INIT_VIDEO | SDL_INIT_AUDIO)<0)
+  clock_gettime(CLOCK_MONOTONIC,&startup_begin);
+
+#ifdef BENCHMARK
+  // headless and same local time on any machine
+  setenv("SDL_VIDEODRIVER","dummy",0);
+  setenv("SDL_AUDIODRIVER","dummy",0);
+  setenv("TZ","UTC0",1);
+  tzset();
+#endif
+
+  // joystick after first frame, audio when an alarm rings
+  if(SDL_Init(SDL_INIT_VIDEO)<0)
 		return 0;
 
-  screen = SDL_SetVideoMode(320, 240, 16, SDL_HWSURFACE | SDL_DOUBLEBUF);
+  // software surface: only changed regions are sent with SDL_UpdateRects
+  screen = SDL_SetVideoMode(320, 240, 16, SDL_SWSURFACE);
   if (screen==NULL)
     return 0;
+  render_init(screen);
+  raster_init(screen);
+  startup_video=startup_ms();
+
+  default_config();
+  input_init();
+  catalog_init();
+#ifndef BENCHMARK
+  load_catalog();
+  load_config();        // benchmark always with default settings
+  load_alarms();
+  load_keymap();
+#endif
+  load_cities();
+  if(lang<0 || lang>=catalog_count())
+    lang=0;
+  catalog_set(lang);
+  startup_config=startup_ms();
 
   init_game();
-  load_config();
-
-  const int GAME_FPS=60;
-  Uint32 start_time;
-
-  while(!done)
+  startup_init=startup_ms();
+#ifdef BENCHMARK
+  // frames per case in first argument
+  run_benchmark(argc>1?atoi(argv[1]):1000);
+  end_game();
+  return 0;
+#endif
+  sched_init();
+  rtc_init(getenv("ODCLOCK_RTC"));
+  power_init(getenv("ODCLOCK_BACKLIGHT"),mono_now());
+  power_config(clock_settings.idle_timeout,clock_settings.idle_dim);
+  signal(SIGUSR1,stats_signal);   // kill -USR1 prints the counters
+  signal(SIGTERM,quit_signal);
+  signal(SIGINT,quit_signal);
+
+  while(!done && !quit_requested)
 	{
-    start_time=SDL_GetTicks();
+    // one clock read per frame, for updates and drawing
+    timesvc_update();
+    actual_time=*timesvc_tm();
+    check_alarms();
+    int ringing=(alarm_ringing!=ALARM_NONE || timer_ringing);
+
+    // only process events 1 time for frame, when idle a press only
+    // wakes up without being given to the modes
+    input_update();
+    if(power_state()==POWER_IDLE)
+    {
+      if(power_update(input_any() || ringing,mono_now())==POWER_ACTIVE)
+        render_invalidate();
+    }
+    else
+    {
+      update_menu();
+      update_mode();
+      if(power_update(input_any() || input_held(0xFFFFFFFF) || ringing,mono_now())==POWER_IDLE)
+        render_invalidate();
+    }
 
-    update_menu();
-    draw_menu();
+    // draw after all updates, the frame can be the last one for a while
+    render_begin();
+    if(power_state()==POWER_IDLE)
+      draw_idle();
+    else
+    {
+      draw_menu();
+      draw_mode();
+#ifdef PROFILE
+      prof_draw_overlay(font,2,2);
+#endif
+    }
+    render_end();
 
-    switch(mode_app)
+    if(!deferred_done)
     {
-      case MODE_CLOCK:
-        update_mode_clock();
-        draw_mode_clock();
-        break;
-      case MODE_CAL:
-        update_mode_cal();
-        draw_mode_cal();
-        break;
-      case MODE_ALARM:
-        update_mode_alarm();
-        draw_mode_alarm();
-        break;
-      case MODE_TIMER:
-        update_mode_timer();
-        draw_mode_timer();
-        break;
+      startup_first_frame=startup_ms();
+      print_startup();
+      init_deferred();
     }
 
-    SDL_Flip(screen);
+    if(stats_requested)
+    {
+      stats_requested=FALSE;
+      dump_stats();
+    }
 
-    // set FPS 60
-    if(1000/GAME_FPS>SDL_GetTicks()-start_time)
-      SDL_Delay(1000/GAME_FPS-(SDL_GetTicks()-start_time));
+    // sleep until something can change on screen
+    sched_wait(frame_timeout());
+    PROF_FRAME();
 	}
 
 	save_config();
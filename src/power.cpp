@@ -0,0 +1,202 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Idle power state                          */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../inc/power.h"
+#include "../inc/scheduler.h"
+
+#define TRUE   1
+#define FALSE  0
+
+#define POWER_NS    1000000000LL
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static char power_backlight[256]=POWER_BACKLIGHT;
+static int power_ready=FALSE;
+static int power_current=POWER_ACTIVE;
+static int power_timeout=0;         // s
+static int power_dim=10;            // %
+static int power_level=-1;          // backlight before going idle
+static int power_warned=FALSE;
+// level as text for power_restore(), 0 length when not dimmed
+static char power_restore_text[16];
+static volatile sig_atomic_t power_restore_len=0;
+static Sint64 power_activity=0;
+static Sint64 power_since=0;
+static Sint64 power_spent[POWER_STATES];
+static Uint32 power_idles=0;
+
+///////////////////////////////////
+/*  Backlight                    */
+///////////////////////////////////
+static int read_level()
+{
+  int level=-1;
+  FILE* f=fopen(power_backlight,"r");
+  if(f==NULL)
+    return -1;
+  if(fscanf(f,"%d",&level)!=1)
+    level=-1;
+  fclose(f);
+  return level;
+}
+
+static int write_level(int level)
+{
+  FILE* f=fopen(power_backlight,"w");
+  if(f==NULL)
+    return FALSE;
+  fprintf(f,"%d\n",level);
+  return fclose(f)==0;
+}
+
+// the state still changes without backlight, said once
+static void warn_backlight()
+{
+  if(!power_warned)
+    fprintf(stderr,"power: can't set backlight %s\n",power_backlight);
+  power_warned=TRUE;
+}
+
+///////////////////////////////////
+/*  State changes                */
+///////////////////////////////////
+static void set_state(int state, Sint64 now)
+{
+  power_spent[power_current]+=now-power_since;
+  power_since=now;
+  power_current=state;
+}
+
+static void go_idle(Sint64 now)
+{
+  set_state(POWER_IDLE,now);
+  power_idles++;
+
+  // level read each time, it can be changed with the system hotkeys
+  power_level=read_level();
+  if(power_level>=0)
+    power_restore_len=snprintf(power_restore_text,sizeof(power_restore_text),"%d\n",power_level);
+  if(power_level<0 || !write_level(power_level*power_dim/100))
+  {
+    power_restore_len=0;
+    power_level=-1;
+    warn_backlight();
+  }
+}
+
+static void go_active(Sint64 now)
+{
+  set_state(POWER_ACTIVE,now);
+  if(power_level>=0 && !write_level(power_level))
+    warn_backlight();
+  power_restore_len=0;
+  power_level=-1;
+}
+
+///////////////////////////////////
+/*  Init and close               */
+///////////////////////////////////
+void power_init(const char* backlight, Sint64 now)
+{
+  if(backlight && backlight[0])
+  {
+    strncpy(power_backlight,backlight,sizeof(power_backlight)-1);
+    power_backlight[sizeof(power_backlight)-1]=0;
+  }
+  power_current=POWER_ACTIVE;
+  power_activity=now;
+  power_since=now;
+  memset(power_spent,0,sizeof(power_spent));
+  power_idles=0;
+  power_ready=TRUE;
+}
+
+void power_close()
+{
+  if(power_ready && power_level>=0)
+    write_level(power_level);
+  power_restore_len=0;
+  power_level=-1;
+  power_ready=FALSE;
+}
+
+// safe from signal handlers: only open(), write() and close()
+void power_restore()
+{
+  if(power_restore_len<=0)
+    return;
+  int fd=open(power_backlight,O_WRONLY|O_TRUNC);
+  if(fd<0)
+    return;
+  ssize_t r=write(fd,power_restore_text,power_restore_len);
+  (void)r;
+  close(fd);
+}
+
+void power_config(int timeout, int dim)
+{
+  power_timeout=timeout>0?timeout:0;
+  power_dim=dim<0?0:(dim>100?100:dim);
+}
+
+///////////////////////////////////
+/*  Frame update                 */
+///////////////////////////////////
+int power_update(int activity, Sint64 now)
+{
+  if(!power_ready)
+    return POWER_ACTIVE;
+
+  if(activity)
+  {
+    power_activity=now;
+    if(power_current==POWER_IDLE)
+      go_active(now);
+  }
+  else if(power_current==POWER_ACTIVE && power_timeout && now-power_activity>=power_timeout*POWER_NS)
+    go_idle(now);
+  return power_current;
+}
+
+int power_state()
+{
+  return power_current;
+}
+
+Uint32 power_to_idle(Sint64 now)
+{
+  if(!power_ready || !power_timeout || power_current!=POWER_ACTIVE)
+    return SCHED_FOREVER;
+  Sint64 left=power_activity+power_timeout*POWER_NS-now;
+  if(left<=0)
+    return 0;
+  left=left/1000000+1;
+  return left<SCHED_FOREVER?(Uint32)left:SCHED_FOREVER;
+}
+
+///////////////////////////////////
+/*  Stats                        */
+///////////////////////////////////
+void power_stats(Sint64 now, double* seconds, Uint32* idles)
+{
+  for(int s=0; s<POWER_STATES; s++)
+  {
+    Sint64 ns=power_spent[s];
+    if(power_ready && s==power_current)
+      ns+=now-power_since;
+    seconds[s]=ns/(double)POWER_NS;
+  }
+  if(idles)
+    *idles=power_idles;
+}
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Frame stage profiler                      */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#ifdef PROFILE
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include "../inc/profiler.h"
+#include "../inc/render.h"
+
+#define PROF_FRAMES       64      // ring buffer
+#define PROF_BUDGET_US    16000   // 60 fps
+#define PROF_BAR_W        80
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static const char* stage_names[PROF_STAGES]=
+{
+  "events","upd menu","upd mode","menu","mode","render","sleep"
+};
+
+static const SDL_Color stage_colors[PROF_STAGES]=
+{
+  {225,65,65,0},{225,160,65,0},{225,225,65,0},{65,171,65,0},{65,171,225,0},{171,65,225,0},{90,90,90,0}
+};
+
+static Uint32 prof_ring[PROF_FRAMES][PROF_STAGES];
+static Uint32 prof_current[PROF_STAGES];
+static int prof_pos=0;
+static int prof_count=0;
+static int prof_overlay=0;
+
+///////////////////////////////////
+/*  Time                         */
+///////////////////////////////////
+// wraps every 71 minutes, unsigned so differences stay right across it
+// (tv_sec*1000000 in a 32 bit long overflows after 35 minutes)
+Uint32 prof_now_us()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (Uint32)ts.tv_sec*1000000u+(Uint32)(ts.tv_nsec/1000);
+}
+
+///////////////////////////////////
+/*  Record                       */
+///////////////////////////////////
+void prof_add(int stage, Uint32 us)
+{
+  if(stage>=0 && stage<PROF_STAGES)
+    prof_current[stage]+=us;
+}
+
+void prof_frame()
+{
+  memcpy(prof_ring[prof_pos],prof_current,sizeof(prof_current));
+  memset(prof_current,0,sizeof(prof_current));
+  prof_pos=(prof_pos+1)%PROF_FRAMES;
+  if(prof_count<PROF_FRAMES)
+    prof_count++;
+}
+
+///////////////////////////////////
+/*  Averages of the ring         */
+///////////////////////////////////
+// avg per stage, returns average work time (all but sleep)
+static Uint32 prof_averages(Uint32* avg, Uint32* max_work)
+{
+  Uint32 work=0;
+  *max_work=0;
+  for(int s=0; s<PROF_STAGES; s++)
+    avg[s]=0;
+  if(prof_count==0)
+    return 0;
+
+  for(int f=0; f<prof_count; f++)
+  {
+    Uint32 w=0;
+    for(int s=0; s<PROF_STAGES; s++)
+    {
+      avg[s]+=prof_ring[f][s];
+      if(s!=PROF_SLEEP)
+        w+=prof_ring[f][s];
+    }
+    if(w>*max_work)
+      *max_work=w;
+  }
+  for(int s=0; s<PROF_STAGES; s++)
+  {
+    avg[s]/=prof_count;
+    if(s!=PROF_SLEEP)
+      work+=avg[s];
+  }
+  return work;
+}
+
+///////////////////////////////////
+/*  Overlay                      */
+///////////////////////////////////
+void prof_set_overlay(int overlay)
+{
+  prof_overlay=overlay;
+  render_invalidate();
+}
+
+int prof_get_overlay()
+{
+  return prof_overlay;
+}
+
+void prof_draw_overlay(text_font* f, int x, int y)
+{
+  if(!prof_overlay || !f)
+    return;
+
+  SDL_PixelFormat* fmt=SDL_GetVideoSurface()->format;
+  SDL_Color white={255,255,255,0};
+  int line=font_lineskip(f);
+  char text[64];
+  Uint32 avg[PROF_STAGES];
+  Uint32 max_work;
+  Uint32 work=prof_averages(avg,&max_work);
+  Uint32 total=work+avg[PROF_SLEEP];
+
+  SDL_Rect r={(Sint16)x,(Sint16)y,(Uint16)(PROF_BAR_W+52),(Uint16)(line*(PROF_STAGES+2)+4)};
+  render_fill(&r,SDL_MapRGB(fmt,0,0,0));
+
+  snprintf(text,64,"frame %.2f ms max %.2f",work/1000.0,max_work/1000.0);
+  render_text(f,text,x+2,y+2,white);
+  snprintf(text,64,"fps %.2f sleep %.1f ms",total?1000000.0/total:0.0,avg[PROF_SLEEP]/1000.0);
+  render_text(f,text,x+2,y+2+line,white);
+
+  // one bar per stage, full width is the frame budget
+  for(int s=0; s<PROF_STAGES; s++)
+  {
+    int ly=y+2+line*(s+2);
+    render_text(f,stage_names[s],x+2,ly,stage_colors[s]);
+    Uint32 w=avg[s]*PROF_BAR_W/PROF_BUDGET_US;
+    if(w>PROF_BAR_W)
+      w=PROF_BAR_W;
+    if(w==0 && avg[s]>0)
+      w=1;
+    SDL_Rect bar={(Sint16)(x+48),(Sint16)(ly+1),(Uint16)w,(Uint16)(line-2)};
+    const SDL_Color* c=&stage_colors[s];
+    if(w>0)
+      render_fill(&bar,SDL_MapRGB(fmt,c->r,c->g,c->b));
+  }
+  SDL_Rect budget={(Sint16)(x+48+PROF_BAR_W),(Sint16)(y+2+line*2),1,(Uint16)(line*PROF_STAGES)};
+  render_fill(&budget,SDL_MapRGB(fmt,255,255,255));
+}
+
+///////////////////////////////////
+/*  Dump                         */
+///////////////////////////////////
+void prof_dump()
+{
+  Uint32 avg[PROF_STAGES];
+  Uint32 max_work;
+  Uint32 work=prof_averages(avg,&max_work);
+
+  fprintf(stderr,"profiler: last %d frames, work %u us (max %u us)",prof_count,work,max_work);
+  for(int s=0; s<PROF_STAGES; s++)
+    fprintf(stderr,", %s %u us",stage_names[s],avg[s]);
+  fprintf(stderr,"\n");
+}
+
+#endif
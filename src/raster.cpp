@@ -0,0 +1,430 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Software rasterizer                       */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "../inc/raster.h"
+#ifdef BENCHMARK
+#include <math.h>
+#include "../inc/bench.h"
+#endif
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct raster_funcs
+{
+  int bpp;
+  void (*pixel)(SDL_Surface*, int, int, Uint32);
+  void (*line)(SDL_Surface*, int, int, int, int, Uint32);
+  void (*span)(SDL_Surface*, int, int, int, Uint32);
+  void (*box)(SDL_Surface*, int, int, int, int, int, Uint32, Uint32, int);
+};
+
+///////////////////////////////////
+/*  Clipping                     */
+///////////////////////////////////
+static inline int inside(SDL_Surface* dst, int x, int y)
+{
+  const SDL_Rect* c=&dst->clip_rect;
+  return x>=c->x && x<c->x+c->w && y>=c->y && y<c->y+c->h;
+}
+
+// clip a span, FALSE if nothing left
+static inline int clip_span(SDL_Surface* dst, int* x, int y, int* w)
+{
+  const SDL_Rect* c=&dst->clip_rect;
+  if(y<c->y || y>=c->y+c->h)
+    return FALSE;
+  int x1=*x, x2=*x+*w;
+  if(x1<c->x)
+    x1=c->x;
+  if(x2>c->x+c->w)
+    x2=c->x+c->w;
+  if(x2<=x1)
+    return FALSE;
+  *x=x1;
+  *w=x2-x1;
+  return TRUE;
+}
+
+///////////////////////////////////
+/*  Shared by all formats        */
+///////////////////////////////////
+// Bresenham, every pixel clipped
+template<class F> static void line_clipped(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 colour)
+{
+  int dx=abs(x1-x0), sx=x0<x1?1:-1;
+  int dy=-abs(y1-y0), sy=y0<y1?1:-1;
+  int err=dx+dy;
+  while(TRUE)
+  {
+    if(inside(dst,x0,y0))
+      F::put(dst,x0,y0,colour);
+    if(x0==x1 && y0==y1)
+      break;
+    int e2=2*err;
+    if(e2>=dy)
+    {
+      err+=dy;
+      x0+=sx;
+    }
+    if(e2<=dx)
+    {
+      err+=dx;
+      y0+=sy;
+    }
+  }
+}
+
+// row by row, at most three spans per row and no pixel written twice
+template<class F> static void box(SDL_Surface* dst, int x, int y, int w, int h, int shape, Uint32 fill, Uint32 edge, int parts)
+{
+  if(w<=0 || h<=0)
+    return;
+  if((shape==RASTER_SINGLE && (w<3 || h<3)) || (shape==RASTER_ROUNDED && (w<5 || h<5)))
+    shape=RASTER_SQUARE;
+
+  for(int r=0; r<h; r++)
+  {
+    if(shape==RASTER_SQUARE)
+    {
+      if(parts&RASTER_FILL)
+        F::span(dst,x,y+r,w,fill);
+      continue;
+    }
+
+    // distance to top or bottom row
+    int d=r<h-1-r?r:h-1-r;
+    int cut=0;
+    if(shape==RASTER_ROUNDED && d<2)
+      cut=2-d;
+    int x0=x+cut;
+    int n=w-2*cut;
+
+    if(d==0)
+    {
+      if(parts&RASTER_EDGE)
+        F::span(dst,x0,y+r,n,edge);
+      continue;
+    }
+    if(parts&RASTER_EDGE)
+    {
+      F::span(dst,x0,y+r,1,edge);
+      F::span(dst,x0+n-1,y+r,1,edge);
+    }
+    if(parts&RASTER_FILL)
+      F::span(dst,x0+1,y+r,n-2,fill);
+  }
+}
+
+///////////////////////////////////
+/*  Direct access, 16/32 bits    */
+///////////////////////////////////
+template<typename T> struct direct
+{
+  static inline T* at(SDL_Surface* dst, int x, int y)
+  {
+    return (T*)((Uint8*)dst->pixels+y*dst->pitch)+x;
+  }
+
+  static inline void put(SDL_Surface* dst, int x, int y, Uint32 colour)
+  {
+    *at(dst,x,y)=(T)colour;
+  }
+
+  static void fill(T* p, int n, Uint32 colour)
+  {
+    T c=(T)colour;
+    while(n--)
+      *p++=c;
+  }
+
+  static void pixel(SDL_Surface* dst, int x, int y, Uint32 colour)
+  {
+    if(inside(dst,x,y))
+      put(dst,x,y,colour);
+  }
+
+  static void span(SDL_Surface* dst, int x, int y, int w, Uint32 colour)
+  {
+    if(clip_span(dst,&x,y,&w))
+      fill(at(dst,x,y),w,colour);
+  }
+
+  static void line(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 colour)
+  {
+    if(!inside(dst,x0,y0) || !inside(dst,x1,y1))
+    {
+      line_clipped<direct<T> >(dst,x0,y0,x1,y1,colour);
+      return;
+    }
+
+    // all inside: walk a pointer
+    int dx=abs(x1-x0), dy=-abs(y1-y0);
+    int stepx=x0<x1?1:-1;
+    int stepy=(y0<y1?1:-1)*(dst->pitch/(int)sizeof(T));
+    int err=dx+dy;
+    T* p=at(dst,x0,y0);
+    T c=(T)colour;
+    int n=(dx>-dy?dx:-dy)+1;
+    while(n--)
+    {
+      *p=c;
+      int e2=2*err;
+      if(e2>=dy)
+      {
+        err+=dy;
+        p+=stepx;
+      }
+      if(e2<=dx)
+      {
+        err+=dx;
+        p+=stepy;
+      }
+    }
+  }
+};
+
+// two pixels per 32 bit write, pixel rows are 16 bit aligned
+template<> void direct<Uint16>::fill(Uint16* p, int n, Uint32 colour)
+{
+  if(n<=0)
+    return;
+  if((size_t)p&2)
+  {
+    *p++=(Uint16)colour;
+    n--;
+  }
+  Uint32 pair=(colour&0xFFFF)*0x10001;
+  Uint32* w=(Uint32*)p;
+  for(; n>=8; n-=8, w+=4)
+  {
+    w[0]=pair;
+    w[1]=pair;
+    w[2]=pair;
+    w[3]=pair;
+  }
+  for(; n>=2; n-=2)
+    *w++=pair;
+  if(n)
+    *(Uint16*)w=(Uint16)colour;
+}
+
+///////////////////////////////////
+/*  Other depths, through SDL    */
+///////////////////////////////////
+struct sdl_fill
+{
+  static inline void put(SDL_Surface* dst, int x, int y, Uint32 colour)
+  {
+    SDL_Rect r={(Sint16)x,(Sint16)y,1,1};
+    SDL_FillRect(dst,&r,colour);
+  }
+
+  static void pixel(SDL_Surface* dst, int x, int y, Uint32 colour)
+  {
+    put(dst,x,y,colour);
+  }
+
+  static void span(SDL_Surface* dst, int x, int y, int w, Uint32 colour)
+  {
+    if(w<=0)
+      return;
+    SDL_Rect r={(Sint16)x,(Sint16)y,(Uint16)w,1};
+    SDL_FillRect(dst,&r,colour);
+  }
+
+  static void line(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 colour)
+  {
+    line_clipped<sdl_fill>(dst,x0,y0,x1,y1,colour);
+  }
+};
+
+///////////////////////////////////
+/*  Instances                    */
+///////////////////////////////////
+static const raster_funcs funcs_rgb565=
+{
+  2,direct<Uint16>::pixel,direct<Uint16>::line,direct<Uint16>::span,box<direct<Uint16> >
+};
+
+static const raster_funcs funcs_xrgb8888=
+{
+  4,direct<Uint32>::pixel,direct<Uint32>::line,direct<Uint32>::span,box<direct<Uint32> >
+};
+
+static const raster_funcs funcs_sdl=
+{
+  0,sdl_fill::pixel,sdl_fill::line,sdl_fill::span,box<sdl_fill>
+};
+
+static const raster_funcs* raster_screen=&funcs_sdl;
+
+static const raster_funcs* select_funcs(int bpp)
+{
+  if(bpp==2)
+    return &funcs_rgb565;
+  if(bpp==4)
+    return &funcs_xrgb8888;
+  return &funcs_sdl;
+}
+
+static inline const raster_funcs* funcs_for(SDL_Surface* dst)
+{
+  if(dst->format->BytesPerPixel==raster_screen->bpp)
+    return raster_screen;
+  return select_funcs(dst->format->BytesPerPixel);
+}
+
+///////////////////////////////////
+/*  Init                         */
+///////////////////////////////////
+void raster_init(SDL_Surface* screen)
+{
+  raster_screen=select_funcs(screen->format->BytesPerPixel);
+}
+
+///////////////////////////////////
+/*  Draw                         */
+///////////////////////////////////
+void raster_pixel(SDL_Surface* dst, int x, int y, Uint32 colour)
+{
+  funcs_for(dst)->pixel(dst,x,y,colour);
+}
+
+void raster_line(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 colour)
+{
+  funcs_for(dst)->line(dst,x0,y0,x1,y1,colour);
+}
+
+void raster_span(SDL_Surface* dst, int x, int y, int w, Uint32 colour)
+{
+  funcs_for(dst)->span(dst,x,y,w,colour);
+}
+
+void raster_box(SDL_Surface* dst, int x, int y, int w, int h, int shape, Uint32 fill, Uint32 edge, int parts)
+{
+  funcs_for(dst)->box(dst,x,y,w,h,shape,fill,edge,parts);
+}
+
+#ifdef BENCHMARK
+///////////////////////////////////
+/*  Previous versions            */
+///////////////////////////////////
+// line stepped in doubles, as drawLine() did (pixel size fixed)
+static void float_line(SDL_Surface* dst, int x0, int y0, int x1, int y1, Uint32 pixel)
+{
+  double x=x1-x0;
+  double y=y1-y0;
+  double length=sqrt(x*x+y*y);
+  double addx=x/length;
+  double addy=y/length;
+  x=x0;
+  y=y0;
+  for(int i=0; i<length; i++)
+  {
+    Uint8* p=(Uint8*)dst->pixels+(int)y*dst->pitch+(int)x*dst->format->BytesPerPixel;
+    if(dst->format->BytesPerPixel==2)
+      *(Uint16*)p=(Uint16)pixel;
+    else
+      *(Uint32*)p=pixel;
+    x+=addx;
+    y+=addy;
+  }
+}
+
+// five overlapping fills mapping the colour each time, as draw_rectangle() did
+static void fillrect_rounded(SDL_Surface* dst, int x, int y, int w, int h, SDL_Color* c, SDL_Color* bc)
+{
+  SDL_Rect r[5]={{(Sint16)(x+1),(Sint16)(y+1),(Uint16)(w-2),(Uint16)(h-2)},
+                 {(Sint16)(x+2),(Sint16)y,(Uint16)(w-4),(Uint16)h},
+                 {(Sint16)x,(Sint16)(y+2),(Uint16)w,(Uint16)(h-4)},
+                 {(Sint16)(x+2),(Sint16)(y+1),(Uint16)(w-4),(Uint16)(h-2)},
+                 {(Sint16)(x+1),(Sint16)(y+2),(Uint16)(w-2),(Uint16)(h-4)}};
+  for(int f=0; f<5; f++)
+  {
+    SDL_Color* col=f<3?bc:c;
+    SDL_FillRect(dst,&r[f],SDL_MapRGB(dst->format,col->r,col->g,col->b));
+  }
+}
+
+///////////////////////////////////
+/*  Benchmark                    */
+///////////////////////////////////
+#define BENCH_LINES   64
+#define BENCH_BOXES   16
+
+static void bench_lines(SDL_Surface* dst, int frames, int bresenham)
+{
+  Uint32 colour=SDL_MapRGB(dst->format,255,255,255);
+  for(int f=0; f<frames; f++)
+  {
+    bench_frame_begin();
+    // fan of lines over the whole screen, all angles
+    for(int l=0; l<BENCH_LINES; l++)
+    {
+      int x1=l*(dst->w-1)/(BENCH_LINES-1);
+      int y1=(l&1)?0:dst->h-1;
+      if(bresenham)
+        raster_line(dst,dst->w/2,dst->h/2,x1,y1,colour);
+      else
+        float_line(dst,dst->w/2,dst->h/2,x1,y1,colour);
+    }
+    bench_frame_end();
+  }
+}
+
+static void bench_boxes(SDL_Surface* dst, int frames, int spans)
+{
+  SDL_Color c={120,132,171,0};
+  SDL_Color bc={55,37,56,0};
+  for(int f=0; f<frames; f++)
+  {
+    bench_frame_begin();
+    // clock body sized boxes
+    for(int b=0; b<BENCH_BOXES; b++)
+    {
+      int x=(b%4)*80, y=(b/4)*60;
+      if(spans)
+      {
+        Uint32 fill=SDL_MapRGB(dst->format,c.r,c.g,c.b);
+        Uint32 edge=SDL_MapRGB(dst->format,bc.r,bc.g,bc.b);
+        raster_box(dst,x,y,80,60,RASTER_ROUNDED,fill,edge,RASTER_FILL|RASTER_EDGE);
+      }
+      else
+        fillrect_rounded(dst,x,y,80,60,&c,&bc);
+    }
+    bench_frame_end();
+  }
+}
+
+void raster_bench(SDL_Surface* dst, int frames)
+{
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return;
+  SDL_SetClipRect(dst,NULL);
+  bench_case("raster_line_float",FALSE);
+  bench_lines(dst,frames,FALSE);
+  bench_case("raster_line_bresenham",FALSE);
+  bench_lines(dst,frames,TRUE);
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+
+  // SDL_FillRect locks by itself
+  bench_case("raster_rounded_fillrect",FALSE);
+  bench_boxes(dst,frames,FALSE);
+  if(SDL_MUSTLOCK(dst) && SDL_LockSurface(dst)<0)
+    return;
+  bench_case("raster_rounded_spans",FALSE);
+  bench_boxes(dst,frames,TRUE);
+  if(SDL_MUSTLOCK(dst))
+    SDL_UnlockSurface(dst);
+}
+#endif
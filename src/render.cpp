@@ -0,0 +1,537 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Damage tracking renderer                  */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <string.h>
+#include <stdlib.h>
+#include "../inc/render.h"
+#include "../inc/glyph_cache.h"
+#include "../inc/latency.h"
+#include "../inc/profiler.h"
+#include "../inc/raster.h"
+
+#define RENDER_MAX_OPS    256
+#define RENDER_MAX_DIRTY  32
+#define RENDER_TEXT_LEN   64
+
+#define OP_FILL   0
+#define OP_TEXT   1
+#define OP_BLIT   2
+#define OP_LINE   3
+#define OP_RUN    4
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct render_op
+{
+  int type;
+  SDL_Rect rect;          // screen area touched
+  Uint32 key;             // hash of all that decides the pixels
+  Uint32 colour;
+  SDL_Color c;
+  text_font* font;
+  char text[RENDER_TEXT_LEN];
+  const text_run* run;    // laid out text, kept by the caller
+  SDL_Surface* src;
+  SDL_Rect srcrect;
+  int use_srcrect;
+  Sint16 x;
+  Sint16 y;
+  Sint16 x1;              // line end
+  Sint16 y1;
+};
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static SDL_Surface* render_screen=NULL;
+static render_op render_ops[2][RENDER_MAX_OPS];
+static int render_nops[2]={0,0};
+static int render_cur=0;
+static int render_full=1;
+static int render_overflow=0;
+static int render_flash=0;
+static SDL_Rect render_dirty[RENDER_MAX_DIRTY];
+static int render_ndirty=0;
+static SDL_Rect render_flashed[RENDER_MAX_DIRTY];
+static int render_nflashed=0;
+static Uint32 stat_frames=0;
+static Uint32 stat_rects=0;
+static Uint32 stat_pixels=0;
+
+///////////////////////////////////
+/*  FNV-1a hash                  */
+///////////////////////////////////
+static Uint32 hash_bytes(Uint32 h, const void* data, int len)
+{
+  const Uint8* p=(const Uint8*)data;
+  while(len--)
+  {
+    h^=*p++;
+    h*=16777619u;
+  }
+  return h;
+}
+
+static Uint32 op_key(render_op* op)
+{
+  Uint32 h=2166136261u;
+  h=hash_bytes(h,&op->type,sizeof(op->type));
+  h=hash_bytes(h,&op->rect,sizeof(op->rect));
+  switch(op->type)
+  {
+    case OP_FILL:
+      h=hash_bytes(h,&op->colour,sizeof(op->colour));
+      break;
+    case OP_TEXT:
+      h=hash_bytes(h,&op->font,sizeof(op->font));
+      h=hash_bytes(h,&op->c,3);
+      h=hash_bytes(h,op->text,strlen(op->text));
+      break;
+    case OP_RUN:
+      h=hash_bytes(h,&op->font,sizeof(op->font));
+      h=hash_bytes(h,&op->c,3);
+      h=hash_bytes(h,op->run->ch,op->run->n*sizeof(Uint16));
+      break;
+    case OP_BLIT:
+      h=hash_bytes(h,&op->src,sizeof(op->src));
+      h=hash_bytes(h,&op->srcrect,sizeof(op->srcrect));
+      h=hash_bytes(h,&op->colour,sizeof(op->colour));   // version
+      break;
+    case OP_LINE:
+      h=hash_bytes(h,&op->colour,sizeof(op->colour));
+      h=hash_bytes(h,&op->x,sizeof(op->x));
+      h=hash_bytes(h,&op->y,sizeof(op->y));
+      h=hash_bytes(h,&op->x1,sizeof(op->x1));
+      h=hash_bytes(h,&op->y1,sizeof(op->y1));
+      break;
+  }
+  return h;
+}
+
+///////////////////////////////////
+/*  Rect helpers                 */
+///////////////////////////////////
+static int rect_intersect(const SDL_Rect* a, const SDL_Rect* b)
+{
+  return a->x<b->x+b->w && b->x<a->x+a->w && a->y<b->y+b->h && b->y<a->y+a->h;
+}
+
+static void rect_union(SDL_Rect* a, const SDL_Rect* b)
+{
+  int x1=a->x<b->x?a->x:b->x;
+  int y1=a->y<b->y?a->y:b->y;
+  int x2=(a->x+a->w)>(b->x+b->w)?(a->x+a->w):(b->x+b->w);
+  int y2=(a->y+a->h)>(b->y+b->h)?(a->y+a->h):(b->y+b->h);
+  a->x=x1;
+  a->y=y1;
+  a->w=x2-x1;
+  a->h=y2-y1;
+}
+
+// clip rect to screen, return FALSE if empty
+static int rect_clip(SDL_Rect* r)
+{
+  int x1=r->x, y1=r->y, x2=r->x+r->w, y2=r->y+r->h;
+  if(x1<0)
+    x1=0;
+  if(y1<0)
+    y1=0;
+  if(x2>render_screen->w)
+    x2=render_screen->w;
+  if(y2>render_screen->h)
+    y2=render_screen->h;
+  if(x2<=x1 || y2<=y1)
+    return 0;
+  r->x=x1;
+  r->y=y1;
+  r->w=x2-x1;
+  r->h=y2-y1;
+  return 1;
+}
+
+///////////////////////////////////
+/*  Add a damaged region         */
+///////////////////////////////////
+static void add_dirty(const SDL_Rect* rect)
+{
+  SDL_Rect r=*rect;
+  if(render_full || !rect_clip(&r))
+    return;
+
+  // merge with any overlapping region, again until nothing overlaps
+  int merged=1;
+  while(merged)
+  {
+    merged=0;
+    for(int f=0; f<render_ndirty; f++)
+    {
+      if(rect_intersect(&render_dirty[f],&r))
+      {
+        rect_union(&r,&render_dirty[f]);
+        render_dirty[f]=render_dirty[--render_ndirty];
+        merged=1;
+        break;
+      }
+    }
+  }
+
+  if(render_ndirty>=RENDER_MAX_DIRTY)
+    render_full=1;
+  else
+    render_dirty[render_ndirty++]=r;
+}
+
+///////////////////////////////////
+/*  Init                         */
+///////////////////////////////////
+void render_init(SDL_Surface* dst)
+{
+  render_screen=dst;
+  render_nops[0]=0;
+  render_nops[1]=0;
+  render_full=1;
+}
+
+void render_invalidate()
+{
+  render_full=1;
+}
+
+///////////////////////////////////
+/*  Begin frame                  */
+///////////////////////////////////
+void render_begin()
+{
+  render_cur=!render_cur;
+  render_nops[render_cur]=0;
+  render_overflow=0;
+}
+
+///////////////////////////////////
+/*  Record operations            */
+///////////////////////////////////
+static render_op* new_op(int type)
+{
+  if(render_nops[render_cur]>=RENDER_MAX_OPS)
+  {
+    render_overflow=1;
+    return NULL;
+  }
+  render_op* op=&render_ops[render_cur][render_nops[render_cur]++];
+  op->type=type;
+  return op;
+}
+
+void render_fill(const SDL_Rect* r, Uint32 colour)
+{
+  render_op* op=new_op(OP_FILL);
+  if(!op)
+    return;
+  if(r)
+    op->rect=*r;
+  else
+  {
+    op->rect.x=0;
+    op->rect.y=0;
+    op->rect.w=render_screen->w;
+    op->rect.h=render_screen->h;
+  }
+  op->colour=colour;
+  op->key=op_key(op);
+}
+
+// damaged area is the bounding box
+void render_line(int x0, int y0, int x1, int y1, Uint32 colour)
+{
+  render_op* op=new_op(OP_LINE);
+  if(!op)
+    return;
+  op->colour=colour;
+  op->x=x0;
+  op->y=y0;
+  op->x1=x1;
+  op->y1=y1;
+  op->rect.x=x0<x1?x0:x1;
+  op->rect.y=y0<y1?y0:y1;
+  op->rect.w=abs(x1-x0)+1;
+  op->rect.h=abs(y1-y0)+1;
+  op->key=op_key(op);
+}
+
+void render_text(text_font* f, const char* string, int x, int y, SDL_Color c)
+{
+  if(!f || !string || !*string)
+    return;
+  render_op* op=new_op(OP_TEXT);
+  if(!op)
+    return;
+  op->font=f;
+  op->c=c;
+  strncpy(op->text,string,RENDER_TEXT_LEN-1);
+  op->text[RENDER_TEXT_LEN-1]=0;
+  if(strlen(string)>=RENDER_TEXT_LEN)
+  {
+    // don't leave half a UTF-8 char at the cut
+    int n=RENDER_TEXT_LEN-1;
+    while(n>0 && (op->text[n]&0xC0)==0x80)
+      n--;
+    op->text[n]=0;
+  }
+  op->x=x;
+  op->y=y;
+  op->rect.x=x;
+  op->rect.y=y;
+  op->rect.w=glyphcache_width(f,op->text);
+  op->rect.h=glyphcache_height(f);
+  op->key=op_key(op);
+}
+
+void render_run(text_font* f, const text_run* run, int x, int y, SDL_Color c)
+{
+  if(!f || !run || run->n<=0)
+    return;
+  render_op* op=new_op(OP_RUN);
+  if(!op)
+    return;
+  op->font=f;
+  op->c=c;
+  op->run=run;
+  op->x=x;
+  op->y=y;
+  op->rect.x=x;
+  op->rect.y=y;
+  op->rect.w=run->width;
+  op->rect.h=glyphcache_height(f);
+  op->key=op_key(op);
+}
+
+void render_blit(SDL_Surface* src, const SDL_Rect* srcrect, int x, int y, Uint32 version)
+{
+  if(!src)
+    return;
+  render_op* op=new_op(OP_BLIT);
+  if(!op)
+    return;
+  op->src=src;
+  op->use_srcrect=(srcrect!=NULL);
+  if(srcrect)
+    op->srcrect=*srcrect;
+  else
+  {
+    op->srcrect.x=0;
+    op->srcrect.y=0;
+    op->srcrect.w=src->w;
+    op->srcrect.h=src->h;
+  }
+  op->colour=version;
+  op->x=x;
+  op->y=y;
+  op->rect.x=x;
+  op->rect.y=y;
+  op->rect.w=op->srcrect.w;
+  op->rect.h=op->srcrect.h;
+  op->key=op_key(op);
+}
+
+///////////////////////////////////
+/*  Execute one operation        */
+///////////////////////////////////
+static void draw_op(render_op* op)
+{
+  SDL_Rect dest;
+  switch(op->type)
+  {
+    case OP_FILL:
+      dest=op->rect;
+      SDL_FillRect(render_screen,&dest,op->colour);
+      break;
+    case OP_TEXT:
+      glyphcache_draw(render_screen,op->font,op->text,op->x,op->y,op->c);
+      break;
+    case OP_RUN:
+      glyphcache_draw_run(render_screen,op->font,op->run,op->x,op->y,op->c);
+      break;
+    case OP_BLIT:
+      dest.x=op->x;
+      dest.y=op->y;
+      SDL_BlitSurface(op->src,op->use_srcrect?&op->srcrect:NULL,render_screen,&dest);
+      break;
+    case OP_LINE:
+      if(SDL_MUSTLOCK(render_screen) && SDL_LockSurface(render_screen)<0)
+        break;
+      raster_line(render_screen,op->x,op->y,op->x1,op->y1,op->colour);
+      if(SDL_MUSTLOCK(render_screen))
+        SDL_UnlockSurface(render_screen);
+      break;
+  }
+}
+
+///////////////////////////////////
+/*  Compare with previous frame  */
+///////////////////////////////////
+struct op_ref
+{
+  Uint32 key;
+  SDL_Rect rect;
+};
+
+static int compare_keys(const void* a, const void* b)
+{
+  Uint32 ka=((const op_ref*)a)->key;
+  Uint32 kb=((const op_ref*)b)->key;
+  return ka<kb?-1:(ka>kb?1:0);
+}
+
+static void diff_frames()
+{
+  static op_ref sorted[2][RENDER_MAX_OPS];
+  int n[2];
+
+  // sort keys of both lists, then walk them as a merge:
+  // keys only in one of the lists are damaged regions
+  for(int f=0; f<2; f++)
+  {
+    n[f]=render_nops[f];
+    for(int i=0; i<n[f]; i++)
+    {
+      sorted[f][i].key=render_ops[f][i].key;
+      sorted[f][i].rect=render_ops[f][i].rect;
+    }
+    qsort(sorted[f],n[f],sizeof(op_ref),compare_keys);
+  }
+
+  int i=0, j=0;
+  while(i<n[0] || j<n[1])
+  {
+    if(j>=n[1] || (i<n[0] && sorted[0][i].key<sorted[1][j].key))
+      add_dirty(&sorted[0][i++].rect);
+    else if(i>=n[0] || sorted[1][j].key<sorted[0][i].key)
+      add_dirty(&sorted[1][j++].rect);
+    else
+    {
+      i++;
+      j++;
+    }
+  }
+}
+
+///////////////////////////////////
+/*  End frame, update display    */
+///////////////////////////////////
+void render_end()
+{
+  PROF_SCOPE(PROF_RENDER);
+  render_op* ops=render_ops[render_cur];
+  int nops=render_nops[render_cur];
+
+  render_ndirty=0;
+  if(render_overflow)
+    render_full=1;
+  else
+    diff_frames();
+
+  // debug: only the damage of this frame is outlined, the outlines of
+  // the previous one are redrawn without them so they don't stay
+  SDL_Rect damage[RENDER_MAX_DIRTY];
+  int ndamage=0;
+  if(render_flash)
+  {
+    if(render_full)
+    {
+      damage[0].x=0;
+      damage[0].y=0;
+      damage[0].w=render_screen->w;
+      damage[0].h=render_screen->h;
+      ndamage=1;
+    }
+    else
+    {
+      ndamage=render_ndirty;
+      memcpy(damage,render_dirty,ndamage*sizeof(SDL_Rect));
+    }
+  }
+  for(int f=0; f<render_nflashed; f++)
+    add_dirty(&render_flashed[f]);
+  render_nflashed=0;
+
+  if(render_full)
+  {
+    render_dirty[0].x=0;
+    render_dirty[0].y=0;
+    render_dirty[0].w=render_screen->w;
+    render_dirty[0].h=render_screen->h;
+    render_ndirty=1;
+    render_full=0;
+  }
+
+  if(render_ndirty==0)
+  {
+    LAT_SHOWN(0);
+    return;
+  }
+
+  for(int d=0; d<render_ndirty; d++)
+  {
+    SDL_SetClipRect(render_screen,&render_dirty[d]);
+    for(int f=0; f<nops; f++)
+      if(rect_intersect(&ops[f].rect,&render_dirty[d]))
+        draw_op(&ops[f]);
+  }
+  SDL_SetClipRect(render_screen,NULL);
+
+  if(render_flash)
+  {
+    Uint32 colour=SDL_MapRGB(render_screen->format,255,0,255);
+    for(int d=0; d<ndamage; d++)
+    {
+      SDL_Rect r=damage[d];
+      SDL_Rect line;
+      line=r; line.h=1;
+      SDL_FillRect(render_screen,&line,colour);
+      line=r; line.y=r.y+r.h-1; line.h=1;
+      SDL_FillRect(render_screen,&line,colour);
+      line=r; line.w=1;
+      SDL_FillRect(render_screen,&line,colour);
+      line=r; line.x=r.x+r.w-1; line.w=1;
+      SDL_FillRect(render_screen,&line,colour);
+      render_flashed[render_nflashed++]=r;
+    }
+  }
+
+  SDL_UpdateRects(render_screen,render_ndirty,render_dirty);
+  LAT_SHOWN(1);
+
+  stat_frames++;
+  stat_rects+=render_ndirty;
+  for(int d=0; d<render_ndirty; d++)
+    stat_pixels+=render_dirty[d].w*render_dirty[d].h;
+}
+
+///////////////////////////////////
+/*  Debug and stats              */
+///////////////////////////////////
+void render_set_flash(int flash)
+{
+  render_flash=flash;
+  render_full=1;
+}
+
+int render_get_flash()
+{
+  return render_flash;
+}
+
+void render_stats(Uint32* frames, Uint32* rects, Uint32* pixels)
+{
+  if(frames)
+    *frames=stat_frames;
+  if(rects)
+    *rects=stat_rects;
+  if(pixels)
+    *pixels=stat_pixels;
+}
@@ -0,0 +1,196 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Hardware clock writer                     */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/rtc.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <SDL/SDL.h>
+#include "../inc/rtc.h"
+#include "../inc/scheduler.h"
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static char rtc_device[256]=RTC_DEVICE;
+static SDL_Thread* rtc_thread=NULL;
+static SDL_mutex* rtc_lock=NULL;
+static SDL_cond* rtc_cond=NULL;
+// shared with the worker, under rtc_lock
+static int rtc_queued=FALSE;
+static int rtc_quit=FALSE;
+static int rtc_current=RTC_IDLE;
+
+///////////////////////////////////
+/*  Write to the device          */
+///////////////////////////////////
+static int write_device(const tm* utc)
+{
+  struct stat st;
+  if(stat(rtc_device,&st)!=0)
+    return FALSE;
+
+  if(S_ISREG(st.st_mode))
+  {
+    // fake device
+    FILE* f=fopen(rtc_device,"wb");
+    if(f==NULL)
+      return FALSE;
+    fprintf(f,"%04d-%02d-%02d %02d:%02d:%02d UTC\n",utc->tm_year+1900,utc->tm_mon+1,utc->tm_mday,
+            utc->tm_hour,utc->tm_min,utc->tm_sec);
+    return fclose(f)==0;
+  }
+
+  int fd=open(rtc_device,O_RDONLY);
+  if(fd<0)
+    return FALSE;
+  rtc_time rt;
+  memset(&rt,0,sizeof(rt));
+  rt.tm_sec=utc->tm_sec;
+  rt.tm_min=utc->tm_min;
+  rt.tm_hour=utc->tm_hour;
+  rt.tm_mday=utc->tm_mday;
+  rt.tm_mon=utc->tm_mon;
+  rt.tm_year=utc->tm_year;
+  rt.tm_wday=utc->tm_wday;
+  rt.tm_yday=utc->tm_yday;
+  int ok=(ioctl(fd,RTC_SET_TIME,&rt)==0);
+  close(fd);
+  return ok;
+}
+
+static int set_rtc()
+{
+  // the RTC only takes whole seconds, wait for the next one to start
+  timespec now;
+  clock_gettime(CLOCK_REALTIME,&now);
+  if(now.tv_nsec)
+  {
+    timespec wait={0,1000000000-now.tv_nsec};
+    nanosleep(&wait,NULL);
+    now.tv_sec++;
+  }
+
+  time_t t=now.tv_sec;
+  tm utc;
+  gmtime_r(&t,&utc);
+  if(write_device(&utc))
+    return TRUE;
+
+  // no RTC driver or no access to it
+  fprintf(stderr,"rtc: can't set %s, trying hwclock\n",rtc_device);
+  return system("hwclock --systohc --utc")==0;
+}
+
+///////////////////////////////////
+/*  Worker                       */
+///////////////////////////////////
+static int rtc_worker(void* data)
+{
+  (void)data;
+  SDL_LockMutex(rtc_lock);
+  while(TRUE)
+  {
+    while(!rtc_queued && !rtc_quit)
+      SDL_CondWait(rtc_cond,rtc_lock);
+    if(!rtc_queued)
+      break;
+
+    rtc_queued=FALSE;
+    SDL_UnlockMutex(rtc_lock);
+    int ok=set_rtc();
+    SDL_LockMutex(rtc_lock);
+
+    // still busy if the time was set again meanwhile
+    if(!rtc_queued)
+    {
+      rtc_current=ok?RTC_DONE:RTC_FAILED;
+      sched_wake();
+    }
+  }
+  SDL_UnlockMutex(rtc_lock);
+  return 0;
+}
+
+///////////////////////////////////
+/*  Init and close               */
+///////////////////////////////////
+void rtc_init(const char* device)
+{
+  if(device && device[0])
+  {
+    strncpy(rtc_device,device,sizeof(rtc_device)-1);
+    rtc_device[sizeof(rtc_device)-1]=0;
+  }
+}
+
+void rtc_close()
+{
+  if(rtc_thread==NULL)
+    return;
+  SDL_LockMutex(rtc_lock);
+  rtc_quit=TRUE;
+  SDL_CondSignal(rtc_cond);
+  SDL_UnlockMutex(rtc_lock);
+  SDL_WaitThread(rtc_thread,NULL);
+  rtc_thread=NULL;
+
+  SDL_DestroyCond(rtc_cond);
+  SDL_DestroyMutex(rtc_lock);
+  rtc_cond=NULL;
+  rtc_lock=NULL;
+}
+
+///////////////////////////////////
+/*  Requests                     */
+///////////////////////////////////
+void rtc_write()
+{
+  if(rtc_thread==NULL)
+  {
+    rtc_lock=SDL_CreateMutex();
+    rtc_cond=SDL_CreateCond();
+    if(rtc_lock && rtc_cond)
+      rtc_thread=SDL_CreateThread(rtc_worker,NULL);
+    if(rtc_thread==NULL)
+    {
+      // no threads, do it here as before
+      if(rtc_cond)
+        SDL_DestroyCond(rtc_cond);
+      if(rtc_lock)
+        SDL_DestroyMutex(rtc_lock);
+      rtc_cond=NULL;
+      rtc_lock=NULL;
+      rtc_current=set_rtc()?RTC_DONE:RTC_FAILED;
+      return;
+    }
+  }
+
+  SDL_LockMutex(rtc_lock);
+  rtc_queued=TRUE;
+  rtc_current=RTC_BUSY;
+  SDL_CondSignal(rtc_cond);
+  SDL_UnlockMutex(rtc_lock);
+}
+
+int rtc_state()
+{
+  if(rtc_lock==NULL)
+    return rtc_current;
+  SDL_LockMutex(rtc_lock);
+  int state=rtc_current;
+  SDL_UnlockMutex(rtc_lock);
+  return state;
+}
@@ -0,0 +1,346 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Frame scheduler                           */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <sys/select.h>
+#include <sys/time.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <linux/input.h>
+#include "../inc/scheduler.h"
+#include "../inc/profiler.h"
+
+#define SCHED_MAX_DEVICES   16
+#define SCHED_POLL_MS       10    // slice when there is no input device to wait on
+#define SCHED_SETTLE_MS     100   // keep polling after input, until SDL sees it
+#define SCHED_SLACK_MS      2     // wake just after the boundary, never before
+#define SCHED_AXES          (ABS_HAT3Y+1)
+#define SCHED_DEADZONE      1000  // of 32767 like the joystick, stick noise isn't input
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static int sched_fds[SCHED_MAX_DEVICES];
+static int sched_monotonic[SCHED_MAX_DEVICES];   // event times in CLOCK_MONOTONIC
+static int sched_axis_centre[SCHED_MAX_DEVICES][SCHED_AXES];
+static int sched_axis_dead[SCHED_MAX_DEVICES][SCHED_AXES];   // 0 not an axis
+static int sched_axis_out[SCHED_MAX_DEVICES][SCHED_AXES];    // past the deadzone
+static int sched_nfds=0;
+static int sched_pipe[2]={-1,-1};
+static Uint32 sched_requested=SCHED_FOREVER;
+static Uint32 sched_wakeups=0;
+static Uint32 sched_frames=0;
+static Sint64 sched_start=0;
+static Sint64 sched_lastinput=-SCHED_SETTLE_MS;
+static Sint64 sched_press=0;        // ns, last key press read from a device
+static Sint64 sched_keys[KEY_CNT];  // ns, last press of each key code
+
+///////////////////////////////////
+/*  Monotonic time in ms         */
+///////////////////////////////////
+static Sint64 now_ms()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (Sint64)ts.tv_sec*1000+ts.tv_nsec/1000000;
+}
+
+///////////////////////////////////
+/*  Init, open input devices     */
+///////////////////////////////////
+void sched_init()
+{
+  char path[32];
+
+  // same devices SDL reads, opened without grab only to wait on them
+  sched_nfds=0;
+  for(int f=0; f<32 && sched_nfds<SCHED_MAX_DEVICES; f++)
+  {
+    sprintf(path,"/dev/input/event%d",f);
+    int fd=open(path,O_RDONLY|O_NONBLOCK);
+    if(fd>=0)
+    {
+      // kernel stamps events with this clock, realtime if it can't
+      sched_monotonic[sched_nfds]=0;
+#ifdef EVIOCSCLOCKID
+      int clock=CLOCK_MONOTONIC;
+      sched_monotonic[sched_nfds]=(ioctl(fd,EVIOCSCLOCKID,&clock)==0);
+#endif
+      for(int a=0; a<SCHED_AXES; a++)
+      {
+        input_absinfo abs;
+        sched_axis_centre[sched_nfds][a]=0;
+        sched_axis_dead[sched_nfds][a]=0;
+        sched_axis_out[sched_nfds][a]=0;
+        if(ioctl(fd,EVIOCGABS(a),&abs)==0 && abs.maximum>abs.minimum)
+        {
+          sched_axis_centre[sched_nfds][a]=(abs.minimum+abs.maximum)/2;
+          sched_axis_dead[sched_nfds][a]=(int)((Sint64)(abs.maximum-abs.minimum)*SCHED_DEADZONE/65534)+1;
+        }
+      }
+      sched_fds[sched_nfds++]=fd;
+    }
+  }
+
+  if(pipe(sched_pipe)==0)
+  {
+    fcntl(sched_pipe[0],F_SETFL,O_NONBLOCK);
+    fcntl(sched_pipe[1],F_SETFL,O_NONBLOCK);
+  }
+  else
+  {
+    sched_pipe[0]=-1;
+    sched_pipe[1]=-1;
+  }
+
+  sched_start=now_ms();
+}
+
+void sched_close()
+{
+  for(int f=0; f<sched_nfds; f++)
+    close(sched_fds[f]);
+  sched_nfds=0;
+  if(sched_pipe[0]>=0)
+  {
+    close(sched_pipe[0]);
+    close(sched_pipe[1]);
+  }
+  sched_pipe[0]=-1;
+  sched_pipe[1]=-1;
+}
+
+///////////////////////////////////
+/*  Requests                     */
+///////////////////////////////////
+void sched_request(Uint32 ms)
+{
+  if(ms<sched_requested)
+    sched_requested=ms;
+}
+
+// safe from signal handlers: only write()
+void sched_wake()
+{
+  if(sched_pipe[1]>=0)
+  {
+    char c=0;
+    ssize_t r=write(sched_pipe[1],&c,1);
+    (void)r;
+  }
+}
+
+///////////////////////////////////
+/*  Discard read data            */
+///////////////////////////////////
+static void drain(int fd)
+{
+  char buf[256];
+  while(read(fd,buf,sizeof(buf))>0);
+}
+
+// input device, keeps the time of the last key press, TRUE if there
+// were keys or a stick past the deadzone (not only sync or stick noise)
+static int drain_device(int f)
+{
+  input_event ev[16];
+  ssize_t n;
+  int input=0;
+  while((n=read(sched_fds[f],ev,sizeof(ev)))>0)
+  {
+    for(int e=0; e<(int)(n/sizeof(input_event)); e++)
+    {
+      // stick moved out of the deadzone or back into it
+      int a=ev[e].code;
+      if(ev[e].type==EV_ABS && a<SCHED_AXES && sched_axis_dead[f][a])
+      {
+        int d=ev[e].value-sched_axis_centre[f][a];
+        int out=(d>=sched_axis_dead[f][a] || d<=-sched_axis_dead[f][a]);
+        if(out || sched_axis_out[f][a])
+          input=1;
+        sched_axis_out[f][a]=out;
+      }
+      if(ev[e].type!=EV_KEY)
+        continue;
+      input=1;
+      if(ev[e].value!=1)
+        continue;
+      Sint64 t=(Sint64)ev[e].time.tv_sec*1000000000LL+(Sint64)ev[e].time.tv_usec*1000;
+      if(!sched_monotonic[f])
+      {
+        timespec real, mono;
+        clock_gettime(CLOCK_REALTIME,&real);
+        clock_gettime(CLOCK_MONOTONIC,&mono);
+        t-=((Sint64)real.tv_sec-mono.tv_sec)*1000000000LL+real.tv_nsec-mono.tv_nsec;
+      }
+      if(t>sched_press)
+        sched_press=t;
+      if(ev[e].code<KEY_CNT)
+        sched_keys[ev[e].code]=t;
+    }
+  }
+  return input;
+}
+
+Sint64 sched_input_press()
+{
+  for(int f=0; f<sched_nfds; f++)
+    drain_device(f);
+  Sint64 t=sched_press;
+  sched_press=0;
+  return t;
+}
+
+Sint64 sched_key_press(int code)
+{
+  if(code<0 || code>=KEY_CNT)
+    return 0;
+  for(int f=0; f<sched_nfds; f++)
+    drain_device(f);
+  return sched_keys[code];
+}
+
+///////////////////////////////////
+/*  Sleep until deadline/input   */
+///////////////////////////////////
+void sched_wait(Uint32 timeout)
+{
+  PROF_SCOPE(PROF_SLEEP);
+  if(sched_requested<timeout)
+    timeout=sched_requested;
+  sched_requested=SCHED_FOREVER;
+  sched_frames++;
+
+  Sint64 now=now_ms();
+  Sint64 deadline=(timeout==SCHED_FOREVER)?-1:now+timeout;
+
+  for(;;)
+  {
+    SDL_PumpEvents();
+    SDL_Event event;
+    if(SDL_PeepEvents(&event,1,SDL_PEEKEVENT,SDL_ALLEVENTS)>0)
+      return;
+
+    now=now_ms();
+    if(deadline>=0 && now>=deadline)
+      return;
+    Sint64 remaining=(deadline>=0)?deadline-now:-1;
+
+    // without devices, or just after input (SDL may not have read it
+    // yet), poll in short slices
+    if(sched_nfds==0 || now-sched_lastinput<SCHED_SETTLE_MS)
+    {
+      Sint64 slice=SCHED_POLL_MS;
+      if(remaining>=0 && remaining<slice)
+        slice=remaining;
+      SDL_Delay((Uint32)slice);
+      sched_wakeups++;
+      continue;
+    }
+
+    fd_set set;
+    int maxfd=-1;
+    FD_ZERO(&set);
+    for(int f=0; f<sched_nfds; f++)
+    {
+      FD_SET(sched_fds[f],&set);
+      if(sched_fds[f]>maxfd)
+        maxfd=sched_fds[f];
+    }
+    if(sched_pipe[0]>=0)
+    {
+      FD_SET(sched_pipe[0],&set);
+      if(sched_pipe[0]>maxfd)
+        maxfd=sched_pipe[0];
+    }
+
+    timeval tv;
+    timeval* ptv=NULL;
+    if(remaining>=0)
+    {
+      tv.tv_sec=remaining/1000;
+      tv.tv_usec=(remaining%1000)*1000;
+      ptv=&tv;
+    }
+    int r=select(maxfd+1,&set,NULL,NULL,ptv);
+    sched_wakeups++;
+    if(r<0)
+    {
+      if(errno==EINTR)
+        return;     // signal, let the loop see it
+      continue;
+    }
+    if(r>0)
+    {
+      if(sched_pipe[0]>=0 && FD_ISSET(sched_pipe[0],&set))
+      {
+        drain(sched_pipe[0]);
+        return;
+      }
+      // poll until SDL has it, only for keys and moved sticks
+      int input=0;
+      for(int f=0; f<sched_nfds; f++)
+        if(FD_ISSET(sched_fds[f],&set) && drain_device(f))
+          input=1;
+      if(input)
+        sched_lastinput=now_ms();
+    }
+  }
+}
+
+///////////////////////////////////
+/*  Wall clock boundaries        */
+///////////////////////////////////
+Uint32 sched_to_next_second()
+{
+  timespec ts;
+  clock_gettime(CLOCK_REALTIME,&ts);
+  return 1000-ts.tv_nsec/1000000+SCHED_SLACK_MS;
+}
+
+Uint32 sched_to_midnight()
+{
+  time_t now=time(0);
+  tm midnight;
+  localtime_r(&now,&midnight);
+  midnight.tm_mday++;
+  midnight.tm_hour=0;
+  midnight.tm_min=0;
+  midnight.tm_sec=0;
+  midnight.tm_isdst=-1;     // days with DST change are not 24h
+  time_t t=mktime(&midnight);
+  if(t==(time_t)-1 || t<=now)
+    return sched_to_next_second();
+  return (Uint32)(t-now-1)*1000+sched_to_next_second();
+}
+
+// wall clock time t, alarms
+Uint32 sched_to_time(time_t t)
+{
+  time_t now=time(0);
+  if(t<=now)
+    return sched_to_next_second();
+  if(t-now>SCHED_FOREVER/1000-1)
+    return SCHED_FOREVER;
+  return (Uint32)(t-now-1)*1000+sched_to_next_second();
+}
+
+///////////////////////////////////
+/*  Stats                        */
+///////////////////////////////////
+void sched_stats(Uint32* wakeups, Uint32* frames, double* seconds)
+{
+  if(wakeups)
+    *wakeups=sched_wakeups;
+  if(frames)
+    *frames=sched_frames;
+  if(seconds)
+    *seconds=(now_ms()-sched_start)/1000.0;
+}
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Sprite sheets                             */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include "../inc/sprites.h"
+
+///////////////////////////////////
+/*  Convert to screen format     */
+///////////////////////////////////
+SDL_Surface* sprite_convert(SDL_Surface* src)
+{
+  if(!src)
+    return NULL;
+
+  // same format as screen, so blits don't convert pixels, and RLE
+  // so transparent runs are skipped instead of tested pixel by pixel
+  SDL_Surface* s=SDL_DisplayFormat(src);
+  SDL_FreeSurface(src);
+  if(s)
+    SDL_SetColorKey(s,SDL_SRCCOLORKEY|SDL_RLEACCEL,SDL_MapRGB(s->format,255,0,255));
+  return s;
+}
+
+///////////////////////////////////
+/*  Load sheet                   */
+///////////////////////////////////
+SDL_Surface* sprite_load_sheet(SDL_RWops* rw)
+{
+  if(!rw)
+    return NULL;
+  return sprite_convert(SDL_LoadBMP_RW(rw,1));
+}
+
+///////////////////////////////////
+/*  Sprite table of a sheet      */
+///////////////////////////////////
+void sprite_slice(SDL_Surface* sheet, sprite* table, int count, int w, int h)
+{
+  for(int f=0; f<count; f++)
+  {
+    table[f].sheet=NULL;
+    table[f].rect.x=f*w;
+    table[f].rect.y=0;
+    table[f].rect.w=w;
+    table[f].rect.h=h;
+    // cells outside the sheet are left empty
+    if(sheet && (f+1)*w<=sheet->w && h<=sheet->h)
+      table[f].sheet=sheet;
+  }
+}
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Stopwatch and countdown                   */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <time.h>
+#include "../inc/stopwatch.h"
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Monotonic time in ns         */
+///////////////////////////////////
+Sint64 mono_now()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (Sint64)ts.tv_sec*STOPWATCH_NS+ts.tv_nsec;
+}
+
+///////////////////////////////////
+/*  Stopwatch                    */
+///////////////////////////////////
+void stopwatch_reset(stopwatch* sw)
+{
+  sw->running=FALSE;
+  sw->start=0;
+  sw->elapsed=0;
+  sw->laps=0;
+}
+
+void stopwatch_start(stopwatch* sw, Sint64 t)
+{
+  if(sw->running)
+    return;
+  sw->start=t;
+  sw->running=TRUE;
+}
+
+void stopwatch_stop(stopwatch* sw, Sint64 t)
+{
+  if(!sw->running)
+    return;
+  sw->elapsed+=t-sw->start;
+  sw->running=FALSE;
+}
+
+int stopwatch_lap(stopwatch* sw, Sint64 t)
+{
+  if(sw->laps>=STOPWATCH_LAPS)
+    return FALSE;
+  sw->lap[sw->laps++]=stopwatch_time(sw,t);
+  return TRUE;
+}
+
+Sint64 stopwatch_time(const stopwatch* sw, Sint64 t)
+{
+  if(!sw->running)
+    return sw->elapsed;
+  return sw->elapsed+t-sw->start;
+}
+
+///////////////////////////////////
+/*  Countdown                    */
+///////////////////////////////////
+void countdown_set(countdown* cd, Sint64 duration)
+{
+  cd->running=FALSE;
+  cd->expired=FALSE;
+  cd->duration=duration;
+  cd->left=duration;
+  cd->end=0;
+}
+
+void countdown_start(countdown* cd, Sint64 t)
+{
+  if(cd->running || cd->left<=0)
+    return;
+  cd->end=t+cd->left;
+  cd->expired=FALSE;
+  cd->running=TRUE;
+}
+
+void countdown_pause(countdown* cd, Sint64 t)
+{
+  if(!cd->running)
+    return;
+  cd->left=countdown_left(cd,t);
+  cd->running=FALSE;
+}
+
+Sint64 countdown_left(const countdown* cd, Sint64 t)
+{
+  if(!cd->running)
+    return cd->left;
+  if(t>=cd->end)
+    return 0;
+  return cd->end-t;
+}
+
+int countdown_check(countdown* cd, Sint64 t)
+{
+  if(!cd->running || t<cd->end)
+    return FALSE;
+  cd->running=FALSE;
+  cd->expired=TRUE;
+  cd->left=0;
+  return TRUE;
+}
+
+///////////////////////////////////
+/*  Split for display            */
+///////////////////////////////////
+void stopwatch_split(Sint64 ns, int round_up, int* hours, int* min, int* sec, int* cs)
+{
+  Sint64 c=round_up?(ns+STOPWATCH_NS/100-1)/(STOPWATCH_NS/100):ns/(STOPWATCH_NS/100);
+  *cs=(int)(c%100);
+  c/=100;
+  *sec=(int)(c%60);
+  c/=60;
+  *min=(int)(c%60);
+  *hours=(int)(c/60);
+}
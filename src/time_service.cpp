@@ -0,0 +1,191 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Time service                              */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <string.h>
+#include "../inc/time_service.h"
+
+#define TRUE   1
+#define FALSE  0
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static time_t svc_now=0;
+static tm svc_tm;
+static int svc_valid=FALSE;
+static time_t svc_fixed=0;
+static char digit_pairs[100][2];
+static int digit_pairs_ready=FALSE;
+
+///////////////////////////////////
+/*  Read clock                   */
+///////////////////////////////////
+int timesvc_update()
+{
+  time_t now=svc_fixed?svc_fixed:time(0);
+  if(svc_valid && now==svc_now)
+    return FALSE;
+
+  // inside the same minute only the seconds move (time zone and DST
+  // changes are on minute boundaries), anything else asks libc
+  if(svc_valid && now>svc_now && svc_tm.tm_sec+(now-svc_now)<60)
+    svc_tm.tm_sec+=(int)(now-svc_now);
+  else
+    localtime_r(&now,&svc_tm);
+
+  svc_now=now;
+  svc_valid=TRUE;
+  return TRUE;
+}
+
+time_t timesvc_now()
+{
+  if(!svc_valid)
+    timesvc_update();
+  return svc_now;
+}
+
+const tm* timesvc_tm()
+{
+  if(!svc_valid)
+    timesvc_update();
+  return &svc_tm;
+}
+
+void timesvc_set_fixed(time_t t)
+{
+  svc_fixed=t;
+}
+
+///////////////////////////////////
+/*  Number to text               */
+///////////////////////////////////
+static void init_digit_pairs()
+{
+  for(int f=0; f<100; f++)
+  {
+    digit_pairs[f][0]='0'+f/10;
+    digit_pairs[f][1]='0'+f%10;
+  }
+  digit_pairs_ready=TRUE;
+}
+
+// two digits, zero padded
+static char* put2(char* dst, int v)
+{
+  dst[0]=digit_pairs[v][0];
+  dst[1]=digit_pairs[v][1];
+  return dst+2;
+}
+
+// year without padding, like %Y
+static char* put_year(char* dst, int year)
+{
+  if(year>=1000)
+  {
+    dst=put2(dst,year/100);
+    return put2(dst,year%100);
+  }
+  if(year>=100)
+    *dst++='0'+year/100;
+  if(year>=10)
+    *dst++=digit_pairs[year%100][0];
+  *dst++=digit_pairs[year%100][1];
+  return dst;
+}
+
+///////////////////////////////////
+/*  Build texts of a time        */
+///////////////////////////////////
+static void format_time(time_text* tt, const tm* t, int format_24)
+{
+  int hour=t->tm_hour;
+  if(!format_24)
+  {
+    hour%=12;
+    if(hour==0)
+      hour=12;
+  }
+  char* p=put2(tt->time,hour);
+  *p++=':';
+  p=put2(p,t->tm_min);
+  *p=0;
+
+  tt->seconds[0]=':';
+  put2(tt->seconds+1,t->tm_sec);
+  tt->seconds[3]=0;
+
+  tt->ampm[0]=(t->tm_hour<12)?'A':'P';
+  tt->ampm[1]='M';
+  tt->ampm[2]=0;
+}
+
+static void format_date(time_text* tt, const tm* t, const char* const* months)
+{
+  char* date=tt->date;
+  for(int f=0; f<3; f++)
+  {
+    char* p=tt->part[f];
+    switch(tt->ord[f])
+    {
+      case 0:
+        p=put2(p,t->tm_mday);
+        break;
+      case 1:
+        {
+          int len=strlen(months[t->tm_mon]);
+          if(len>20)
+            len=20;
+          memcpy(p,months[t->tm_mon],len);
+          p+=len;
+        }
+        break;
+      case 2:
+        p=put_year(p,t->tm_year+1900);
+        break;
+    }
+    if(f<2)
+      *p++=' ';
+    *p=0;
+
+    int len=p-tt->part[f];
+    memcpy(date,tt->part[f],len);
+    date+=len;
+  }
+  *date=0;
+}
+
+void timesvc_format(time_text* tt, const tm* t, int format_24, const char* const* months, int ord1, int ord2, int ord3)
+{
+  if(!digit_pairs_ready)
+    init_digit_pairs();
+
+  if(!tt->valid || tt->sec!=t->tm_sec || tt->min!=t->tm_min || tt->hour!=t->tm_hour || tt->format_24!=format_24)
+  {
+    format_time(tt,t,format_24);
+    tt->sec=t->tm_sec;
+    tt->min=t->tm_min;
+    tt->hour=t->tm_hour;
+    tt->format_24=format_24;
+  }
+
+  // date texts only change once a day, or with settings
+  if(!tt->valid || tt->mday!=t->tm_mday || tt->mon!=t->tm_mon || tt->year!=t->tm_year || tt->months!=months ||
+     tt->ord[0]!=ord1 || tt->ord[1]!=ord2 || tt->ord[2]!=ord3)
+  {
+    tt->ord[0]=ord1;
+    tt->ord[1]=ord2;
+    tt->ord[2]=ord3;
+    format_date(tt,t,months);
+    tt->mday=t->tm_mday;
+    tt->mon=t->tm_mon;
+    tt->year=t->tm_year;
+    tt->months=months;
+  }
+
+  tt->valid=TRUE;
+}
@@ -0,0 +1,593 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  World clock                               */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../inc/world_clock.h"
+#include "../inc/civil_date.h"
+
+#define TRUE   1
+#define FALSE  0
+
+#define ZONE_NAME       64
+#define ZONE_ABBR       16
+#define ZONE_FILE_MAX   (256*1024)    // biggest TZif files are ~4 KB
+
+#define ZONE_NEW        0
+#define ZONE_READY      1
+#define ZONE_FAILED     2
+
+#define TIME_FIRST      (-((Sint64)1<<62))
+#define TIME_LAST       ((Sint64)1<<62)
+
+#define RULE_JULIAN     0     // Jn, 1..365 without february 29
+#define RULE_DAY        1     // n, 0..365
+#define RULE_MONTH      2     // Mm.w.d
+
+///////////////////////////////////
+/*  Structs                      */
+///////////////////////////////////
+struct zone_type
+{
+  Sint32 utoff;       // s east of UTC
+  Uint8 isdst;
+  Uint16 abbr;        // index in chars
+};
+
+struct zone
+{
+  char name[ZONE_NAME];
+  char city[ZONE_NAME];
+  int state;
+  // one block: when[count], types[types_n], type[count], chars
+  void* data;
+  Sint64* when;       // transition times, sorted
+  Uint8* type;        // type from when[i] on
+  zone_type* types;   // types[0] before the first transition
+  char* chars;
+  int count;
+  int types_n;
+  // last lookup, current type in [from,until)
+  Sint64 from;
+  Sint64 until;
+  int current;
+};
+
+struct rule_date
+{
+  int kind;
+  int m, w, d;        // RULE_MONTH
+  int n;              // RULE_JULIAN and RULE_DAY
+  Sint32 time;        // local s from midnight
+};
+
+// POSIX TZ string of the footer, "CET-1CEST,M3.5.0,M10.5.0/3"
+struct posix_tz
+{
+  char std[ZONE_ABBR];
+  char dst[ZONE_ABBR];
+  Sint32 std_off;     // s east of UTC
+  Sint32 dst_off;
+  int has_dst;
+  rule_date start;
+  rule_date end;
+};
+
+///////////////////////////////////
+/*  Globals                      */
+///////////////////////////////////
+static char zoneinfo[256]=WORLD_ZONEINFO;
+static zone zones[WORLD_MAX];
+static int zones_n=0;
+static Uint32 lookup_hits=0;
+static Uint32 lookup_misses=0;
+
+///////////////////////////////////
+/*  TZif fields, big endian      */
+///////////////////////////////////
+static Sint32 be32(const Uint8* p)
+{
+  return (Sint32)(((Uint32)p[0]<<24)|((Uint32)p[1]<<16)|((Uint32)p[2]<<8)|p[3]);
+}
+
+static Sint64 be64(const Uint8* p)
+{
+  return (Sint64)(((Uint64)(Uint32)be32(p)<<32)|(Uint32)be32(p+4));
+}
+
+static Sint64 floor_div(Sint64 a, Sint64 b)
+{
+  return (a>=0?a:a-(b-1))/b;
+}
+
+///////////////////////////////////
+/*  POSIX TZ footer              */
+///////////////////////////////////
+// "CET" or "<+0330>"
+static int parse_name(const char** s, char* out)
+{
+  const char* p=*s;
+  int n=0;
+  if(*p=='<')
+  {
+    for(p++; *p && *p!='>'; p++)
+      if(n<ZONE_ABBR-1)
+        out[n++]=*p;
+    if(*p!='>')
+      return FALSE;
+    p++;
+  }
+  else
+  {
+    for(; (*p>='A' && *p<='Z') || (*p>='a' && *p<='z'); p++)
+      if(n<ZONE_ABBR-1)
+        out[n++]=*p;
+  }
+  out[n]=0;
+  *s=p;
+  return n>0;
+}
+
+// [+-]hh[:mm[:ss]], hours up to 167 in rule times
+static int parse_hms(const char** s, Sint32* v)
+{
+  const char* p=*s;
+  int sign=1;
+  if(*p=='+' || *p=='-')
+    sign=(*p++=='-')?-1:1;
+  if(*p<'0' || *p>'9')
+    return FALSE;
+  Sint32 part[3]={0,0,0};
+  for(int i=0; i<3; i++)
+  {
+    while(*p>='0' && *p<='9')
+      part[i]=part[i]*10+(*p++-'0');
+    if(i==2 || *p!=':')
+      break;
+    p++;
+  }
+  *v=sign*(part[0]*3600+part[1]*60+part[2]);
+  *s=p;
+  return TRUE;
+}
+
+// Jn, n or Mm.w.d, then [/time]
+static int parse_rule(const char** s, rule_date* r)
+{
+  const char* p=*s;
+  if(*p=='J')
+  {
+    r->kind=RULE_JULIAN;
+    r->n=(int)strtol(p+1,(char**)&p,10);
+  }
+  else if(*p=='M')
+  {
+    r->kind=RULE_MONTH;
+    r->m=(int)strtol(p+1,(char**)&p,10);
+    if(*p!='.')
+      return FALSE;
+    r->w=(int)strtol(p+1,(char**)&p,10);
+    if(*p!='.')
+      return FALSE;
+    r->d=(int)strtol(p+1,(char**)&p,10);
+    if(r->m<1 || r->m>12 || r->w<1 || r->w>5 || r->d<0 || r->d>6)
+      return FALSE;
+  }
+  else if(*p>='0' && *p<='9')
+  {
+    r->kind=RULE_DAY;
+    r->n=(int)strtol(p,(char**)&p,10);
+  }
+  else
+    return FALSE;
+
+  r->time=2*3600;
+  if(*p=='/' && (p++,!parse_hms(&p,&r->time)))
+    return FALSE;
+  *s=p;
+  return TRUE;
+}
+
+// offsets in the string are west of UTC
+static int parse_posix_tz(const char* s, posix_tz* tz)
+{
+  Sint32 off;
+  memset(tz,0,sizeof(posix_tz));
+  if(!parse_name(&s,tz->std) || !parse_hms(&s,&off))
+    return FALSE;
+  tz->std_off=-off;
+  if(*s==0)
+    return TRUE;
+
+  if(!parse_name(&s,tz->dst))
+    return FALSE;
+  tz->dst_off=tz->std_off+3600;
+  if(*s!=',' && *s)
+  {
+    if(!parse_hms(&s,&off))
+      return FALSE;
+    tz->dst_off=-off;
+  }
+  // footers always give the rules with a dst name
+  if(*s++!=',' || !parse_rule(&s,&tz->start) || *s++!=',' || !parse_rule(&s,&tz->end))
+    return FALSE;
+  tz->has_dst=TRUE;
+  return TRUE;
+}
+
+// UTC time of rule r in year y, offset: the one in effect before it
+static Sint64 rule_time(const rule_date* r, Sint64 y, Sint32 offset)
+{
+  Sint64 day=days_from_civil(y,1,1);
+  switch(r->kind)
+  {
+    case RULE_JULIAN:
+      day+=r->n-1+((civil_is_leap(y) && r->n>=60)?1:0);
+      break;
+    case RULE_DAY:
+      day+=r->n;
+      break;
+    default:
+    {
+      // day d of week w, 5 is the last one
+      Sint64 first=days_from_civil(y,r->m,1);
+      int mday=1+(r->d-(int)civil_weekday(first)+7)%7+(r->w-1)*7;
+      while(mday>(int)civil_days_in_month(y,r->m))
+        mday-=7;
+      day=first+mday-1;
+      break;
+    }
+  }
+  return day*86400+r->time-offset;
+}
+
+///////////////////////////////////
+/*  Zone types                   */
+///////////////////////////////////
+// type with these fields, added if there is none
+static int find_type(zone* z, Sint32 utoff, int isdst, const char* abbr, int* chars_n)
+{
+  for(int i=0; i<z->types_n; i++)
+    if(z->types[i].utoff==utoff && z->types[i].isdst==isdst && strcmp(z->chars+z->types[i].abbr,abbr)==0)
+      return i;
+  zone_type* t=&z->types[z->types_n];
+  t->utoff=utoff;
+  t->isdst=(Uint8)isdst;
+  t->abbr=(Uint16)*chars_n;
+  strcpy(z->chars+*chars_n,abbr);
+  *chars_n+=strlen(abbr)+1;
+  return z->types_n++;
+}
+
+static void add_transition(zone* z, Sint64 t, int type)
+{
+  if(z->count && t<=z->when[z->count-1])
+    return;
+  z->when[z->count]=t;
+  z->type[z->count]=(Uint8)type;
+  z->count++;
+}
+
+///////////////////////////////////
+/*  Read a TZif file             */
+///////////////////////////////////
+static Uint8* read_file(const char* path, long* len)
+{
+  FILE* f=fopen(path,"rb");
+  if(f==NULL)
+    return NULL;
+  Uint8* buf=NULL;
+  if(fseek(f,0,SEEK_END)==0 && (*len=ftell(f))>=44 && *len<=ZONE_FILE_MAX && fseek(f,0,SEEK_SET)==0)
+  {
+    buf=(Uint8*)malloc(*len+1);
+    if(buf && fread(buf,1,*len,f)!=(size_t)*len)
+    {
+      free(buf);
+      buf=NULL;
+    }
+  }
+  fclose(f);
+  return buf;
+}
+
+// counts of a header: isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt
+static int read_header(const Uint8* p, long left, Sint32* cnt)
+{
+  if(left<44 || memcmp(p,"TZif",4)!=0)
+    return FALSE;
+  for(int i=0; i<6; i++)
+  {
+    cnt[i]=be32(p+20+i*4);
+    if(cnt[i]<0 || cnt[i]>ZONE_FILE_MAX)
+      return FALSE;
+  }
+  // types are a byte, with room for the two of the footer
+  return cnt[4]>=1 && cnt[4]<=254 && cnt[5]>=1 && cnt[5]<=256;
+}
+
+static long block_size(const Sint32* cnt, int time_size)
+{
+  return cnt[3]*(long)(time_size+1)+cnt[4]*6L+cnt[5]+cnt[2]*(long)(time_size+4)+cnt[1]+cnt[0];
+}
+
+static int load_zone(zone* z)
+{
+  char path[512];
+  long len;
+  Sint32 cnt[6];
+
+  // names come from cities.ini, stay inside the zoneinfo directory
+  if(z->name[0]=='/' || strstr(z->name,".."))
+    return FALSE;
+  snprintf(path,512,"%s/%s",zoneinfo,z->name);
+  Uint8* file=read_file(path,&len);
+  if(file==NULL)
+    return FALSE;
+  file[len]=0;
+
+  // version 1 data has 32 bit times, from version 2 it is followed by
+  // the same with 64 bit times and the footer
+  const Uint8* p=file;
+  int time_size=4;
+  const char* footer=NULL;
+  if(!read_header(p,len,cnt) || 44+block_size(cnt,4)>len)
+  {
+    free(file);
+    return FALSE;
+  }
+  if(p[4]>='2')
+  {
+    p+=44+block_size(cnt,4);
+    if(!read_header(p,len-(p-file),cnt) || (p-file)+44+block_size(cnt,8)>len)
+    {
+      free(file);
+      return FALSE;
+    }
+    time_size=8;
+    footer=(const char*)p+44+block_size(cnt,8);
+    if(footer>=(const char*)file+len || *footer!='\n')
+      footer=NULL;
+  }
+  p+=44;
+
+  posix_tz tz;
+  int rules=FALSE;
+  if(footer)
+  {
+    char text[64];
+    int n=0;
+    for(footer++; *footer && *footer!='\n' && n<63; footer++)
+      text[n++]=*footer;
+    text[n]=0;
+    rules=parse_posix_tz(text,&tz) && tz.has_dst;
+  }
+
+  // years of transitions from the footer rules
+  int timecnt=cnt[3], typecnt=cnt[4], charcnt=cnt[5];
+  Sint64 last=timecnt?(time_size==8?be64(p+(timecnt-1)*8):be32(p+(timecnt-1)*4)):0;
+  Sint64 first_year=civil_from_days(floor_div(last,86400)).year;
+  int extra=(rules && first_year<=WORLD_LAST_YEAR)?(int)(WORLD_LAST_YEAR-first_year+1)*2:0;
+
+  // all in one block, sized for the types and names of the footer too
+  int count_max=timecnt+extra;
+  int types_max=typecnt+2;
+  int chars_max=charcnt+2*ZONE_ABBR;
+  z->data=malloc(count_max*sizeof(Sint64)+types_max*sizeof(zone_type)+count_max+chars_max);
+  if(z->data==NULL)
+  {
+    free(file);
+    return FALSE;
+  }
+  z->when=(Sint64*)z->data;
+  z->types=(zone_type*)(z->when+count_max);
+  z->type=(Uint8*)(z->types+types_max);
+  z->chars=(char*)(z->type+count_max);
+  z->count=0;
+  z->types_n=typecnt;
+
+  const Uint8* times=p;
+  const Uint8* idx=times+timecnt*time_size;
+  const Uint8* ttinfo=idx+timecnt;
+  memcpy(z->chars,ttinfo+typecnt*6,charcnt);
+  z->chars[charcnt-1]=0;
+  int chars_n=charcnt;
+  int ok=TRUE;
+  for(int i=0; i<typecnt; i++)
+  {
+    const Uint8* t=ttinfo+i*6;
+    z->types[i].utoff=be32(t);
+    z->types[i].isdst=t[4]?1:0;
+    z->types[i].abbr=t[5];
+    if(t[5]>=charcnt)
+      ok=FALSE;
+  }
+  for(int i=0; i<timecnt && ok; i++)
+  {
+    if(idx[i]>=typecnt)
+      ok=FALSE;
+    else
+      add_transition(z,time_size==8?be64(times+i*8):be32(times+i*4),idx[i]);
+  }
+  free(file);
+  if(!ok)
+  {
+    free(z->data);
+    z->data=NULL;
+    return FALSE;
+  }
+
+  if(extra)
+  {
+    int std=find_type(z,tz.std_off,FALSE,tz.std,&chars_n);
+    int dst=find_type(z,tz.dst_off,TRUE,tz.dst,&chars_n);
+    for(Sint64 y=first_year; y<=WORLD_LAST_YEAR; y++)
+    {
+      // dst starts from standard time and ends from daylight time,
+      // the end comes first in the south
+      Sint64 start=rule_time(&tz.start,y,tz.std_off);
+      Sint64 end=rule_time(&tz.end,y,tz.dst_off);
+      if(start<end)
+      {
+        add_transition(z,start,dst);
+        add_transition(z,end,std);
+      }
+      else
+      {
+        add_transition(z,end,std);
+        add_transition(z,start,dst);
+      }
+    }
+  }
+
+  z->from=0;
+  z->until=0;
+  return TRUE;
+}
+
+///////////////////////////////////
+/*  Zones                        */
+///////////////////////////////////
+void world_init(const char* root)
+{
+  snprintf(zoneinfo,256,"%s",root?root:WORLD_ZONEINFO);
+}
+
+void world_free()
+{
+  for(int i=0; i<zones_n; i++)
+    free(zones[i].data);
+  memset(zones,0,sizeof(zones));
+  zones_n=0;
+}
+
+int world_add(const char* name)
+{
+  if(zones_n>=WORLD_MAX)
+    return WORLD_NONE;
+  zone* z=&zones[zones_n];
+  memset(z,0,sizeof(zone));
+  snprintf(z->name,ZONE_NAME,"%s",name);
+
+  const char* city=strrchr(z->name,'/');
+  snprintf(z->city,ZONE_NAME,"%s",city?city+1:z->name);
+  for(char* c=z->city; *c; c++)
+    if(*c=='_')
+      *c=' ';
+  return zones_n++;
+}
+
+int world_load_list(const char* path)
+{
+  FILE* file=fopen(path,"r");
+  if(file==NULL)
+    return FALSE;
+
+  char str[100];
+  char var[50];
+  char name[ZONE_NAME];
+  while(fgets(str,100,file)!=NULL)
+  {
+    if(sscanf(str,"%49s %63s",var,name)==2 && strcmp(var,"City")==0)
+      world_add(name);
+  }
+  fclose(file);
+  return TRUE;
+}
+
+int world_load()
+{
+  int ready=0;
+  for(int i=0; i<zones_n; i++)
+  {
+    zone* z=&zones[i];
+    if(z->state==ZONE_NEW)
+    {
+      z->state=load_zone(z)?ZONE_READY:ZONE_FAILED;
+      if(z->state==ZONE_FAILED)
+        fprintf(stderr,"world clock: can't read %s/%s\n",zoneinfo,z->name);
+    }
+    if(z->state==ZONE_READY)
+      ready++;
+  }
+  return ready;
+}
+
+int world_count()
+{
+  return zones_n;
+}
+
+const char* world_city(int i)
+{
+  return zones[i].city;
+}
+
+const char* world_zone(int i)
+{
+  return zones[i].name;
+}
+
+///////////////////////////////////
+/*  Offset at a time             */
+///////////////////////////////////
+int world_offset(int i, time_t t, int* offset, const char** abbr)
+{
+  zone* z=&zones[i];
+  if(z->state!=ZONE_READY)
+    return FALSE;
+
+  if(t>=z->from && t<z->until)
+    lookup_hits++;
+  else
+  {
+    // first transition after t
+    int lo=0, hi=z->count;
+    while(lo<hi)
+    {
+      int mid=(lo+hi)/2;
+      if(z->when[mid]<=t)
+        lo=mid+1;
+      else
+        hi=mid;
+    }
+    z->current=lo?z->type[lo-1]:0;
+    z->from=lo?z->when[lo-1]:TIME_FIRST;
+    z->until=lo<z->count?z->when[lo]:TIME_LAST;
+    lookup_misses++;
+  }
+
+  const zone_type* type=&z->types[z->current];
+  *offset=type->utoff;
+  if(abbr)
+    *abbr=z->chars+type->abbr;
+  return TRUE;
+}
+
+void world_tm(time_t t, int offset, tm* out)
+{
+  Sint64 local=(Sint64)t+offset;
+  Sint64 days=floor_div(local,86400);
+  int secs=(int)(local-days*86400);
+  civil_date c=civil_from_days(days);
+
+  memset(out,0,sizeof(tm));
+  out->tm_year=(int)(c.year-1900);
+  out->tm_mon=c.month-1;
+  out->tm_mday=c.day;
+  out->tm_hour=secs/3600;
+  out->tm_min=secs/60%60;
+  out->tm_sec=secs%60;
+  out->tm_wday=civil_weekday(days);
+  out->tm_yday=civil_yearday(c);
+}
+
+void world_stats(Uint32* hits, Uint32* misses)
+{
+  *hits=lookup_hits;
+  *misses=lookup_misses;
+}
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Test: blend kernels                       */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+// The vector kernel of the host (SSE2 on x86, NEON on ARM) against the
+// plain C one: every coverage over every RGB565 value in some colours,
+// then random rows of every length up to 40 for the tails.
+
+#if !defined(BLEND_NEON) && !defined(BLEND_SSE2)
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BLEND_NEON
+#elif defined(__SSE2__)
+#define BLEND_SSE2
+#endif
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include "../src/blend.cpp"
+
+static int failed=0;
+
+static void check_row(const Uint16* pixels, const Uint8* mask, int n, Uint16 colour)
+{
+  Uint16 vec[256], ref[256];
+  memcpy(vec,pixels,n*sizeof(Uint16));
+  memcpy(ref,pixels,n*sizeof(Uint16));
+  blend_a8_rgb565(vec,mask,n,colour);
+  blend_c(ref,mask,n,colour);
+  for(int i=0; i<n; i++)
+    if(vec[i]!=ref[i] && failed++<10)
+      printf("blend: colour %04x over %04x at %d: %s %04x, c %04x\n",colour,pixels[i],mask[i],blend_kernel(),vec[i],ref[i]);
+}
+
+int main()
+{
+#ifndef BLEND_VECTOR
+  printf("blend: no vector kernel on this host, nothing to compare\n");
+  return 0;
+#else
+  static const Uint16 colours[]={0x0000,0xFFFF,0xFFE0,0xF800,0x07E0,0x001F,0x8410,0x39E7};
+  Uint16 pixels[256];
+  Uint8 mask[256];
+  int rows=0;
+
+  // all coverages, all destinations
+  for(int c=0; c<(int)(sizeof(colours)/sizeof(colours[0])); c++)
+    for(int d=0; d<65536; d+=256)
+    {
+      for(int i=0; i<256; i++)
+      {
+        pixels[i]=(Uint16)(d+i);
+        mask[i]=(Uint8)(i*7+d/256);
+      }
+      check_row(pixels,mask,256,colours[c]);
+      rows++;
+    }
+
+  // tails and rows that are gaps
+  srand(1);
+  for(int r=0; r<20000; r++)
+  {
+    int n=r%41;
+    for(int i=0; i<n; i++)
+    {
+      pixels[i]=(Uint16)rand();
+      mask[i]=(r%5==0)?0:(Uint8)((rand()%3)?(rand()&0xFF):255);
+    }
+    check_row(pixels,mask,n,(Uint16)rand());
+    rows++;
+  }
+
+  printf("blend: %s against c, %d rows, %d differences\n",blend_kernel(),rows,failed);
+  return failed?1:0;
+#endif
+}
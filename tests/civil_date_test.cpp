@@ -0,0 +1,164 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Test: civil date arithmetic               */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+// Every day of the years libc can represent against timegm/gmtime_r and
+// mktime in UTC: day number, date, weekday, day of year, days in month,
+// added months and ISO week (strftime %G %V). Day numbers again against
+// mktime in a zone with DST (Europe/Madrid, if it is installed). Then the
+// time of a conversion both ways, against timegm + gmtime_r and against
+// mktime + localtime_r in that zone, the calls the clock used before.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../inc/civil_date.h"
+
+#define BENCH_LOOPS   2000000
+#define TEST_ZONE     "Europe/Madrid"
+
+static int failed=0;
+
+static void fail(const char* what, int64_t z)
+{
+  civil_date c=civil_from_days(z);
+  if(failed++<10)
+    printf("civil_date: %s differs at %04lld-%02u-%02u (day %lld)\n",what,(long long)c.year,c.month,c.day,(long long)z);
+}
+
+static double now_s()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec+ts.tv_nsec/1e9;
+}
+
+int main()
+{
+  setenv("TZ","UTC0",1);
+  tzset();
+
+  // years 1..9999 with a 64 bit time_t, else what fits in 32 bit
+  int64_t first=days_from_civil(sizeof(time_t)>4?1:1902,1,1);
+  int64_t last=days_from_civil(sizeof(time_t)>4?9999:2037,12,31);
+
+  for(int64_t z=first; z<=last; z++)
+  {
+    time_t t=(time_t)(z*86400);
+    tm g;
+    gmtime_r(&t,&g);
+    civil_date c=civil_from_days(z);
+    if(c.year!=g.tm_year+1900 || c.month!=(unsigned)g.tm_mon+1 || c.day!=(unsigned)g.tm_mday)
+      fail("civil_from_days",z);
+    if(days_from_civil(g.tm_year+1900,g.tm_mon+1,g.tm_mday)!=z)
+      fail("days_from_civil",z);
+    if(civil_weekday(z)!=(unsigned)g.tm_wday)
+      fail("weekday",z);
+    if(civil_yearday(c)!=(unsigned)g.tm_yday)
+      fail("yearday",z);
+
+    // mktime normalises day 0 of next month to the last of this one
+    tm m=g;
+    m.tm_mon++;
+    m.tm_mday=0;
+    m.tm_isdst=0;
+    if(mktime(&m)!=(time_t)-1 && civil_days_in_month(c.year,c.month)!=(unsigned)m.tm_mday)
+      fail("days_in_month",z);
+
+    // one month later, clamped to the end of the month
+    tm n=g;
+    n.tm_mon++;
+    n.tm_mday=1;
+    if(timegm(&n)!=(time_t)-1)
+    {
+      civil_date a=civil_add_months(c,1);
+      unsigned dim=civil_days_in_month(n.tm_year+1900,n.tm_mon+1);
+      if(a.year!=n.tm_year+1900 || a.month!=(unsigned)n.tm_mon+1 || a.day!=(c.day<dim?c.day:dim))
+        fail("add_months",z);
+    }
+
+    // ISO week, where strftime handles the year
+    if(g.tm_year+1900>=1000)
+    {
+      char iso[32], ours[32];
+      strftime(iso,sizeof(iso),"%G %V",&g);
+      snprintf(ours,sizeof(ours),"%lld %02u",(long long)civil_iso_year(z),civil_iso_week(z));
+      if(strcmp(iso,ours)!=0)
+        fail("iso_week",z);
+    }
+  }
+  printf("civil_date: %lld days checked, %d differences\n",(long long)(last-first+1),failed);
+
+  // noon of each day through mktime in a real zone, back to a day number
+  setenv("TZ",TEST_ZONE,1);
+  tzset();
+  tm probe;
+  time_t summer=1720000000;     // july 2024
+  localtime_r(&summer,&probe);
+  int zoned=(probe.tm_gmtoff!=0);
+  if(zoned)
+  {
+    for(int64_t z=first; z<=last; z++)
+    {
+      civil_date c=civil_from_days(z);
+      tm m;
+      memset(&m,0,sizeof(m));
+      m.tm_year=(int)(c.year-1900);
+      m.tm_mon=c.month-1;
+      m.tm_mday=c.day;
+      m.tm_hour=12;
+      m.tm_isdst=-1;
+      time_t t=mktime(&m);
+      if(t==(time_t)-1)
+        continue;
+      if(civil_floor_div((int64_t)t+m.tm_gmtoff,86400)!=z || m.tm_wday!=(int)civil_weekday(z))
+        fail("mktime in " TEST_ZONE,z);
+    }
+    printf("civil_date: same days against mktime in %s, %d differences\n",TEST_ZONE,failed);
+  }
+  else
+    printf("civil_date: no %s zone, mktime only checked in UTC\n",TEST_ZONE);
+
+  // microbenchmark, date to day number and back
+  volatile int64_t sink=0;
+  double t0=now_s();
+  for(int i=0; i<BENCH_LOOPS; i++)
+  {
+    int64_t z=days_from_civil(2000+i%64,1+i%12,1+i%28);
+    sink+=civil_from_days(z).day;
+  }
+  double t1=now_s();
+  for(int i=0; i<BENCH_LOOPS; i++)
+  {
+    tm g;
+    memset(&g,0,sizeof(g));
+    g.tm_year=100+i%64;
+    g.tm_mon=i%12;
+    g.tm_mday=1+i%28;
+    time_t t=timegm(&g);
+    gmtime_r(&t,&g);
+    sink+=g.tm_mday;
+  }
+  double t2=now_s();
+  for(int i=0; i<BENCH_LOOPS; i++)
+  {
+    tm g;
+    memset(&g,0,sizeof(g));
+    g.tm_year=100+i%64;
+    g.tm_mon=i%12;
+    g.tm_mday=1+i%28;
+    g.tm_hour=12;
+    g.tm_isdst=-1;
+    time_t t=mktime(&g);
+    localtime_r(&t,&g);
+    sink+=g.tm_mday;
+  }
+  double t3=now_s();
+  printf("civil_date: %.1f ns civil, %.1f ns timegm+gmtime_r, %.1f ns mktime+localtime_r in %s\n",(t1-t0)*1e9/BENCH_LOOPS,
+         (t2-t1)*1e9/BENCH_LOOPS,(t3-t2)*1e9/BENCH_LOOPS,zoned?TEST_ZONE:"UTC");
+  return failed?1:0;
+}
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Test: hardware clock writer               */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+// The RTC_SET_TIME path with ioctl replaced by a recorder and /dev/null
+// as device, it is not a regular file so it is opened and given the
+// ioctl like /dev/rtc0. Then a failing ioctl, a missing device, and a
+// regular file as fake device written by rtc_write().
+
+#include <sys/ioctl.h>
+#include <linux/rtc.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static int ioctl_calls=0;
+static int ioctl_fail=0;
+static unsigned long ioctl_request=0;
+static struct rtc_time ioctl_time;
+
+static int test_ioctl(int fd, unsigned long request, void* arg)
+{
+  (void)fd;
+  ioctl_calls++;
+  ioctl_request=request;
+  memcpy(&ioctl_time,arg,sizeof(ioctl_time));
+  if(ioctl_fail)
+  {
+    errno=EINVAL;
+    return -1;
+  }
+  return 0;
+}
+
+#define ioctl(fd,request,arg)   test_ioctl(fd,request,arg)
+#include "../src/rtc.cpp"
+
+void sched_wake()
+{
+}
+
+static int failed=0;
+
+static void check(int ok, const char* what)
+{
+  if(!ok)
+  {
+    printf("rtc: %s\n",what);
+    failed++;
+  }
+}
+
+int main()
+{
+  // 2024-02-29 23:59:58 UTC, a thursday
+  time_t t=1709251198;
+  tm utc;
+  gmtime_r(&t,&utc);
+
+  rtc_init("/dev/null");
+  check(write_device(&utc),"ioctl path failed");
+  check(ioctl_calls==1 && ioctl_request==RTC_SET_TIME,"RTC_SET_TIME not done");
+  check(ioctl_time.tm_year==124 && ioctl_time.tm_mon==1 && ioctl_time.tm_mday==29 &&
+        ioctl_time.tm_hour==23 && ioctl_time.tm_min==59 && ioctl_time.tm_sec==58 &&
+        ioctl_time.tm_wday==4 && ioctl_time.tm_yday==59,"wrong rtc_time given");
+
+  ioctl_fail=TRUE;
+  check(!write_device(&utc),"failing ioctl reported as done");
+  ioctl_fail=FALSE;
+
+  rtc_init("/nonexistent/rtc0");
+  check(!write_device(&utc),"missing device reported as done");
+
+  // fake device, written on a second boundary by the worker
+  char path[]="/tmp/odclock_rtc_XXXXXX";
+  int fd=mkstemp(path);
+  check(fd>=0,"can't make a fake device");
+  close(fd);
+  rtc_init(path);
+  int calls=ioctl_calls;
+  rtc_write();
+  for(int i=0; i<300 && rtc_state()==RTC_BUSY; i++)
+    usleep(10000);
+  timespec now;
+  clock_gettime(CLOCK_REALTIME,&now);
+  check(rtc_state()==RTC_DONE,"fake device write failed");
+  rtc_close();
+
+  char text[64]="";
+  FILE* f=fopen(path,"r");
+  if(f)
+  {
+    if(fgets(text,sizeof(text),f)==NULL)
+      text[0]=0;
+    fclose(f);
+  }
+  unlink(path);
+  int y, mo, d, h, mi, s;
+  check(sscanf(text,"%d-%d-%d %d:%d:%d UTC",&y,&mo,&d,&h,&mi,&s)==6,"fake device text unreadable");
+  tm w;
+  memset(&w,0,sizeof(w));
+  w.tm_year=y-1900;
+  w.tm_mon=mo-1;
+  w.tm_mday=d;
+  w.tm_hour=h;
+  w.tm_min=mi;
+  w.tm_sec=s;
+  time_t written=timegm(&w);
+  check(written<=now.tv_sec && now.tv_sec-written<=1,"fake device time is not the current second");
+  check(ioctl_calls==calls,"ioctl done on a regular file");
+
+  printf("rtc: ioctl, failures and fake device, %d failed\n",failed);
+  return failed?1:0;
+}
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Test: world clock                         */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+// Every zone of zone.tab in the zoneinfo directory (ODCLOCK_ZONEINFO or
+// /usr/share/zoneinfo) against glibc with TZ set to the same file:
+// offset, abbreviation and broken down time at times from 1902 to the
+// end of 2099. Nothing to check without the directory.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/world_clock.cpp"
+
+#define TEST_TIMES    3000
+#define TEST_FIRST    (-2145916800LL)   // 1902-01-01
+#define TEST_LAST     (4102444800LL)    // 2100-01-01
+
+static int failed=0;
+
+static void fail(const char* zone, time_t t, const char* what)
+{
+  if(failed++<10)
+    printf("world_clock: %s at %lld, %s differs\n",zone,(long long)t,what);
+}
+
+static time_t test_time(int n)
+{
+  // spread over the range, every 7th near a round hour to hit changes
+  Sint64 t=TEST_FIRST+(Sint64)((TEST_LAST-TEST_FIRST)*((double)rand()/RAND_MAX));
+  if(n%7==0)
+    t=t/3600*3600+(rand()%3)-1;
+  return (time_t)(t<TEST_LAST?t:TEST_LAST-1);
+}
+
+static void check_zone(const char* root, const char* name)
+{
+  char tz[300];
+  snprintf(tz,sizeof(tz),":%s/%s",root,name);
+  setenv("TZ",tz,1);
+  tzset();
+
+  world_free();
+  world_add(name);
+  if(world_load()!=1)
+  {
+    fail(name,0,"loading");
+    return;
+  }
+
+  srand(1);
+  for(int n=0; n<TEST_TIMES; n++)
+  {
+    time_t t=test_time(n);
+    tm lt, wt;
+    localtime_r(&t,&lt);
+    int offset;
+    const char* abbr;
+    world_offset(0,t,&offset,&abbr);
+    world_tm(t,offset,&wt);
+    if(offset!=lt.tm_gmtoff)
+      fail(name,t,"offset");
+    else if(strcmp(abbr,lt.tm_zone)!=0)
+      fail(name,t,"abbreviation");
+    else if(wt.tm_year!=lt.tm_year || wt.tm_mon!=lt.tm_mon || wt.tm_mday!=lt.tm_mday ||
+            wt.tm_hour!=lt.tm_hour || wt.tm_min!=lt.tm_min || wt.tm_sec!=lt.tm_sec ||
+            wt.tm_wday!=lt.tm_wday || wt.tm_yday!=lt.tm_yday)
+      fail(name,t,"broken down time");
+  }
+}
+
+int main()
+{
+  const char* root=getenv("ODCLOCK_ZONEINFO");
+  if(root==NULL || !root[0])
+    root=WORLD_ZONEINFO;
+
+  char path[300];
+  snprintf(path,sizeof(path),"%s/zone.tab",root);
+  FILE* tab=fopen(path,"r");
+  if(tab==NULL)
+  {
+    printf("world_clock: no %s, nothing to compare\n",path);
+    return 0;
+  }
+
+  world_init(root);
+  int zones=0;
+  char str[300];
+  char cc[8], coord[32], name[ZONE_NAME];
+  while(fgets(str,sizeof(str),tab)!=NULL)
+  {
+    if(str[0]=='#' || sscanf(str,"%7s %31s %63s",cc,coord,name)!=3)
+      continue;
+    check_zone(root,name);
+    zones++;
+  }
+  fclose(tab);
+  world_free();
+
+  printf("world_clock: %d zones, %d times each against glibc, %d differences\n",zones,TEST_TIMES,failed);
+  return failed?1:0;
+}
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////
+/*  OpenDingux Clock                          */
+/*  Font baker (build machine tool)           */
+/*                                            */
+/*  License: GPL v.2                          */
+////////////////////////////////////////////////
+
+// bakefont <font.ttf> <ptsize> <name>
+// Rasterizes chars 32..383 (Latin-1 and Latin Extended-A) with
+// FreeType the same way SDL_ttf does (72 dpi, default hinting, normal
+// antialiasing) and prints a header with the glyphs for
+// inc/bitmap_font.h. Chars the font lacks get its missing glyph box,
+// baked once, and are marked as not provided.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define FIRST_CHAR  32
+#define LAST_CHAR   0x17F
+
+// 26.6 fixed point, as SDL_ttf
+#define FT_FLOOR(X) (((X) & -64) / 64)
+#define FT_CEIL(X)  ((((X) + 63) & -64) / 64)
+
+///////////////////////////////////
+/*  Output helpers               */
+///////////////////////////////////
+static int bytes_out=0;
+
+static void put_byte(int b)
+{
+  printf("%s0x%02x,",(bytes_out%16)?" ":"\n  ",b);
+  bytes_out++;
+}
+
+int main(int argc, char *argv[])
+{
+  if(argc<4)
+  {
+    fprintf(stderr,"usage: bakefont <font.ttf> <ptsize> <name>\n");
+    return 1;
+  }
+  const char* file=argv[1];
+  int ptsize=atoi(argv[2]);
+  const char* name=argv[3];
+
+  FT_Library lib;
+  FT_Face face;
+  if(FT_Init_FreeType(&lib) || FT_New_Face(lib,file,0,&face))
+  {
+    fprintf(stderr,"bakefont: can't open %s\n",file);
+    return 1;
+  }
+  FT_Set_Char_Size(face,0,ptsize*64,0,0);
+
+  FT_Fixed scale=face->size->metrics.y_scale;
+  int ascent=FT_CEIL(FT_MulFix(face->ascender,scale));
+  int descent=FT_CEIL(FT_MulFix(face->descender,scale));
+  int height=ascent-descent+1;
+  int lineskip=FT_CEIL(FT_MulFix(face->height,scale));
+
+  char guard[64];
+  int f;
+  for(f=0; name[f] && f<63; f++)
+    guard[f]=toupper((unsigned char)name[f]);
+  guard[f]=0;
+
+  printf("#ifndef BFONT_%s_H\n#define BFONT_%s_H\n\n",guard,guard);
+  printf("// generated by tools/bakefont from %s at %d pt, don't edit\n\n",file,ptsize);
+  printf("#include \"bitmap_font.h\"\n\n");
+
+  // glyph bitmaps
+  int minx[LAST_CHAR+1], maxy[LAST_CHAR+1], w[LAST_CHAR+1], h[LAST_CHAR+1], advance[LAST_CHAR+1];
+  int provided[LAST_CHAR+1];
+  unsigned offset[LAST_CHAR+1];
+  int missing=-1;       // first char with the missing glyph
+  printf("static const Uint8 bfont_%s_bits[]=\n{",name);
+  for(int ch=FIRST_CHAR; ch<=LAST_CHAR; ch++)
+  {
+    FT_UInt index=FT_Get_Char_Index(face,ch);
+    provided[ch]=(index!=0);
+    if(!index && missing>=0)
+    {
+      minx[ch]=minx[missing];
+      maxy[ch]=maxy[missing];
+      w[ch]=w[missing];
+      h[ch]=h[missing];
+      advance[ch]=advance[missing];
+      offset[ch]=offset[missing];
+      continue;
+    }
+    if(!index)
+      missing=ch;
+    minx[ch]=maxy[ch]=w[ch]=h[ch]=advance[ch]=0;
+    offset[ch]=bytes_out;
+    if(FT_Load_Glyph(face,index,FT_LOAD_DEFAULT))
+      continue;
+    FT_Glyph_Metrics* m=&face->glyph->metrics;
+    minx[ch]=FT_FLOOR(m->horiBearingX);
+    maxy[ch]=FT_FLOOR(m->horiBearingY);
+    advance[ch]=FT_CEIL(m->horiAdvance);
+    if(FT_Render_Glyph(face->glyph,FT_RENDER_MODE_NORMAL))
+      continue;
+
+    FT_Bitmap* b=&face->glyph->bitmap;
+    w[ch]=b->width;
+    h[ch]=b->rows;
+    for(unsigned y=0; y<b->rows; y++)
+    {
+      const unsigned char* row=b->buffer+y*b->pitch;
+      for(unsigned x=0; x<b->width; x+=2)
+      {
+        int hi=(row[x]*15+127)/255;
+        int lo=(x+1<b->width)?(row[x+1]*15+127)/255:0;
+        put_byte((hi<<4)|lo);
+      }
+    }
+  }
+  if(bytes_out==0)
+    put_byte(0);
+  printf("\n};\n\n");
+
+  printf("static const bfont_glyph bfont_%s_glyphs[]=\n{\n",name);
+  for(int ch=FIRST_CHAR; ch<=LAST_CHAR; ch++)
+    printf("  {%d,%d,%d,%d,%d,%d,%u},%s\n",minx[ch],maxy[ch],w[ch],h[ch],advance[ch],provided[ch],offset[ch],ch==FIRST_CHAR?"    // minx, maxy, w, h, advance, provided, offset":"");
+  printf("};\n\n");
+
+  // kerning pairs, in the order bfont_kerning searches them
+  int nkern=0;
+  printf("static const bfont_kern bfont_%s_kern[]=\n{\n",name);
+  if(FT_HAS_KERNING(face))
+  {
+    for(int a=FIRST_CHAR; a<=LAST_CHAR; a++)
+    {
+      FT_UInt ia=FT_Get_Char_Index(face,a);
+      if(!ia)
+        continue;
+      for(int b=FIRST_CHAR; b<=LAST_CHAR; b++)
+      {
+        FT_UInt ib=FT_Get_Char_Index(face,b);
+        FT_Vector delta;
+        if(!ib || FT_Get_Kerning(face,ia,ib,FT_KERNING_DEFAULT,&delta))
+          continue;
+        int d=delta.x>>6;
+        if(d!=0 && d>=-128 && d<=127)
+        {
+          printf("  {%d,%d,%d},\n",a,b,d);
+          nkern++;
+        }
+      }
+    }
+  }
+  if(nkern==0)
+    printf("  {0,0,0}\n");
+  printf("};\n\n");
+
+  printf("static const bfont bfont_%s=\n{\n",name);
+  printf("  %d,%d,%d,%d,%d,    // size, ascent, descent, height, lineskip\n",ptsize,ascent,descent,height,lineskip);
+  printf("  %d,%d,%d,    // first, last, missing\n",FIRST_CHAR,LAST_CHAR,missing>0?missing:0);
+  printf("  bfont_%s_glyphs,\n  bfont_%s_bits,\n  bfont_%s_kern,\n  %d\n};\n\n",name,name,name,nkern);
+  printf("#endif\n");
+
+  FT_Done_Face(face);
+  FT_Done_FreeType(lib);
+  return 0;
+}